@@ -1,23 +1,92 @@
-#include "../src/csv_parser.hpp"
+/**
+ * @file benchmark.cpp
+ * @brief Benchmark of the matching engine, from the order book alone up to parsing and writing.
+ *
+ * Usage: benchmark [--orders <n>[,<n>...]] [--workload realistic|uniform] [--scenario <file>]
+ *                  [--instruments <n>] [--seed <n>] [--input <file>] [--io] [--output <file>]
+ *                  [--config <file>] [--trials <n>] [--report <file.json|file.csv>]
+ *        benchmark --compare <base-report> <report> [--alpha <p>] [--min-change <fraction>]
+ *
+ * Workloads come from the WorkloadGenerator (realistic flow, tuned by a scenario file),
+ * from the historical uniform generator, or from an order file. For each workload the benchmark runs:
+ * - the order book alone (addOrder/modifyOrder/cancelOrder), as a baseline;
+ * - MatchingEngine::processOrder on every order, timed one by one;
+ * - with --io, the whole path: the orders are parsed from a file (the --input file, or
+ *   the generated orders written to a temporary CSV file) and every result is written
+ *   by a CSVWriter to --output.
+ *
+ * It reports the throughput, the latency percentiles of processOrder and the number of
+ * heap allocations per order, counted by replacing the global operator new. Each path
+ * runs --trials times; with --report, the value of every trial is written to a JSON or
+ * CSV report together with the run's metadata, and --compare flags the metrics of a
+ * report that are significantly worse than in a base report (Welch's t-test).
+ */
+
+#include "../src/bench_report.hpp"
 #include "../src/csv_writer.hpp"
+#include "../src/engine_config.hpp"
+#include "../src/latency_stats.hpp"
+#include "../src/matching_engine.hpp"
 #include "../src/order_book.hpp"
+#include "../src/order_source.hpp"
+#include "../src/workload_generator.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
 #include <unordered_map>
-#include <chrono>
 #include <vector>
-#include <random>
-#include <fstream>
+
+// ===== Comptage des allocations =====
+// Tous les new du programme passent par ces opérateurs, y compris ceux des ressources pmr
+static std::atomic<uint64_t> allocationCount{0};
+static std::atomic<uint64_t> allocatedBytes{0};
+
+static void* countedAlloc(size_t size, size_t alignment) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    if (size == 0) {
+        size = 1;
+    }
+    void* p = alignment <= alignof(std::max_align_t)
+                  ? std::malloc(size)
+                  : std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void* operator new(size_t size) { return countedAlloc(size, alignof(std::max_align_t)); }
+void* operator new[](size_t size) { return countedAlloc(size, alignof(std::max_align_t)); }
+void* operator new(size_t size, std::align_val_t alignment) { return countedAlloc(size, static_cast<size_t>(alignment)); }
+void* operator new[](size_t size, std::align_val_t alignment) { return countedAlloc(size, static_cast<size_t>(alignment)); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t, std::align_val_t) noexcept { std::free(p); }
+
+using Clock = std::chrono::steady_clock;
 
 // Fonction pour générer un ordre aléatoire
-Order generateRandomOrder(int id, uint64_t timestamp, const std::string& instrument) {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    static std::uniform_int_distribution<> side_dist(0, 1);
-    static std::uniform_int_distribution<> type_dist(0, 1);
-    static std::uniform_int_distribution<> action_dist(0, 2);
-    static std::uniform_int_distribution<> quantity_dist(1, 1000);
-    static std::uniform_real_distribution<> price_dist(10.0, 1000.0);
-    
+Order generateRandomOrder(std::mt19937& gen, int id, uint64_t timestamp, const std::string& instrument) {
+    std::uniform_int_distribution<> side_dist(0, 1);
+    std::uniform_int_distribution<> type_dist(0, 1);
+    std::uniform_int_distribution<> action_dist(0, 2);
+    std::uniform_int_distribution<> quantity_dist(1, 1000);
+    std::uniform_real_distribution<> price_dist(10.0, 1000.0);
+
     Order order;
     order.timestamp = timestamp;
     order.order_id = id;
@@ -27,85 +96,421 @@ Order generateRandomOrder(int id, uint64_t timestamp, const std::string& instrum
     order.quantity = quantity_dist(gen);
     order.price = static_cast<float>(price_dist(gen));
     order.action = static_cast<Action>(action_dist(gen));
-    
+
     return order;
 }
 
 // Fonction pour générer un grand nombre d'ordres pour le benchmark
-std::vector<Order> generateOrdersForBenchmark(int count) {
+std::vector<Order> generateOrdersForBenchmark(int count, int instruments, uint32_t seed) {
+    std::mt19937 gen(seed);
     std::vector<Order> orders;
+    orders.reserve(static_cast<size_t>(count));
     uint64_t timestamp = 1617278400000000000;
-    
+
     for (int i = 0; i < count; i++) {
         // Générer des ordres pour différents instruments
-        std::string instrument = "INSTR" + std::to_string(i % 10);
-        orders.push_back(generateRandomOrder(i, timestamp, instrument));
+        std::string instrument = "INSTR" + std::to_string(i % instruments);
+        orders.push_back(generateRandomOrder(gen, i, timestamp, instrument));
         timestamp += 100000; // Incrémenter le timestamp
     }
-    
+
     return orders;
 }
 
-int main() {
-    std::cout << "=== Matching Engine Benchmark ===" << std::endl;
-    
+// Traite les ordres directement sur les carnets, sans moteur
+static double benchmarkOrderBooks(const std::vector<Order>& orders) {
+    auto start = Clock::now();
+    std::unordered_map<std::string, OrderBook> orderBooks;
+
+    for (const auto& order : orders) {
+        // Créer l'OrderBook pour cet instrument s'il n'existe pas déjà
+        auto it = orderBooks.find(order.instrument);
+        if (it == orderBooks.end()) {
+            it = orderBooks.emplace(order.instrument, OrderBook(order.instrument)).first;
+        }
+
+        // Traiter l'ordre selon son action
+        switch (order.action) {
+            case Action::NEW:
+                it->second.addOrder(order);
+                break;
+
+            case Action::MODIFY:
+                it->second.modifyOrder(order);
+                break;
+
+            case Action::CANCEL:
+                it->second.cancelOrder(order.order_id);
+                break;
+        }
+    }
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+/**
+ * @brief Measurements of one run of the engine
+ */
+struct EngineRun {
+    double milliseconds = 0.0;       // Wall time of the whole run
+    std::vector<double> latencies;   // Time of each processOrder call, in nanoseconds
+    uint64_t results = 0;            // Results produced
+    uint64_t allocations = 0;        // Heap allocations during the run
+    uint64_t bytes = 0;              // Bytes allocated during the run
+    double peakRssKib = -1.0;        // Peak resident memory during the run, -1 if unknown
+};
+
+// Remet à zéro le pic de mémoire résidente du processus (VmHWM, Linux 4.0 et plus)
+static bool resetPeakRss() {
+    std::ofstream file("/proc/self/clear_refs");
+    file << "5";
+    file.close();
+    return static_cast<bool>(file);
+}
+
+// Pic de mémoire résidente depuis la dernière remise à zéro, en Kio, -1 si inconnu
+static double readPeakRss() {
+    std::ifstream file("/proc/self/status");
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.compare(0, 6, "VmHWM:") == 0) {
+            return std::strtod(line.c_str() + 6, nullptr);
+        }
+    }
+    return -1.0;
+}
+
+// Traite les ordres en mémoire avec le moteur, en chronométrant chaque ordre
+static EngineRun benchmarkEngine(const std::vector<Order>& orders, const EngineConfig& config) {
+    EngineRun run;
+    bool peakReset = resetPeakRss();
+    run.latencies.reserve(orders.size());
+    MatchingEngine engine(config);
+
+    uint64_t allocations = allocationCount.load(std::memory_order_relaxed);
+    uint64_t bytes = allocatedBytes.load(std::memory_order_relaxed);
+    auto start = Clock::now();
+    for (const auto& order : orders) {
+        auto begin = Clock::now();
+        std::vector<OrderResult> results = engine.processOrder(order);
+        auto end = Clock::now();
+        run.latencies.push_back(std::chrono::duration<double, std::nano>(end - begin).count());
+        run.results += results.size();
+    }
+    run.milliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    run.allocations = allocationCount.load(std::memory_order_relaxed) - allocations;
+    run.bytes = allocatedBytes.load(std::memory_order_relaxed) - bytes;
+    if (peakReset) {
+        run.peakRssKib = readPeakRss();
+    }
+    return run;
+}
+
+// Parse le fichier, traite les ordres et écrit les résultats, comme l'application
+static EngineRun benchmarkWithIo(const std::string& inputFile, const std::string& outputFile,
+                                 const EngineConfig& config, size_t& orderCount) {
+    EngineRun run;
+    bool peakReset = resetPeakRss();
+    MatchingEngine engine(config);
+    orderCount = 0;
+
+    uint64_t allocations = allocationCount.load(std::memory_order_relaxed);
+    uint64_t bytes = allocatedBytes.load(std::memory_order_relaxed);
+    auto start = Clock::now();
+    std::unique_ptr<OrderSource> source = openOrderSource(inputFile);
+    if (!source) {
+        return run;
+    }
+    CSVWriter writer(outputFile);
+    writer.writeHeader();
+
+    std::vector<Order> batch;
+    while (source->next(batch, 4096) > 0) {
+        for (const auto& order : batch) {
+            auto begin = Clock::now();
+            std::vector<OrderResult> results = engine.processOrder(order);
+            for (const auto& result : results) {
+                writer.writeOrderResult(result);
+            }
+            auto end = Clock::now();
+            run.latencies.push_back(std::chrono::duration<double, std::nano>(end - begin).count());
+            run.results += results.size();
+        }
+        orderCount += batch.size();
+    }
+    writer.flush();
+    run.milliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    run.allocations = allocationCount.load(std::memory_order_relaxed) - allocations;
+    run.bytes = allocatedBytes.load(std::memory_order_relaxed) - bytes;
+    if (peakReset) {
+        run.peakRssKib = readPeakRss();
+    }
+    return run;
+}
+
+// Ajoute les mesures d'un essai au rapport
+static void recordRun(BenchReport& report, const std::string& name, const EngineRun& run, size_t count) {
+    std::vector<double> latencies = run.latencies;
+    LatencySummary summary = summarizeLatencies(latencies);
+    double perOrder = count > 0 ? static_cast<double>(count) : 1.0;
+    report.add(name, "throughput", "orders/s", true, perOrder / std::max(run.milliseconds, 1e-6) * 1000.0);
+    report.add(name, "p50", "ns", false, summary.p50);
+    report.add(name, "p99", "ns", false, summary.p99);
+    report.add(name, "p99.9", "ns", false, summary.p999);
+    report.add(name, "allocations", "allocs/order", false, static_cast<double>(run.allocations) / perOrder);
+    report.add(name, "allocated_bytes", "bytes/order", false, static_cast<double>(run.bytes) / perOrder);
+    if (run.peakRssKib >= 0.0) {
+        report.add(name, "peak_rss", "KiB", false, run.peakRssKib);
+    }
+}
+
+// Cumule un essai dans le total affiché
+static void mergeRun(EngineRun& total, const EngineRun& run) {
+    total.milliseconds += run.milliseconds;
+    total.latencies.insert(total.latencies.end(), run.latencies.begin(), run.latencies.end());
+    total.results += run.results;
+    total.allocations += run.allocations;
+    total.bytes += run.bytes;
+}
+
+// Affiche le débit, les percentiles de latence et les allocations de tous les essais
+static void printRun(const char* label, EngineRun& run, size_t count, size_t trials) {
+    LatencySummary summary = summarizeLatencies(run.latencies);
+    double perOrder = count > 0 ? static_cast<double>(count * trials) : 1.0;
+    std::cout << "  - " << label << ": " << run.milliseconds / static_cast<double>(trials) << " ms ("
+              << static_cast<uint64_t>(perOrder / std::max(run.milliseconds, 1e-6) * 1000.0) << " orders/s, "
+              << run.results / trials << " results)" << std::endl;
+    std::cout << "      latency per order (ns): p50 " << summary.p50 << ", p90 " << summary.p90
+              << ", p99 " << summary.p99 << ", p99.9 " << summary.p999 << ", max " << summary.max << std::endl;
+    std::cout << "      allocations per order: " << static_cast<double>(run.allocations) / perOrder
+              << " (" << static_cast<double>(run.bytes) / perOrder << " bytes)" << std::endl;
+}
+
+// Compare deux rapports et signale les régressions significatives
+static int compareMode(int argc, char* argv[]) {
+    if (argc < 4) {
+        std::cerr << "Usage: " << argv[0] << " --compare <base-report> <report> [--alpha <p>] [--min-change <fraction>]" << std::endl;
+        return 1;
+    }
+    double alpha = 0.05;
+    double minChange = 0.02;
+    for (int i = 4; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--alpha" && i + 1 < argc) {
+            alpha = std::stod(argv[++i]);
+        } else if (arg == "--min-change" && i + 1 < argc) {
+            minChange = std::stod(argv[++i]);
+        } else {
+            std::cerr << "Unknown option: " << arg << std::endl;
+            return 1;
+        }
+    }
+    BenchReport base;
+    BenchReport current;
+    if (!BenchReport::read(argv[2], base) || !BenchReport::read(argv[3], current)) {
+        return 1;
+    }
+
+    std::cout << "Base:    " << argv[2] << " (revision " << base.metadata("git_revision") << ", " << base.metadata("date") << ")" << std::endl;
+    std::cout << "Current: " << argv[3] << " (revision " << current.metadata("git_revision") << ", " << current.metadata("date") << ")" << std::endl;
+    for (const char* key : {"cpu", "flags", "seed", "workload"}) {
+        if (base.metadata(key) != current.metadata(key)) {
+            std::cout << "Warning: " << key << " differs (" << base.metadata(key) << " / " << current.metadata(key) << ")" << std::endl;
+        }
+    }
+
+    std::vector<BenchComparison> comparisons = compareReports(base, current, alpha, minChange);
+    size_t regressions = 0;
+    std::cout << "\n" << std::left << std::setw(22) << "case" << std::setw(18) << "metric" << std::right
+              << std::setw(14) << "base" << std::setw(14) << "current" << std::setw(10) << "change"
+              << std::setw(10) << "p-value" << "  verdict" << std::endl;
+    for (const auto& comparison : comparisons) {
+        std::cout << std::left << std::setw(22) << comparison.name << std::setw(18) << comparison.metric << std::right
+                  << std::setw(14) << std::setprecision(6) << comparison.baseMean
+                  << std::setw(14) << comparison.currentMean
+                  << std::setw(9) << std::fixed << std::setprecision(1) << comparison.change * 100.0 << "%"
+                  << std::setw(10) << std::setprecision(4) << comparison.pValue << std::defaultfloat
+                  << "  " << verdictName(comparison.verdict) << std::endl;
+        if (comparison.verdict == BenchVerdict::REGRESSED) {
+            ++regressions;
+        }
+    }
+    std::cout << "\n" << comparisons.size() << " metrics compared, " << regressions << " significant regressions"
+              << " (alpha " << alpha << ", minimum change " << minChange * 100.0 << "%)" << std::endl;
+    return regressions > 0 ? 2 : 0;
+}
+
+// Découpe une liste de nombres séparés par des virgules
+static std::vector<int> parseCounts(const std::string& list) {
+    std::vector<int> counts;
+    size_t begin = 0;
+    while (begin <= list.size()) {
+        size_t end = list.find(',', begin);
+        if (end == std::string::npos) {
+            end = list.size();
+        }
+        if (end > begin) {
+            counts.push_back(std::stoi(list.substr(begin, end - begin)));
+        }
+        begin = end + 1;
+    }
+    return counts;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && std::string(argv[1]) == "--compare") {
+        return compareMode(argc, argv);
+    }
+    const char* usage = " [--orders <n>[,<n>...]] [--workload realistic|uniform] [--scenario <file>]"
+                        " [--instruments <n>] [--seed <n>] [--input <file>] [--io] [--output <file>]"
+                        " [--config <file>] [--trials <n>] [--report <file.json|file.csv>]";
     // Nombre d'ordres à tester
-    const std::vector<int> orderCounts = {100, 1000, 10000, 100000};
-    
+    std::vector<int> orderCounts = {100, 1000, 10000, 100000};
+    std::string workload = "realistic";
+    WorkloadOptions workloadOptions;
+    std::string instruments;
+    std::string seed;
+    std::string inputFile;
+    bool withIo = false;
+    std::string tempDir = std::filesystem::temp_directory_path().string();
+    std::string outputFile = tempDir + "/benchmark_results.csv";
+    std::string configFile;
+    std::string scenarioFile;
+    size_t trials = 3;
+    std::string reportFile;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--orders" && i + 1 < argc) {
+            orderCounts = parseCounts(argv[++i]);
+        } else if (arg == "--trials" && i + 1 < argc) {
+            trials = std::max<size_t>(1, std::stoul(argv[++i]));
+        } else if (arg == "--report" && i + 1 < argc) {
+            reportFile = argv[++i];
+        } else if (arg == "--workload" && i + 1 < argc) {
+            workload = argv[++i];
+            if (workload != "realistic" && workload != "uniform") {
+                std::cerr << "Unknown workload: " << workload << std::endl;
+                return 1;
+            }
+        } else if (arg == "--scenario" && i + 1 < argc) {
+            scenarioFile = argv[++i];
+            if (!WorkloadOptions::load(scenarioFile, workloadOptions)) {
+                return 1;
+            }
+        } else if (arg == "--instruments" && i + 1 < argc) {
+            instruments = argv[++i];
+        } else if (arg == "--seed" && i + 1 < argc) {
+            seed = argv[++i];
+        } else if (arg == "--input" && i + 1 < argc) {
+            inputFile = argv[++i];
+        } else if (arg == "--io") {
+            withIo = true;
+        } else if (arg == "--output" && i + 1 < argc) {
+            outputFile = argv[++i];
+        } else if (arg == "--config" && i + 1 < argc) {
+            configFile = argv[++i];
+        } else {
+            std::cerr << "Usage: " << argv[0] << usage << std::endl;
+            return 1;
+        }
+    }
+
+    // Les options de la ligne de commande l'emportent sur le scénario
+    if (!instruments.empty()) {
+        workloadOptions.instruments = std::max<size_t>(1, std::stoul(instruments));
+    }
+    if (!seed.empty()) {
+        workloadOptions.seed = static_cast<uint32_t>(std::stoul(seed));
+    }
+
+    EngineConfig config;
+    if (!configFile.empty()) {
+        config = EngineConfig::load(configFile);
+    }
+
+    BenchReport report;
+    report.addSystemMetadata();
+    report.setMetadata("workload", inputFile.empty() ? workload : "file");
+    report.setMetadata("seed", std::to_string(workloadOptions.seed));
+    report.setMetadata("scenario", scenarioFile);
+    report.setMetadata("input", inputFile);
+    report.setMetadata("trials", std::to_string(trials));
+    report.setMetadata("io", withIo ? "yes" : "no");
+
+    std::cout << "=== Matching Engine Benchmark ===" << std::endl;
+
+    // Un fichier d'entrée remplace les charges générées
+    if (!inputFile.empty()) {
+        orderCounts = {0};
+    }
+
     for (int count : orderCounts) {
-        std::cout << "\nTesting with " << count << " orders:" << std::endl;
-        
-        // Générer les ordres
-        auto start = std::chrono::high_resolution_clock::now();
-        std::vector<Order> orders = generateOrdersForBenchmark(count);
-        auto end = std::chrono::high_resolution_clock::now();
-        
-        std::chrono::duration<double, std::milli> generateTime = end - start;
-        std::cout << "  - Generation time: " << generateTime.count() << " ms" << std::endl;
-        
-        // Traiter les ordres
-        start = std::chrono::high_resolution_clock::now();
-        
-        std::unordered_map<std::string, OrderBook> orderBooks;
-        
-        for (const auto& order : orders) {
-            // Créer l'OrderBook pour cet instrument s'il n'existe pas déjà
-            if (orderBooks.find(order.instrument) == orderBooks.end()) {
-                orderBooks.emplace(order.instrument, OrderBook(order.instrument));
+        std::vector<Order> orders;
+        auto start = Clock::now();
+        if (inputFile.empty() && workload == "uniform") {
+            orders = generateOrdersForBenchmark(count, static_cast<int>(workloadOptions.instruments), workloadOptions.seed);
+        } else if (inputFile.empty()) {
+            WorkloadGenerator generator(workloadOptions);
+            generator.generate(static_cast<size_t>(count), orders);
+        }
+        if (inputFile.empty()) {
+            std::cout << "\nTesting with " << count << " orders (" << workload << " workload, seed "
+                      << workloadOptions.seed << "):" << std::endl;
+        } else {
+            if (!loadOrderFile(inputFile, orders)) {
+                return 1;
+            }
+            std::cout << "\nTesting with " << orders.size() << " orders from " << inputFile << ":" << std::endl;
+        }
+        std::chrono::duration<double, std::milli> generateTime = Clock::now() - start;
+        std::cout << "  - " << (inputFile.empty() ? "Generation" : "Load") << " time: " << generateTime.count() << " ms" << std::endl;
+
+        std::string size = std::to_string(orders.size());
+        double bookTime = 0.0;
+        for (size_t trial = 0; trial < trials; ++trial) {
+            double milliseconds = benchmarkOrderBooks(orders);
+            bookTime += milliseconds;
+            report.add("books/" + size, "throughput", "orders/s", true,
+                       static_cast<double>(orders.size()) / std::max(milliseconds, 1e-6) * 1000.0);
+        }
+        std::cout << "  - Order books only: " << bookTime / static_cast<double>(trials) << " ms" << std::endl;
+
+        EngineRun engineTotal;
+        for (size_t trial = 0; trial < trials; ++trial) {
+            EngineRun run = benchmarkEngine(orders, config);
+            recordRun(report, "engine/" + size, run, orders.size());
+            mergeRun(engineTotal, run);
+        }
+        printRun("Matching engine", engineTotal, orders.size(), trials);
+
+        if (withIo) {
+            // Les ordres générés sont d'abord écrits dans un CSV temporaire
+            std::string source = inputFile;
+            if (source.empty()) {
+                source = tempDir + "/benchmark_orders.csv";
+                if (!writeOrderFile(source, orders)) {
+                    return 1;
+                }
+            }
+            size_t parsed = 0;
+            EngineRun ioTotal;
+            for (size_t trial = 0; trial < trials; ++trial) {
+                EngineRun run = benchmarkWithIo(source, outputFile, config, parsed);
+                recordRun(report, "io/" + size, run, parsed);
+                mergeRun(ioTotal, run);
             }
-            
-            // Traiter l'ordre selon son action
-            switch (order.action) {
-                case Action::NEW:
-                    orderBooks[order.instrument].addOrder(order);
-                    break;
-                    
-                case Action::MODIFY:
-                    orderBooks[order.instrument].modifyOrder(order);
-                    break;
-                    
-                case Action::CANCEL:
-                    orderBooks[order.instrument].cancelOrder(order.order_id);
-                    break;
+            printRun("Parse, match and write", ioTotal, parsed, trials);
+            if (inputFile.empty()) {
+                std::filesystem::remove(source);
             }
         }
-        
-        end = std::chrono::high_resolution_clock::now();
-        std::chrono::duration<double, std::milli> processTime = end - start;
-        
-        std::cout << "  - Processing time: " << processTime.count() << " ms" << std::endl;
-        std::cout << "  - Average time per order: " << processTime.count() / count << " ms" << std::endl;
-        
-        // Mesurer la mémoire utilisée (cette méthode est approximative)
-        size_t memoryUsage = 0;
-        for (const auto& [instrument, book] : orderBooks) {
-            // Estimer la taille des ordres dans les maps d'achat et de vente
-            memoryUsage += book.getBuySide().size() * sizeof(std::pair<double, std::list<Order>>);
-            memoryUsage += book.getSellSide().size() * sizeof(std::pair<double, std::list<Order>>);
-        }
-        
-        std::cout << "  - Estimated memory usage: " << memoryUsage / 1024 << " KB" << std::endl;
-    }
-    
+    }
+
+    if (!reportFile.empty()) {
+        if (!report.write(reportFile)) {
+            return 1;
+        }
+        std::cout << "\nReport written to " << reportFile << std::endl;
+    }
+
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,428 @@
+/**
+ * @file microbench.cpp
+ * @brief Microbenchmarks of single order book operations at controlled book depths.
+ *
+ * Usage: microbench [--depths <n>[,<n>...]] [--samples <n>] [--warmup <n>] [--trials <n>]
+ *                   [--sweep-levels <n>] [--cpu <n>] [--timer tsc|clock] [--seed <n>]
+ *                   [--report <file.json|file.csv>]
+ *
+ * Each operation is timed on its own, in a book holding a fixed number of resting orders:
+ * - add:    OrderBook::addOrder at an existing level; the order is then canceled, untimed;
+ * - cancel: OrderBook::cancelOrder of a resting order, which is then added back, untimed;
+ * - modify: OrderBook::modifyOrder moving a resting order to another level of its side;
+ * - top:    read of the best bid, the best ask and the first order of each;
+ * - sweep:  MatchingEngine::processOrder of a market order that takes the first N levels.
+ *
+ * Every trial builds a fresh book, runs the warmup operations untimed and then the timed
+ * samples. The benchmark reports, for each operation and depth, the median and p99 in
+ * nanoseconds per operation (median over the trials), and the spread of the trial medians.
+ * With --report, the median and p99 of every trial are also written to a report that
+ * benchmark --compare can check against a base run.
+ */
+
+#include "../src/bench_report.hpp"
+#include "../src/latency_stats.hpp"
+#include "../src/matching_engine.hpp"
+#include "../src/order_book.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sched.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define MICROBENCH_HAS_TSC 1
+#endif
+
+// ===== Chronométrage =====
+
+/**
+ * @brief Timestamps in ticks of the TSC or of steady_clock, converted to nanoseconds
+ *
+ * The TSC is read between two lfence instructions so that the timed operation cannot be
+ * reordered around the reads. Its frequency is calibrated against steady_clock, and the
+ * cost of two back-to-back reads is subtracted from every sample.
+ */
+class OpTimer {
+public:
+    explicit OpTimer(bool useTsc) : useTsc_(useTsc) {
+#ifndef MICROBENCH_HAS_TSC
+        useTsc_ = false;
+#endif
+        if (useTsc_) {
+            calibrate();
+        }
+        std::vector<double> empty(10000);
+        for (auto& sample : empty) {
+            uint64_t start = now();
+            sample = static_cast<double>(now() - start);
+        }
+        std::sort(empty.begin(), empty.end());
+        overhead_ = empty[empty.size() / 2];
+    }
+
+    bool usesTsc() const { return useTsc_; }
+    double ticksPerNs() const { return ticksPerNs_; }
+
+    uint64_t now() const {
+#ifdef MICROBENCH_HAS_TSC
+        if (useTsc_) {
+            _mm_lfence();
+            uint64_t ticks = __rdtsc();
+            _mm_lfence();
+            return ticks;
+        }
+#endif
+        return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+    }
+
+    /**
+     * @brief Duration of a sample in nanoseconds, without the timer's own cost
+     */
+    double elapsedNs(uint64_t start, uint64_t end) const {
+        double ticks = static_cast<double>(end - start) - overhead_;
+        return std::max(ticks, 0.0) / ticksPerNs_;
+    }
+
+private:
+    void calibrate() {
+        auto clockStart = std::chrono::steady_clock::now();
+        uint64_t tscStart = now();
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        uint64_t tscEnd = now();
+        double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - clockStart).count();
+        ticksPerNs_ = static_cast<double>(tscEnd - tscStart) / ns;
+    }
+
+    bool useTsc_;
+    double ticksPerNs_ = 1.0;  ///< steady_clock counts nanoseconds
+    double overhead_ = 0.0;    ///< Ticks of two back-to-back reads
+};
+
+// Empêche le compilateur d'éliminer une lecture dont le résultat n'est pas utilisé
+static volatile double sink;
+
+// ===== Carnet de départ =====
+
+static const char* INSTRUMENT = "BENCH";
+static constexpr double TICK = 0.01;
+static constexpr double BEST_BID = 100.00;
+
+/**
+ * @brief Resting orders of a book of a given depth
+ *
+ * Half of the orders are bids and half asks, over sqrt(depth / 2) levels per side with
+ * the same number of orders on each level, one tick apart around a 100.00/100.01 spread.
+ */
+struct BookLayout {
+    std::vector<Order> orders;   // Resting orders, by id - 1
+    int levelsPerSide = 1;
+
+    explicit BookLayout(size_t depth) {
+        size_t perSide = std::max<size_t>(1, depth / 2);
+        levelsPerSide = std::max(1, static_cast<int>(std::lround(std::sqrt(static_cast<double>(perSide)))));
+        for (size_t i = 0; i < depth; ++i) {
+            Side side = i % 2 == 0 ? Side::BUY : Side::SELL;
+            orders.push_back(Order{1617278400000000000ULL + i, static_cast<int>(i + 1), INSTRUMENT, side,
+                                   Type::LIMIT, 100, levelPrice(side, static_cast<int>((i / 2) % static_cast<size_t>(levelsPerSide))),
+                                   Action::NEW});
+        }
+    }
+
+    float levelPrice(Side side, int level) const {
+        double price = side == Side::BUY ? BEST_BID - level * TICK : BEST_BID + TICK + level * TICK;
+        return static_cast<float>(price);
+    }
+};
+
+// ===== Opérations =====
+
+/**
+ * @brief Samples of one trial of an operation, in nanoseconds
+ */
+using Samples = std::vector<double>;
+
+/**
+ * @brief Options of the run
+ */
+struct MicrobenchOptions {
+    std::vector<size_t> depths = {10, 1000, 100000};
+    size_t samples = 20000;
+    size_t warmup = 2000;
+    size_t trials = 5;
+    int sweepLevels = 5;
+    uint32_t seed = 42;
+};
+
+// Ajoute un ordre sur un niveau existant, puis l'annule hors chronométrage
+static void benchAdd(const BookLayout& layout, const MicrobenchOptions& options, const OpTimer& timer,
+                     std::mt19937& random, Samples& samples) {
+    OrderBook book(INSTRUMENT);
+    for (const auto& order : layout.orders) {
+        book.addOrder(order);
+    }
+    std::uniform_int_distribution<int> level(0, layout.levelsPerSide - 1);
+    Order order{0, 0, INSTRUMENT, Side::BUY, Type::LIMIT, 100, 0.0f, Action::NEW};
+    int nextId = static_cast<int>(layout.orders.size()) + 1;
+    for (size_t i = 0; i < options.warmup + options.samples; ++i) {
+        order.order_id = nextId++;
+        order.side = i % 2 == 0 ? Side::BUY : Side::SELL;
+        order.price = layout.levelPrice(order.side, level(random));
+        uint64_t start = timer.now();
+        book.addOrder(order);
+        uint64_t end = timer.now();
+        book.cancelOrder(order.order_id);
+        if (i >= options.warmup) {
+            samples.push_back(timer.elapsedNs(start, end));
+        }
+    }
+}
+
+// Annule un ordre au repos, puis le remet dans le carnet hors chronométrage
+static void benchCancel(const BookLayout& layout, const MicrobenchOptions& options, const OpTimer& timer,
+                        std::mt19937& random, Samples& samples) {
+    OrderBook book(INSTRUMENT);
+    for (const auto& order : layout.orders) {
+        book.addOrder(order);
+    }
+    std::uniform_int_distribution<size_t> pick(0, layout.orders.size() - 1);
+    for (size_t i = 0; i < options.warmup + options.samples; ++i) {
+        const Order& order = layout.orders[pick(random)];
+        uint64_t start = timer.now();
+        bool canceled = book.cancelOrder(order.order_id);
+        uint64_t end = timer.now();
+        book.addOrder(order);
+        if (canceled && i >= options.warmup) {
+            samples.push_back(timer.elapsedNs(start, end));
+        }
+    }
+}
+
+// Déplace un ordre au repos vers un autre niveau de son côté
+static void benchModify(const BookLayout& layout, const MicrobenchOptions& options, const OpTimer& timer,
+                        std::mt19937& random, Samples& samples) {
+    OrderBook book(INSTRUMENT);
+    std::vector<Order> resting = layout.orders;
+    for (const auto& order : resting) {
+        book.addOrder(order);
+    }
+    std::uniform_int_distribution<size_t> pick(0, resting.size() - 1);
+    std::uniform_int_distribution<int> level(0, layout.levelsPerSide - 1);
+    for (size_t i = 0; i < options.warmup + options.samples; ++i) {
+        Order& order = resting[pick(random)];
+        order.price = layout.levelPrice(order.side, level(random));
+        order.action = Action::MODIFY;
+        uint64_t start = timer.now();
+        book.modifyOrder(order);
+        uint64_t end = timer.now();
+        if (i >= options.warmup) {
+            samples.push_back(timer.elapsedNs(start, end));
+        }
+    }
+}
+
+// Lit le meilleur prix et le premier ordre de chaque côté
+static void benchTop(const BookLayout& layout, const MicrobenchOptions& options, const OpTimer& timer,
+                     std::mt19937&, Samples& samples) {
+    OrderBook book(INSTRUMENT);
+    for (const auto& order : layout.orders) {
+        book.addOrder(order);
+    }
+    for (size_t i = 0; i < options.warmup + options.samples; ++i) {
+        uint64_t start = timer.now();
+        const auto& bid = *book.getBuySide().begin();
+        const auto& ask = *book.getSellSide().begin();
+        double spread = ask.first - bid.first + bid.second.front().quantity + ask.second.front().quantity;
+        uint64_t end = timer.now();
+        sink = spread;
+        if (i >= options.warmup) {
+            samples.push_back(timer.elapsedNs(start, end));
+        }
+    }
+}
+
+// Traite un ordre au marché qui prend les N premiers niveaux vendeurs
+static void benchSweep(const BookLayout& layout, const MicrobenchOptions& options, const OpTimer& timer,
+                       std::mt19937&, Samples& samples) {
+    MatchingEngine engine;
+    for (const auto& order : layout.orders) {
+        engine.processOrder(order);
+    }
+    // Le moteur ne retire pas du carnet les ordres exécutés, le balayage se répète à l'identique
+    const OrderBook& book = *engine.getOrderBook(INSTRUMENT);
+    int quantity = 0;
+    int levels = 0;
+    for (const auto& [price, orders] : book.getSellSide()) {
+        if (levels++ == options.sweepLevels) {
+            break;
+        }
+        for (const auto& order : orders) {
+            quantity += order.quantity;
+        }
+    }
+    Order sweep{0, 0, INSTRUMENT, Side::BUY, Type::MARKET, quantity, 0.0f, Action::NEW};
+    int nextId = static_cast<int>(layout.orders.size()) + 1;
+    for (size_t i = 0; i < options.warmup + options.samples; ++i) {
+        sweep.order_id = nextId++;
+        uint64_t start = timer.now();
+        std::vector<OrderResult> results = engine.processOrder(sweep);
+        uint64_t end = timer.now();
+        sink = static_cast<double>(results.size());
+        if (i >= options.warmup) {
+            samples.push_back(timer.elapsedNs(start, end));
+        }
+    }
+}
+
+/**
+ * @brief An operation under test
+ */
+struct Operation {
+    const char* name;
+    std::function<void(const BookLayout&, const MicrobenchOptions&, const OpTimer&, std::mt19937&, Samples&)> run;
+};
+
+// Fixe le thread courant sur un CPU
+static bool pinToCpu(int cpu) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+}
+
+// Découpe une liste de nombres séparés par des virgules
+static std::vector<size_t> parseList(const std::string& list) {
+    std::vector<size_t> values;
+    size_t begin = 0;
+    while (begin <= list.size()) {
+        size_t end = list.find(',', begin);
+        if (end == std::string::npos) {
+            end = list.size();
+        }
+        if (end > begin) {
+            values.push_back(std::stoull(list.substr(begin, end - begin)));
+        }
+        begin = end + 1;
+    }
+    return values;
+}
+
+int main(int argc, char* argv[]) {
+    const char* usage = " [--depths <n>[,<n>...]] [--samples <n>] [--warmup <n>] [--trials <n>]"
+                        " [--sweep-levels <n>] [--cpu <n>] [--timer tsc|clock] [--seed <n>]"
+                        " [--report <file.json|file.csv>]";
+    MicrobenchOptions options;
+    int cpu = sched_getcpu();
+    bool useTsc = true;
+    std::string reportFile;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--depths" && i + 1 < argc) {
+            options.depths = parseList(argv[++i]);
+        } else if (arg == "--samples" && i + 1 < argc) {
+            options.samples = std::max<size_t>(1, std::stoull(argv[++i]));
+        } else if (arg == "--warmup" && i + 1 < argc) {
+            options.warmup = std::stoull(argv[++i]);
+        } else if (arg == "--trials" && i + 1 < argc) {
+            options.trials = std::max<size_t>(1, std::stoull(argv[++i]));
+        } else if (arg == "--sweep-levels" && i + 1 < argc) {
+            options.sweepLevels = std::max(1, std::stoi(argv[++i]));
+        } else if (arg == "--cpu" && i + 1 < argc) {
+            cpu = std::stoi(argv[++i]);
+        } else if (arg == "--timer" && i + 1 < argc) {
+            std::string timer = argv[++i];
+            if (timer != "tsc" && timer != "clock") {
+                std::cerr << "Unknown timer: " << timer << std::endl;
+                return 1;
+            }
+            useTsc = timer == "tsc";
+        } else if (arg == "--seed" && i + 1 < argc) {
+            options.seed = static_cast<uint32_t>(std::stoul(argv[++i]));
+        } else if (arg == "--report" && i + 1 < argc) {
+            reportFile = argv[++i];
+        } else {
+            std::cerr << "Usage: " << argv[0] << usage << std::endl;
+            return 1;
+        }
+    }
+
+    // Un CPU négatif laisse l'ordonnanceur placer le thread
+    if (cpu >= 0 && !pinToCpu(cpu)) {
+        std::cerr << "Erreur : impossible de fixer le thread sur le CPU " << cpu << std::endl;
+        cpu = -1;
+    }
+    OpTimer timer(useTsc);
+
+    std::cout << "=== Order Book Microbenchmarks ===" << std::endl;
+    std::cout << "Timer: " << (timer.usesTsc() ? "TSC" : "steady_clock");
+    if (timer.usesTsc()) {
+        std::cout << " (" << timer.ticksPerNs() << " ticks/ns)";
+    }
+    std::cout << ", CPU " << (cpu >= 0 ? std::to_string(cpu) : std::string("not pinned"))
+              << ", " << options.trials << " trials of " << options.samples << " samples after "
+              << options.warmup << " warmup operations" << std::endl;
+
+    BenchReport report;
+    report.addSystemMetadata();
+    report.setMetadata("seed", std::to_string(options.seed));
+    report.setMetadata("timer", timer.usesTsc() ? "tsc" : "clock");
+    report.setMetadata("pinned_cpu", std::to_string(cpu));
+    report.setMetadata("samples", std::to_string(options.samples));
+    report.setMetadata("warmup", std::to_string(options.warmup));
+    report.setMetadata("trials", std::to_string(options.trials));
+
+    const std::vector<Operation> operations = {
+        {"add", benchAdd},
+        {"cancel", benchCancel},
+        {"modify", benchModify},
+        {"top", benchTop},
+        {"sweep", benchSweep},
+    };
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "\n" << std::left << std::setw(10) << "operation" << std::right << std::setw(10) << "depth"
+              << std::setw(12) << "median ns" << std::setw(12) << "p99 ns" << std::setw(24) << "trial medians" << std::endl;
+    for (size_t depth : options.depths) {
+        BookLayout layout(std::max<size_t>(depth, 2));
+        for (const auto& operation : operations) {
+            std::mt19937 random(options.seed);
+            std::string label = operation.name;
+            if (label == "sweep") {
+                label += std::to_string(std::min(options.sweepLevels, layout.levelsPerSide));
+            }
+            std::string name = label + "/" + std::to_string(layout.orders.size());
+            std::vector<double> medians;
+            std::vector<double> p99s;
+            Samples samples;
+            for (size_t trial = 0; trial < options.trials; ++trial) {
+                samples.clear();
+                samples.reserve(options.samples);
+                operation.run(layout, options, timer, random, samples);
+                std::sort(samples.begin(), samples.end());
+                medians.push_back(percentile(samples, 0.50));
+                p99s.push_back(percentile(samples, 0.99));
+                report.add(name, "median", "ns", false, medians.back());
+                report.add(name, "p99", "ns", false, p99s.back());
+            }
+            std::sort(medians.begin(), medians.end());
+            std::sort(p99s.begin(), p99s.end());
+            std::cout << std::left << std::setw(10) << label << std::right << std::setw(10) << layout.orders.size()
+                      << std::setw(12) << percentile(medians, 0.50) << std::setw(12) << percentile(p99s, 0.50)
+                      << std::setw(12) << medians.front() << " .. " << std::left << medians.back() << std::right << std::endl;
+        }
+    }
+
+    if (!reportFile.empty()) {
+        if (!report.write(reportFile)) {
+            return 1;
+        }
+        std::cout << "\nReport written to " << reportFile << std::endl;
+    }
+    return 0;
+}
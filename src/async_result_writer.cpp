@@ -0,0 +1,138 @@
+/**
+ * @file async_result_writer.cpp
+ * @brief Implementation of the AsyncResultWriter class.
+ */
+
+#include "async_result_writer.hpp"
+#include <algorithm>
+
+AsyncResultWriter::AsyncResultWriter(ResultWriter& sink, size_t bufferCapacity, Backpressure policy)
+    : sink_(sink), capacity_(std::max<size_t>(1, bufferCapacity)), policy_(policy),
+      pending_(false), written_(0), dropped_(0) {
+    front_.reserve(capacity_);
+    back_.reserve(capacity_);
+    thread_ = std::thread(&AsyncResultWriter::run, this);
+}
+
+AsyncResultWriter::~AsyncResultWriter() {
+    close();
+}
+
+/**
+ * @brief Appends a result to the front buffer.
+ *
+ * A full front buffer is swapped with the back buffer. If the writer thread still owns
+ * the back buffer, the BLOCK policy waits for it while the DROP policy discards the
+ * result without waiting.
+ */
+void AsyncResultWriter::writeOrderResult(const OrderResult& result) {
+    if (front_.size() >= capacity_) {
+        if (policy_ == Backpressure::DROP && pending_.load(std::memory_order_acquire)) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        handOff();
+    }
+    front_.push_back(result);
+}
+
+/**
+ * @brief Swaps the front and back buffers and wakes the writer thread.
+ */
+void AsyncResultWriter::handOff() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    released_.wait(lock, [this] { return !pending_.load(std::memory_order_relaxed); });
+    front_.swap(back_);
+    pending_.store(true, std::memory_order_release);
+    ready_.notify_one();
+}
+
+/**
+ * @brief Hands over the partially filled front buffer and waits until it is written.
+ *
+ * The sink is then flushed by the writer thread too, so that it is only ever called
+ * from that thread.
+ */
+void AsyncResultWriter::flush() {
+    if (!thread_.joinable()) {
+        return;
+    }
+    if (!front_.empty()) {
+        handOff();
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    released_.wait(lock, [this] { return !pending_.load(std::memory_order_relaxed); });
+    flushRequested_ = true;
+    ready_.notify_one();
+    released_.wait(lock, [this] { return !flushRequested_; });
+}
+
+/**
+ * @brief Writes out everything still buffered, then joins the writer thread.
+ */
+void AsyncResultWriter::close() {
+    if (!thread_.joinable()) {
+        return;
+    }
+    flush();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    ready_.notify_one();
+    thread_.join();
+}
+
+size_t AsyncResultWriter::writtenCount() const {
+    return written_.load(std::memory_order_relaxed);
+}
+
+size_t AsyncResultWriter::droppedCount() const {
+    return dropped_.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Writes each back buffer handed over by the matching thread, and flushes the sink on request.
+ *
+ * The back buffer is written without holding the lock: the matching thread does not
+ * touch it until it is released.
+ */
+void AsyncResultWriter::run() {
+    while (true) {
+        bool write = false;
+        bool flush = false;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            ready_.wait(lock, [this] {
+                return stop_ || flushRequested_ || pending_.load(std::memory_order_relaxed);
+            });
+            write = pending_.load(std::memory_order_relaxed);
+            flush = flushRequested_;
+            if (!write && !flush) {
+                return;
+            }
+        }
+
+        if (write) {
+            for (const auto& result : back_) {
+                sink_.writeOrderResult(result);
+            }
+            written_.fetch_add(back_.size(), std::memory_order_relaxed);
+            back_.clear();
+        }
+        if (flush) {
+            sink_.flush();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (write) {
+                pending_.store(false, std::memory_order_release);
+            }
+            if (flush) {
+                flushRequested_ = false;
+            }
+        }
+        released_.notify_one();
+    }
+}
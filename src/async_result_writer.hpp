@@ -0,0 +1,106 @@
+/**
+ * @file async_result_writer.hpp
+ * @brief Defines the AsyncResultWriter class that moves result output off the matching thread.
+ *
+ * Results are appended to a front buffer owned by the matching thread. When it fills up
+ * it is swapped with the back buffer, which a dedicated writer thread formats and writes
+ * to the underlying ResultWriter. Matching only waits on the writer thread if the back
+ * buffer is still being written when the front one fills up, and never if the drop
+ * policy is selected.
+ */
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "result_writer.hpp"
+
+/**
+ * @enum Backpressure
+ * @brief What to do with a result when both buffers are full
+ */
+enum class Backpressure {
+    BLOCK,  // Wait for the writer thread to release the back buffer
+    DROP    // Discard the result and count it
+};
+
+/**
+ * @class AsyncResultWriter
+ * @brief Double-buffered ResultWriter that writes to another ResultWriter on its own thread.
+ *
+ * writeOrderResult() and flush() must be called from a single thread. The sink is only
+ * called from the writer thread, including its flush().
+ */
+class AsyncResultWriter : public ResultWriter {
+public:
+    /**
+     * @brief Starts the writer thread.
+     * @param sink The writer that receives the results on the writer thread.
+     * @param bufferCapacity Number of results held by each of the two buffers.
+     * @param policy Behavior when both buffers are full.
+     */
+    explicit AsyncResultWriter(ResultWriter& sink, size_t bufferCapacity = 8192,
+                               Backpressure policy = Backpressure::BLOCK);
+
+    /**
+     * @brief Destructor that drains the buffers and stops the writer thread.
+     */
+    ~AsyncResultWriter() override;
+
+    AsyncResultWriter(const AsyncResultWriter&) = delete;
+    AsyncResultWriter& operator=(const AsyncResultWriter&) = delete;
+
+    /**
+     * @brief Queues an order result for the writer thread.
+     * @param result The OrderResult to write.
+     */
+    void writeOrderResult(const OrderResult& result) override;
+
+    /**
+     * @brief Waits until every queued result is written and the writer thread has flushed the sink.
+     */
+    void flush() override;
+
+    /**
+     * @brief Drains the buffers and stops the writer thread.
+     */
+    void close();
+
+    /**
+     * @brief Number of results handed to the sink.
+     */
+    size_t writtenCount() const;
+
+    /**
+     * @brief Number of results discarded by the drop policy.
+     */
+    size_t droppedCount() const;
+
+private:
+    /**
+     * @brief Hands the front buffer to the writer thread, waiting for the back buffer if needed.
+     */
+    void handOff();
+
+    /**
+     * @brief Writer thread loop.
+     */
+    void run();
+
+    ResultWriter& sink_;                  ///< Destination of the results
+    size_t capacity_;                     ///< Capacity of each buffer
+    Backpressure policy_;                 ///< Behavior when both buffers are full
+    std::vector<OrderResult> front_;      ///< Filled by the matching thread
+    std::vector<OrderResult> back_;       ///< Written by the writer thread
+    std::mutex mutex_;                    ///< Protects the buffer swap
+    std::condition_variable ready_;       ///< Signals a back buffer to write or a stop
+    std::condition_variable released_;    ///< Signals that the back buffer is free
+    std::atomic<bool> pending_;           ///< True while the back buffer is being written
+    bool flushRequested_ = false;         ///< Asks the writer thread to flush the sink
+    bool stop_ = false;                   ///< Asks the writer thread to exit
+    std::atomic<size_t> written_;         ///< Results handed to the sink
+    std::atomic<size_t> dropped_;         ///< Results discarded
+    std::thread thread_;                  ///< The writer thread
+};
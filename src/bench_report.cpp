@@ -0,0 +1,558 @@
+/**
+ * @file bench_report.cpp
+ * @brief Implementation of benchmark reports, their file formats and their comparison.
+ */
+
+#include "bench_report.hpp"
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+// Revision and compiler flags, provided by the Makefile
+#ifndef BENCH_GIT_REVISION
+#define BENCH_GIT_REVISION "unknown"
+#endif
+#ifndef BENCH_CXXFLAGS
+#define BENCH_CXXFLAGS "unknown"
+#endif
+
+void BenchReport::setMetadata(const std::string& key, const std::string& value) {
+    for (auto& entry : metadata_) {
+        if (entry.first == key) {
+            entry.second = value;
+            return;
+        }
+    }
+    metadata_.emplace_back(key, value);
+}
+
+std::string BenchReport::metadata(const std::string& key) const {
+    for (const auto& entry : metadata_) {
+        if (entry.first == key) {
+            return entry.second;
+        }
+    }
+    return std::string();
+}
+
+/**
+ * @brief Reads the CPU model from /proc/cpuinfo.
+ */
+static std::string cpuModel() {
+    std::ifstream file("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.rfind("model name", 0) == 0) {
+            size_t colon = line.find(':');
+            if (colon != std::string::npos) {
+                size_t begin = line.find_first_not_of(' ', colon + 1);
+                return begin == std::string::npos ? std::string() : line.substr(begin);
+            }
+        }
+    }
+    return "unknown";
+}
+
+void BenchReport::addSystemMetadata() {
+    setMetadata("git_revision", BENCH_GIT_REVISION);
+#if defined(__clang__)
+    setMetadata("compiler", "clang " __clang_version__);
+#elif defined(__GNUC__)
+    setMetadata("compiler", "g++ " __VERSION__);
+#else
+    setMetadata("compiler", "unknown");
+#endif
+    setMetadata("flags", BENCH_CXXFLAGS);
+    setMetadata("cpu", cpuModel());
+    setMetadata("hardware_threads", std::to_string(std::thread::hardware_concurrency()));
+
+    std::time_t now = std::time(nullptr);
+    std::tm utc{};
+    gmtime_r(&now, &utc);
+    char date[32];
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", &utc);
+    setMetadata("date", date);
+}
+
+void BenchReport::add(const std::string& name, const std::string& metric, const std::string& unit,
+                      bool higherIsBetter, double value) {
+    for (auto& existing : metrics_) {
+        if (existing.name == name && existing.metric == metric) {
+            existing.samples.push_back(value);
+            return;
+        }
+    }
+    metrics_.push_back(BenchMetric{name, metric, unit, higherIsBetter, {value}});
+}
+
+const BenchMetric* BenchReport::find(const std::string& name, const std::string& metric) const {
+    for (const auto& existing : metrics_) {
+        if (existing.name == name && existing.metric == metric) {
+            return &existing;
+        }
+    }
+    return nullptr;
+}
+
+// ===== Writing =====
+
+/**
+ * @brief Shortest text that reads back to the same double.
+ */
+static std::string formatNumber(double value) {
+    if (!std::isfinite(value)) {
+        return "0";
+    }
+    char buffer[32];
+    auto [end, error] = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    return std::string(buffer, end);
+}
+
+static std::string jsonString(const std::string& text) {
+    std::string quoted = "\"";
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            quoted += '\\';
+            quoted += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char escape[8];
+            std::snprintf(escape, sizeof(escape), "\\u%04x", static_cast<unsigned>(c));
+            quoted += escape;
+        } else {
+            quoted += c;
+        }
+    }
+    return quoted + "\"";
+}
+
+static bool endsWith(const std::string& text, const std::string& suffix) {
+    return text.size() >= suffix.size() && text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+bool BenchReport::write(const std::string& filename) const {
+    std::ofstream file(filename);
+    if (!file) {
+        std::cerr << "Erreur : impossible de créer le rapport " << filename << std::endl;
+        return false;
+    }
+
+    if (endsWith(filename, ".csv")) {
+        for (const auto& [key, value] : metadata_) {
+            file << "# " << key << ": " << value << '\n';
+        }
+        file << "case,metric,unit,better,trial,value\n";
+        for (const auto& metric : metrics_) {
+            for (size_t i = 0; i < metric.samples.size(); ++i) {
+                file << metric.name << ',' << metric.metric << ',' << metric.unit << ','
+                     << (metric.higherIsBetter ? "higher" : "lower") << ',' << i << ','
+                     << formatNumber(metric.samples[i]) << '\n';
+            }
+        }
+        return static_cast<bool>(file);
+    }
+
+    file << "{\n  \"metadata\": {";
+    for (size_t i = 0; i < metadata_.size(); ++i) {
+        file << (i == 0 ? "\n" : ",\n") << "    " << jsonString(metadata_[i].first) << ": " << jsonString(metadata_[i].second);
+    }
+    file << "\n  },\n  \"results\": [";
+    for (size_t i = 0; i < metrics_.size(); ++i) {
+        const BenchMetric& metric = metrics_[i];
+        file << (i == 0 ? "\n" : ",\n") << "    {\"case\": " << jsonString(metric.name)
+             << ", \"metric\": " << jsonString(metric.metric) << ", \"unit\": " << jsonString(metric.unit)
+             << ", \"better\": \"" << (metric.higherIsBetter ? "higher" : "lower") << "\", \"samples\": [";
+        for (size_t s = 0; s < metric.samples.size(); ++s) {
+            file << (s == 0 ? "" : ", ") << formatNumber(metric.samples[s]);
+        }
+        file << "]}";
+    }
+    file << "\n  ]\n}\n";
+    return static_cast<bool>(file);
+}
+
+// ===== Reading =====
+
+namespace {
+
+/**
+ * @brief A parsed JSON value; only what reports use
+ */
+struct JsonValue {
+    enum class Kind { NUL, BOOLEAN, NUMBER, STRING, ARRAY, OBJECT } kind = Kind::NUL;
+    double number = 0.0;
+    std::string text;
+    std::vector<JsonValue> items;
+    std::vector<std::pair<std::string, JsonValue>> members;
+
+    const JsonValue* member(const std::string& key) const {
+        for (const auto& entry : members) {
+            if (entry.first == key) {
+                return &entry.second;
+            }
+        }
+        return nullptr;
+    }
+};
+
+/**
+ * @brief Recursive-descent JSON parser over a string
+ */
+class JsonParser {
+public:
+    explicit JsonParser(const std::string& text) : text_(text) {}
+
+    bool parse(JsonValue& value) {
+        if (!parseValue(value)) {
+            return false;
+        }
+        skipSpace();
+        return pos_ == text_.size();
+    }
+
+private:
+    void skipSpace() {
+        while (pos_ < text_.size() && std::isspace(static_cast<unsigned char>(text_[pos_]))) {
+            ++pos_;
+        }
+    }
+
+    bool consume(char c) {
+        skipSpace();
+        if (pos_ < text_.size() && text_[pos_] == c) {
+            ++pos_;
+            return true;
+        }
+        return false;
+    }
+
+    bool parseValue(JsonValue& value) {
+        skipSpace();
+        if (pos_ >= text_.size()) {
+            return false;
+        }
+        char c = text_[pos_];
+        if (c == '{') {
+            return parseObject(value);
+        }
+        if (c == '[') {
+            return parseArray(value);
+        }
+        if (c == '"') {
+            value.kind = JsonValue::Kind::STRING;
+            return parseString(value.text);
+        }
+        for (const char* word : {"true", "false", "null"}) {
+            if (text_.compare(pos_, std::strlen(word), word) == 0) {
+                pos_ += std::strlen(word);
+                value.kind = word[0] == 'n' ? JsonValue::Kind::NUL : JsonValue::Kind::BOOLEAN;
+                value.number = word[0] == 't' ? 1.0 : 0.0;
+                return true;
+            }
+        }
+        const char* begin = text_.data() + pos_;
+        auto [end, error] = std::from_chars(begin, text_.data() + text_.size(), value.number);
+        if (error != std::errc()) {
+            return false;
+        }
+        value.kind = JsonValue::Kind::NUMBER;
+        pos_ += static_cast<size_t>(end - begin);
+        return true;
+    }
+
+    bool parseString(std::string& out) {
+        ++pos_;  // Guillemet ouvrant
+        while (pos_ < text_.size() && text_[pos_] != '"') {
+            char c = text_[pos_++];
+            if (c != '\\') {
+                out += c;
+                continue;
+            }
+            if (pos_ >= text_.size()) {
+                return false;
+            }
+            char escaped = text_[pos_++];
+            switch (escaped) {
+                case 'n': out += '\n'; break;
+                case 't': out += '\t'; break;
+                case 'r': out += '\r'; break;
+                case 'b': out += '\b'; break;
+                case 'f': out += '\f'; break;
+                case 'u': {
+                    if (pos_ + 4 > text_.size()) {
+                        return false;
+                    }
+                    unsigned code = static_cast<unsigned>(std::stoul(text_.substr(pos_, 4), nullptr, 16));
+                    pos_ += 4;
+                    // Reports only escape ASCII control characters
+                    out += static_cast<char>(code < 0x80 ? code : '?');
+                    break;
+                }
+                default: out += escaped; break;
+            }
+        }
+        return consume('"');
+    }
+
+    bool parseArray(JsonValue& value) {
+        value.kind = JsonValue::Kind::ARRAY;
+        ++pos_;
+        if (consume(']')) {
+            return true;
+        }
+        do {
+            value.items.emplace_back();
+            if (!parseValue(value.items.back())) {
+                return false;
+            }
+        } while (consume(','));
+        return consume(']');
+    }
+
+    bool parseObject(JsonValue& value) {
+        value.kind = JsonValue::Kind::OBJECT;
+        ++pos_;
+        if (consume('}')) {
+            return true;
+        }
+        do {
+            skipSpace();
+            std::string key;
+            if (pos_ >= text_.size() || text_[pos_] != '"' || !parseString(key) || !consume(':')) {
+                return false;
+            }
+            value.members.emplace_back(std::move(key), JsonValue());
+            if (!parseValue(value.members.back().second)) {
+                return false;
+            }
+        } while (consume(','));
+        return consume('}');
+    }
+
+    const std::string& text_;
+    size_t pos_ = 0;
+};
+
+}  // namespace
+
+static bool readJson(const std::string& text, BenchReport& report) {
+    JsonValue root;
+    if (!JsonParser(text).parse(root) || root.kind != JsonValue::Kind::OBJECT) {
+        return false;
+    }
+    if (const JsonValue* metadata = root.member("metadata")) {
+        for (const auto& [key, value] : metadata->members) {
+            report.setMetadata(key, value.text);
+        }
+    }
+    const JsonValue* results = root.member("results");
+    if (results == nullptr || results->kind != JsonValue::Kind::ARRAY) {
+        return false;
+    }
+    for (const auto& result : results->items) {
+        const JsonValue* name = result.member("case");
+        const JsonValue* metric = result.member("metric");
+        const JsonValue* unit = result.member("unit");
+        const JsonValue* better = result.member("better");
+        const JsonValue* samples = result.member("samples");
+        if (name == nullptr || metric == nullptr || samples == nullptr || samples->kind != JsonValue::Kind::ARRAY) {
+            return false;
+        }
+        bool higher = better != nullptr && better->text == "higher";
+        for (const auto& sample : samples->items) {
+            report.add(name->text, metric->text, unit ? unit->text : std::string(), higher, sample.number);
+        }
+    }
+    return true;
+}
+
+static bool readCsv(std::istream& in, BenchReport& report) {
+    std::string line;
+    bool header = false;
+    while (std::getline(in, line)) {
+        if (line.empty()) {
+            continue;
+        }
+        if (line.rfind("# ", 0) == 0) {
+            size_t colon = line.find(": ");
+            if (colon != std::string::npos) {
+                report.setMetadata(line.substr(2, colon - 2), line.substr(colon + 2));
+            }
+            continue;
+        }
+        if (!header) {
+            header = true;
+            continue;
+        }
+        std::stringstream ss(line);
+        std::string name, metric, unit, better, trial, value;
+        std::getline(ss, name, ',');
+        std::getline(ss, metric, ',');
+        std::getline(ss, unit, ',');
+        std::getline(ss, better, ',');
+        std::getline(ss, trial, ',');
+        std::getline(ss, value, ',');
+        try {
+            report.add(name, metric, unit, better == "higher", std::stod(value));
+        } catch (const std::exception&) {
+            return false;
+        }
+    }
+    return header;
+}
+
+bool BenchReport::read(const std::string& filename, BenchReport& report) {
+    std::ifstream file(filename);
+    if (!file) {
+        std::cerr << "Erreur : impossible d'ouvrir le rapport " << filename << std::endl;
+        return false;
+    }
+    std::stringstream contents;
+    contents << file.rdbuf();
+    std::string text = contents.str();
+
+    size_t first = text.find_first_not_of(" \t\r\n");
+    bool ok = first != std::string::npos && text[first] == '{' ? readJson(text, report) : readCsv(contents, report);
+    if (!ok) {
+        std::cerr << "Erreur : rapport invalide " << filename << std::endl;
+    }
+    return ok;
+}
+
+// ===== Comparison =====
+
+/**
+ * @brief Continued fraction of the regularized incomplete beta function (modified Lentz).
+ */
+static double betaContinuedFraction(double a, double b, double x) {
+    const double tiny = 1e-300;
+    double qab = a + b;
+    double qap = a + 1.0;
+    double qam = a - 1.0;
+    double c = 1.0;
+    double d = 1.0 - qab * x / qap;
+    d = 1.0 / (std::fabs(d) < tiny ? tiny : d);
+    double h = d;
+    for (int m = 1; m <= 300; ++m) {
+        double m2 = 2.0 * m;
+        double aa = m * (b - m) * x / ((qam + m2) * (a + m2));
+        d = 1.0 + aa * d;
+        d = 1.0 / (std::fabs(d) < tiny ? tiny : d);
+        c = 1.0 + aa / c;
+        c = std::fabs(c) < tiny ? tiny : c;
+        h *= d * c;
+        aa = -(a + m) * (qab + m) * x / ((a + m2) * (qap + m2));
+        d = 1.0 + aa * d;
+        d = 1.0 / (std::fabs(d) < tiny ? tiny : d);
+        c = 1.0 + aa / c;
+        c = std::fabs(c) < tiny ? tiny : c;
+        double delta = d * c;
+        h *= delta;
+        if (std::fabs(delta - 1.0) < 1e-15) {
+            break;
+        }
+    }
+    return h;
+}
+
+/**
+ * @brief Regularized incomplete beta function I_x(a, b).
+ */
+static double incompleteBeta(double a, double b, double x) {
+    if (x <= 0.0) {
+        return 0.0;
+    }
+    if (x >= 1.0) {
+        return 1.0;
+    }
+    double front = std::exp(std::lgamma(a + b) - std::lgamma(a) - std::lgamma(b)
+                            + a * std::log(x) + b * std::log(1.0 - x));
+    if (x < (a + 1.0) / (a + b + 2.0)) {
+        return front * betaContinuedFraction(a, b, x) / a;
+    }
+    return 1.0 - front * betaContinuedFraction(b, a, 1.0 - x) / b;
+}
+
+static void meanAndVariance(const std::vector<double>& samples, double& mean, double& variance) {
+    mean = 0.0;
+    for (double sample : samples) {
+        mean += sample;
+    }
+    mean /= static_cast<double>(samples.size());
+    variance = 0.0;
+    for (double sample : samples) {
+        variance += (sample - mean) * (sample - mean);
+    }
+    variance = samples.size() > 1 ? variance / static_cast<double>(samples.size() - 1) : 0.0;
+}
+
+/**
+ * @brief The two-sided p-value of Student's t distribution is I_{df/(df+t^2)}(df/2, 1/2).
+ */
+WelchTest welchTTest(const std::vector<double>& a, const std::vector<double>& b) {
+    WelchTest test;
+    if (a.size() < 2 || b.size() < 2) {
+        return test;
+    }
+    double meanA, varA, meanB, varB;
+    meanAndVariance(a, meanA, varA);
+    meanAndVariance(b, meanB, varB);
+    double se2A = varA / static_cast<double>(a.size());
+    double se2B = varB / static_cast<double>(b.size());
+    double se2 = se2A + se2B;
+    if (se2 <= 0.0) {
+        test.pValue = meanA == meanB ? 1.0 : 0.0;
+        return test;
+    }
+    test.t = (meanA - meanB) / std::sqrt(se2);
+    test.df = se2 * se2 / (se2A * se2A / static_cast<double>(a.size() - 1) + se2B * se2B / static_cast<double>(b.size() - 1));
+    test.pValue = incompleteBeta(test.df / 2.0, 0.5, test.df / (test.df + test.t * test.t));
+    return test;
+}
+
+std::vector<BenchComparison> compareReports(const BenchReport& base, const BenchReport& current,
+                                            double alpha, double minChange) {
+    std::vector<BenchComparison> comparisons;
+    for (const auto& metric : current.metrics()) {
+        const BenchMetric* reference = base.find(metric.name, metric.metric);
+        if (reference == nullptr || reference->samples.empty() || metric.samples.empty()) {
+            continue;
+        }
+        BenchComparison comparison;
+        comparison.name = metric.name;
+        comparison.metric = metric.metric;
+        comparison.unit = metric.unit;
+        double variance;
+        meanAndVariance(reference->samples, comparison.baseMean, variance);
+        meanAndVariance(metric.samples, comparison.currentMean, variance);
+        comparison.change = comparison.baseMean != 0.0
+                                ? (comparison.currentMean - comparison.baseMean) / std::fabs(comparison.baseMean) : 0.0;
+
+        if (reference->samples.size() < 2 || metric.samples.size() < 2) {
+            comparison.verdict = BenchVerdict::UNTESTED;
+        } else {
+            comparison.pValue = welchTTest(reference->samples, metric.samples).pValue;
+            bool better = metric.higherIsBetter ? comparison.change > 0.0 : comparison.change < 0.0;
+            if (comparison.pValue < alpha && std::fabs(comparison.change) >= minChange) {
+                comparison.verdict = better ? BenchVerdict::IMPROVED : BenchVerdict::REGRESSED;
+            }
+        }
+        comparisons.push_back(comparison);
+    }
+    return comparisons;
+}
+
+const char* verdictName(BenchVerdict verdict) {
+    switch (verdict) {
+        case BenchVerdict::IMPROVED: return "IMPROVED";
+        case BenchVerdict::REGRESSED: return "REGRESSED";
+        case BenchVerdict::UNTESTED: return "UNTESTED";
+        default: return "UNCHANGED";
+    }
+}
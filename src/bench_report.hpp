@@ -0,0 +1,150 @@
+/**
+ * @file bench_report.hpp
+ * @brief Defines BenchReport, the machine-readable results of a benchmark run, and their comparison.
+ *
+ * A report holds the metadata of the run (git revision, compiler and flags, CPU, workload
+ * seed, ...) and a list of metrics. Each metric keeps one sample per trial, so that two
+ * reports can be compared with a statistical test rather than by eye: compareReports()
+ * runs Welch's t-test on every metric present in both reports and flags the changes that
+ * are both significant and larger than a minimum relative change.
+ *
+ * Reports are written as JSON, or as CSV when the file name ends in ".csv":
+ *
+ *     {"metadata": {"git_revision": "...", ...},
+ *      "results": [{"case": "engine/100000", "metric": "throughput", "unit": "orders/s",
+ *                   "better": "higher", "samples": [2551000, 2498000, 2530000]}, ...]}
+ *
+ *     # git_revision: ...
+ *     case,metric,unit,better,trial,value
+ *     engine/100000,throughput,orders/s,higher,0,2551000
+ */
+#pragma once
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @struct BenchMetric
+ * @brief Samples of one metric of one benchmark case, one per trial
+ */
+struct BenchMetric {
+    std::string name;              // Benchmark case, e.g. "engine/100000"
+    std::string metric;            // Measured quantity, e.g. "p99"
+    std::string unit;              // Unit of the samples, e.g. "ns"
+    bool higherIsBetter = false;   // Direction of an improvement
+    std::vector<double> samples;   // One value per trial
+};
+
+/**
+ * @class BenchReport
+ * @brief Metadata and metrics of a benchmark run
+ */
+class BenchReport {
+public:
+    /**
+     * @brief Sets a metadata entry, replacing any previous value
+     */
+    void setMetadata(const std::string& key, const std::string& value);
+
+    /**
+     * @brief Value of a metadata entry, empty if absent
+     */
+    std::string metadata(const std::string& key) const;
+
+    /**
+     * @brief Adds the build and machine metadata: git revision, compiler, flags, CPU model,
+     * hardware threads and the date of the run
+     */
+    void addSystemMetadata();
+
+    /**
+     * @brief Appends a trial sample to a metric, creating the metric on first use
+     */
+    void add(const std::string& name, const std::string& metric, const std::string& unit,
+             bool higherIsBetter, double value);
+
+    /**
+     * @brief Finds a metric
+     * @return const BenchMetric* Pointer to the metric, nullptr if absent
+     */
+    const BenchMetric* find(const std::string& name, const std::string& metric) const;
+
+    const std::vector<std::pair<std::string, std::string>>& metadataEntries() const { return metadata_; }
+    const std::vector<BenchMetric>& metrics() const { return metrics_; }
+
+    /**
+     * @brief Writes the report as CSV if the file name ends in ".csv", as JSON otherwise
+     * @return bool False if the file cannot be written
+     */
+    bool write(const std::string& filename) const;
+
+    /**
+     * @brief Reads a report written by write(), in either format
+     * @return bool False if the file cannot be opened or is malformed
+     */
+    static bool read(const std::string& filename, BenchReport& report);
+
+private:
+    std::vector<std::pair<std::string, std::string>> metadata_;  ///< In insertion order
+    std::vector<BenchMetric> metrics_;                           ///< In insertion order
+};
+
+/**
+ * @struct WelchTest
+ * @brief Outcome of Welch's unequal-variance t-test
+ */
+struct WelchTest {
+    double t = 0.0;        // Test statistic
+    double df = 0.0;       // Welch-Satterthwaite degrees of freedom
+    double pValue = 1.0;   // Two-sided p-value
+};
+
+/**
+ * @brief Runs Welch's t-test on two sets of samples
+ *
+ * Both sets need at least two samples; otherwise the p-value is 1. Two sets without any
+ * variance give a p-value of 0 if their means differ.
+ */
+WelchTest welchTTest(const std::vector<double>& a, const std::vector<double>& b);
+
+/**
+ * @brief Verdict on a metric of two reports
+ */
+enum class BenchVerdict {
+    UNCHANGED,   // Not significant, or smaller than the minimum change
+    IMPROVED,    // Significantly better
+    REGRESSED,   // Significantly worse
+    UNTESTED     // Fewer than two samples in a report; only the change is reported
+};
+
+/**
+ * @struct BenchComparison
+ * @brief Comparison of one metric present in two reports
+ */
+struct BenchComparison {
+    std::string name;
+    std::string metric;
+    std::string unit;
+    double baseMean = 0.0;
+    double currentMean = 0.0;
+    double change = 0.0;       // (current - base) / base
+    double pValue = 1.0;
+    BenchVerdict verdict = BenchVerdict::UNCHANGED;
+};
+
+/**
+ * @brief Compares every metric present in both reports
+ *
+ * @param base The reference report
+ * @param current The report under evaluation
+ * @param alpha Significance level of the t-test
+ * @param minChange Smallest relative change flagged, e.g. 0.02 for 2%
+ * @return std::vector<BenchComparison> One entry per common metric, in the order of current
+ */
+std::vector<BenchComparison> compareReports(const BenchReport& base, const BenchReport& current,
+                                            double alpha = 0.05, double minChange = 0.02);
+
+/**
+ * @brief Name of a verdict, e.g. "REGRESSED"
+ */
+const char* verdictName(BenchVerdict verdict);
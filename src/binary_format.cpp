@@ -0,0 +1,88 @@
+/**
+ * @file binary_format.cpp
+ * @brief Header and symbol dictionary handling shared by the binary order and result files.
+ */
+
+#include "binary_format.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+BinaryFileHeader makeBinaryHeader(const char (&magic)[8], uint16_t recordSize,
+                                  uint64_t recordCount, uint32_t symbolCount) {
+    BinaryFileHeader header{};
+    std::memcpy(header.magic, magic, sizeof(header.magic));
+    header.version = BINARY_FORMAT_VERSION;
+    header.record_size = recordSize;
+    header.symbol_count = symbolCount;
+    header.record_count = recordCount;
+    header.symbols_offset = sizeof(BinaryFileHeader) + recordCount * recordSize;
+    return header;
+}
+
+std::vector<BinarySymbol> makeSymbolTable(const std::vector<std::string>& symbols) {
+    std::vector<BinarySymbol> table(symbols.size());
+    for (size_t i = 0; i < symbols.size(); ++i) {
+        std::memcpy(table[i].name, symbols[i].data(), std::min(symbols[i].size(), BINARY_SYMBOL_SIZE - 1));
+    }
+    return table;
+}
+
+bool writeBinaryTrailer(std::ostream& out, const char (&magic)[8], uint16_t recordSize,
+                        uint64_t recordCount, const std::vector<std::string>& symbols) {
+    std::vector<BinarySymbol> table = makeSymbolTable(symbols);
+    out.write(reinterpret_cast<const char*>(table.data()), static_cast<std::streamsize>(table.size() * sizeof(BinarySymbol)));
+
+    BinaryFileHeader header = makeBinaryHeader(magic, recordSize, recordCount, static_cast<uint32_t>(symbols.size()));
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    return static_cast<bool>(out);
+}
+
+/**
+ * @brief Validates the header and bounds of a mapped binary file.
+ *
+ * The file is rejected if its magic, version or record size do not match this build,
+ * or if the records or symbol dictionary would extend past the end of the file.
+ */
+bool readBinaryHeader(const char* data, size_t size, const char (&magic)[8], uint16_t recordSize,
+                      const std::string& filename, BinaryFileHeader& header, std::vector<std::string>& symbols) {
+    if (size < sizeof(header)) {
+        std::cerr << "Erreur : fichier binaire " << filename << " tronqué" << std::endl;
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, magic, sizeof(header.magic)) != 0
+        || header.version != BINARY_FORMAT_VERSION
+        || header.record_size != recordSize) {
+        std::cerr << "Erreur : format binaire non reconnu dans " << filename << std::endl;
+        return false;
+    }
+
+    // Each bound is checked before it is used in a sum, so corrupt counts cannot wrap around
+    if (header.record_count > size / recordSize
+        || header.symbols_offset < sizeof(BinaryFileHeader) + header.record_count * recordSize
+        || header.symbols_offset > size
+        || header.symbol_count > (size - header.symbols_offset) / sizeof(BinarySymbol)) {
+        std::cerr << "Erreur : fichier binaire " << filename << " tronqué" << std::endl;
+        return false;
+    }
+
+    const auto* entries = reinterpret_cast<const BinarySymbol*>(data + header.symbols_offset);
+    symbols.clear();
+    symbols.reserve(header.symbol_count);
+    for (uint32_t i = 0; i < header.symbol_count; ++i) {
+        symbols.emplace_back(entries[i].name, strnlen(entries[i].name, BINARY_SYMBOL_SIZE));
+    }
+    return true;
+}
+
+bool hasBinaryMagic(const std::string& filename, const char (&magic)[8]) {
+    std::ifstream file(filename, std::ios::binary);
+    char found[8];
+    if (!file.read(found, sizeof(found))) {
+        return false;
+    }
+    return std::memcmp(found, magic, sizeof(found)) == 0;
+}
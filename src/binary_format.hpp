@@ -0,0 +1,163 @@
+/**
+ * @file binary_format.hpp
+ * @brief Defines the on-disk layout of the binary order and result files.
+ *
+ * A binary file is laid out as:
+ * - a fixed-size BinaryFileHeader,
+ * - record_count fixed-width records, starting right after the header,
+ * - the instrument symbol dictionary: symbol_count BinarySymbol entries at symbols_offset.
+ *
+ * Order files hold BinaryOrderRecord records and result files BinaryResultRecord
+ * records; the magic tells them apart. Records refer to their instrument by its index in the dictionary. The dictionary is
+ * written after the records so that files can be produced in a single streaming pass;
+ * the header is rewritten with the final counts when the file is closed. All integers
+ * and floats are stored little-endian.
+ */
+#pragma once
+#include <bit>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+static_assert(std::endian::native == std::endian::little,
+              "Binary order files are little-endian and mapped directly into memory");
+
+/**
+ * @brief Current version of the binary file layout
+ */
+constexpr uint16_t BINARY_FORMAT_VERSION = 1;
+
+/**
+ * @brief Maximum length of an instrument symbol in a binary file
+ */
+constexpr size_t BINARY_SYMBOL_SIZE = 16;
+
+/**
+ * @brief Magic bytes identifying a binary order file
+ */
+constexpr char BINARY_ORDER_MAGIC[8] = {'M', 'E', 'O', 'R', 'D', 'E', 'R', 'S'};
+
+/**
+ * @brief Magic bytes identifying a binary result file
+ */
+constexpr char BINARY_RESULT_MAGIC[8] = {'M', 'E', 'R', 'E', 'S', 'U', 'L', 'T'};
+
+/**
+ * @struct BinaryFileHeader
+ * @brief Header at the start of every binary file
+ */
+struct BinaryFileHeader {
+    char magic[8];             // File type identifier
+    uint16_t version;          // Layout version
+    uint16_t record_size;      // Size of one record in bytes
+    uint32_t symbol_count;     // Number of entries in the symbol dictionary
+    uint64_t record_count;     // Number of records
+    uint64_t symbols_offset;   // Byte offset of the symbol dictionary
+};
+
+/**
+ * @struct BinarySymbol
+ * @brief Entry of the instrument symbol dictionary, NUL-padded
+ */
+struct BinarySymbol {
+    char name[BINARY_SYMBOL_SIZE];
+};
+
+/**
+ * @struct BinaryOrderRecord
+ * @brief Fixed-width record holding one order
+ */
+struct BinaryOrderRecord {
+    uint64_t timestamp;        // Timestamp in nanoseconds
+    int32_t order_id;          // Unique order identifier
+    uint32_t instrument_id;    // Index in the symbol dictionary
+    int32_t quantity;          // Number of units
+    float price;               // Price per unit
+    uint8_t side;              // Side enum value
+    uint8_t type;              // Type enum value
+    uint8_t action;            // Action enum value
+    uint8_t reserved[5];       // Padding, always zero
+};
+
+/**
+ * @struct BinaryResultRecord
+ * @brief Fixed-width record holding one execution report
+ */
+struct BinaryResultRecord {
+    uint64_t timestamp;        // Timestamp in nanoseconds
+    int32_t order_id;          // Unique order identifier
+    uint32_t instrument_id;    // Index in the symbol dictionary
+    int32_t quantity;          // Original order quantity
+    float price;               // Original order price
+    int32_t executed_quantity; // Quantity executed
+    float execution_price;     // Execution price
+    int32_t counterparty_id;   // ID of the counterparty order
+    uint8_t side;              // Side enum value
+    uint8_t type;              // Type enum value
+    uint8_t action;            // Action enum value
+    uint8_t status;            // OrderStatus enum value
+    uint8_t reserved[8];       // Padding, always zero
+};
+
+static_assert(sizeof(BinaryFileHeader) == 32, "Unexpected binary header size");
+static_assert(sizeof(BinarySymbol) == 16, "Unexpected binary symbol size");
+static_assert(sizeof(BinaryOrderRecord) == 32, "Unexpected binary order record size");
+static_assert(sizeof(BinaryResultRecord) == 48, "Unexpected binary result record size");
+
+/**
+ * @brief Builds the header of a finished binary file
+ *
+ * @param magic The magic bytes of the file type
+ * @param recordSize Size of one record in bytes
+ * @param recordCount Number of records written
+ * @param symbolCount Number of entries in the symbol dictionary
+ * @return BinaryFileHeader The header to write at offset 0
+ */
+BinaryFileHeader makeBinaryHeader(const char (&magic)[8], uint16_t recordSize,
+                                  uint64_t recordCount, uint32_t symbolCount);
+
+/**
+ * @brief Builds the on-disk symbol dictionary
+ *
+ * @param symbols The symbols, by id; longer symbols are truncated
+ * @return std::vector<BinarySymbol> The dictionary entries to write after the records
+ */
+std::vector<BinarySymbol> makeSymbolTable(const std::vector<std::string>& symbols);
+
+/**
+ * @brief Appends the symbol dictionary and rewrites the header of a binary file
+ *
+ * The records must already have been written right after a reserved header.
+ *
+ * @param out The file, positioned after the last record
+ * @param magic The magic bytes of the file type
+ * @param recordSize Size of one record in bytes
+ * @param recordCount Number of records written
+ * @param symbols The symbol dictionary, by id
+ * @return bool True if everything was written
+ */
+bool writeBinaryTrailer(std::ostream& out, const char (&magic)[8], uint16_t recordSize,
+                        uint64_t recordCount, const std::vector<std::string>& symbols);
+
+/**
+ * @brief Validates the header of a mapped binary file and loads its symbol dictionary
+ *
+ * Errors are reported on standard error.
+ *
+ * @param data Start of the mapped file
+ * @param size Size of the mapped file
+ * @param magic The expected magic bytes
+ * @param recordSize The expected record size
+ * @param filename The file name, for error messages
+ * @param header Receives the header
+ * @param symbols Receives the symbol dictionary
+ * @return bool False if the file is not of the expected type or is truncated
+ */
+bool readBinaryHeader(const char* data, size_t size, const char (&magic)[8], uint16_t recordSize,
+                      const std::string& filename, BinaryFileHeader& header, std::vector<std::string>& symbols);
+
+/**
+ * @brief Checks whether a file starts with the given magic bytes
+ */
+bool hasBinaryMagic(const std::string& filename, const char (&magic)[8]);
@@ -0,0 +1,229 @@
+/**
+ * @file binary_order_file.cpp
+ * @brief Implementation of the BinaryOrderWriter and BinaryOrderReader classes.
+ */
+
+#include "binary_order_file.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+BinaryOrderWriter::BinaryOrderWriter(const std::string& filename)
+    : filename_(filename), file_(filename, std::ios::binary | std::ios::trunc) {
+    if (!file_.is_open()) {
+        std::cerr << "Erreur : impossible d'ouvrir le fichier binaire " << filename_ << std::endl;
+        return;
+    }
+    // Reserve the header, it is rewritten with the final counts by close()
+    BinaryFileHeader header{};
+    file_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+}
+
+BinaryOrderWriter::~BinaryOrderWriter() {
+    close();
+}
+
+bool BinaryOrderWriter::isOpen() const {
+    return file_.is_open();
+}
+
+uint64_t BinaryOrderWriter::recordCount() const {
+    return count_;
+}
+
+/**
+ * @brief Appends an order as a fixed-width record.
+ *
+ * The instrument is replaced by its index in the symbol dictionary, which grows as
+ * new instruments are seen.
+ *
+ * @param order The order to write.
+ * @return true if the record was written, false otherwise.
+ */
+bool BinaryOrderWriter::writeOrder(const Order& order) {
+    if (!file_.is_open()) {
+        return false;
+    }
+    if (order.instrument.size() >= BINARY_SYMBOL_SIZE) {
+        std::cerr << "Erreur : symbole " << order.instrument << " trop long pour " << filename_ << std::endl;
+        return false;
+    }
+
+    auto [it, inserted] = symbolIds_.try_emplace(order.instrument, static_cast<uint32_t>(symbols_.size()));
+    if (inserted) {
+        symbols_.push_back(order.instrument);
+    }
+
+    BinaryOrderRecord record{};
+    record.timestamp = order.timestamp;
+    record.order_id = order.order_id;
+    record.instrument_id = it->second;
+    record.quantity = order.quantity;
+    record.price = order.price;
+    record.side = static_cast<uint8_t>(order.side);
+    record.type = static_cast<uint8_t>(order.type);
+    record.action = static_cast<uint8_t>(order.action);
+    file_.write(reinterpret_cast<const char*>(&record), sizeof(record));
+    ++count_;
+    return static_cast<bool>(file_);
+}
+
+/**
+ * @brief Appends the symbol dictionary and rewrites the header.
+ *
+ * @return true if the whole file was written, false otherwise.
+ */
+bool BinaryOrderWriter::close() {
+    if (!file_.is_open()) {
+        return false;
+    }
+
+    bool ok = writeBinaryTrailer(file_, BINARY_ORDER_MAGIC, sizeof(BinaryOrderRecord), count_, symbols_);
+    file_.close();
+    if (!ok) {
+        std::cerr << "Erreur : écriture incomplète du fichier binaire " << filename_ << std::endl;
+    }
+    return ok;
+}
+
+/**
+ * @brief Maps the file and validates its header and layout.
+ *
+ * @param filename The path to the binary file.
+ */
+BinaryOrderReader::BinaryOrderReader(const std::string& filename)
+    : filename_(filename) {
+    if (!file_.open(filename_)) {
+        std::cerr << "Erreur : impossible d'ouvrir le fichier binaire " << filename_ << std::endl;
+        return;
+    }
+
+    BinaryFileHeader header;
+    if (!readBinaryHeader(file_.data(), file_.size(), BINARY_ORDER_MAGIC, sizeof(BinaryOrderRecord),
+                          filename_, header, symbols_)) {
+        return;
+    }
+
+    records_ = reinterpret_cast<const BinaryOrderRecord*>(file_.data() + sizeof(BinaryFileHeader));
+    count_ = header.record_count;
+    valid_ = true;
+}
+
+bool BinaryOrderReader::isOpen() const {
+    return valid_;
+}
+
+uint64_t BinaryOrderReader::recordCount() const {
+    return count_;
+}
+
+const std::vector<std::string>& BinaryOrderReader::symbols() const {
+    return symbols_;
+}
+
+const BinaryOrderRecord* BinaryOrderReader::records() const {
+    return records_;
+}
+
+/**
+ * @brief Checks that the side, type and action bytes of a record are in range.
+ */
+static bool hasValidEnums(const BinaryOrderRecord& record) {
+    return record.side <= static_cast<uint8_t>(Side::SELL) && record.type <= static_cast<uint8_t>(Type::LIMIT)
+           && record.action <= static_cast<uint8_t>(Action::CANCEL);
+}
+
+bool BinaryOrderReader::toOrder(const BinaryOrderRecord& record, Order& order) const {
+    if (!hasValidEnums(record)) {
+        return false;
+    }
+    order.timestamp = record.timestamp;
+    order.order_id = record.order_id;
+    if (record.instrument_id < symbols_.size()) {
+        order.instrument = symbols_[record.instrument_id];
+    } else {
+        order.instrument.clear();
+    }
+    order.side = static_cast<Side>(record.side);
+    order.type = static_cast<Type>(record.type);
+    order.quantity = record.quantity;
+    order.price = record.price;
+    order.action = static_cast<Action>(record.action);
+    return true;
+}
+
+/**
+ * @brief Copies the next records into the batch.
+ *
+ * Records are converted field by field; no text is parsed. The batch keeps its orders
+ * between calls so that instrument strings reuse their buffers. Records with a side,
+ * type or action byte out of range are reported on standard error and skipped.
+ */
+size_t BinaryOrderReader::next(std::vector<Order>& batch, size_t maxOrders) {
+    if (!valid_) {
+        batch.clear();
+        return 0;
+    }
+
+    batch.resize(static_cast<size_t>(std::min<uint64_t>(maxOrders, count_ - position_)));
+    size_t n = 0;
+    while (n < batch.size() && position_ < count_) {
+        if (toOrder(records_[position_], batch[n])) {
+            ++n;
+        } else {
+            reject();
+        }
+        ++position_;
+    }
+    batch.resize(n);
+    return n;
+}
+
+void BinaryOrderReader::reject() {
+    std::cerr << "Erreur : enregistrement " << position_ << " invalide dans " << filename_ << std::endl;
+    ++rejected_;
+}
+
+size_t BinaryOrderReader::rejectedCount() const {
+    return rejected_;
+}
+
+/**
+ * @brief Copies the next records into the columns of the batch.
+ *
+ * The file dictionary is interned into the batch dictionary once per call, so each
+ * record only needs its instrument id remapped. Records with a side, type or action
+ * byte out of range are reported and skipped, as by the Order overload.
+ */
+size_t BinaryOrderReader::next(OrderBatch& batch, size_t maxOrders) {
+    batch.clear();
+    if (!valid_) {
+        return 0;
+    }
+
+    batchIds_.clear();
+    for (const auto& symbol : symbols_) {
+        batchIds_.push_back(batch.internSymbol(symbol));
+    }
+
+    size_t n = static_cast<size_t>(std::min<uint64_t>(maxOrders, count_ - position_));
+    batch.reserve(n);
+    const uint32_t unknown = static_cast<uint32_t>(-1);
+    while (batch.size() < n && position_ < count_) {
+        const BinaryOrderRecord& record = records_[position_];
+        if (hasValidEnums(record)) {
+            uint32_t instrumentId = record.instrument_id < batchIds_.size() ? batchIds_[record.instrument_id] : unknown;
+            batch.append(record.timestamp, record.order_id, instrumentId, static_cast<Side>(record.side),
+                         static_cast<Type>(record.type), record.quantity, record.price,
+                         static_cast<Action>(record.action));
+        } else {
+            reject();
+        }
+        ++position_;
+    }
+    return batch.size();
+}
+
+bool BinaryOrderReader::isBinaryFile(const std::string& filename) {
+    return hasBinaryMagic(filename, BINARY_ORDER_MAGIC);
+}
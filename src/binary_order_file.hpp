@@ -0,0 +1,150 @@
+/**
+ * @file binary_order_file.hpp
+ * @brief Defines the writer and reader of binary order files.
+ *
+ * Binary order files hold the same orders as the input CSV files in fixed-width
+ * little-endian records (see binary_format.hpp). They are produced once from a CSV file
+ * and can then be replayed any number of times without parsing text.
+ */
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "binary_format.hpp"
+#include "mapped_file.hpp"
+#include "order.hpp"
+#include "order_source.hpp"
+
+/**
+ * @class BinaryOrderWriter
+ * @brief Writes orders to a binary order file in a single streaming pass.
+ */
+class BinaryOrderWriter {
+public:
+    /**
+     * @brief Creates the binary file and reserves its header.
+     * @param filename The path to the file to be written.
+     */
+    explicit BinaryOrderWriter(const std::string& filename);
+
+    /**
+     * @brief Destructor that finalizes the file if close() was not called.
+     */
+    ~BinaryOrderWriter();
+
+    /**
+     * @brief Checks whether the file could be created.
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Appends an order to the file.
+     * @param order The order to write.
+     * @return False if the file is not open or the instrument symbol is too long.
+     */
+    bool writeOrder(const Order& order);
+
+    /**
+     * @brief Writes the symbol dictionary and the final header, then closes the file.
+     * @return True if the file was written successfully.
+     */
+    bool close();
+
+    /**
+     * @brief Number of orders written so far.
+     */
+    uint64_t recordCount() const;
+
+private:
+    std::string filename_;                               ///< The path to the binary file
+    std::ofstream file_;                                 ///< The output file stream
+    std::vector<std::string> symbols_;                   ///< Symbol dictionary, by id
+    std::unordered_map<std::string, uint32_t> symbolIds_; ///< Symbol to dictionary id
+    uint64_t count_ = 0;                                 ///< Records written
+};
+
+/**
+ * @class BinaryOrderReader
+ * @brief Maps a binary order file and hands its orders out without parsing.
+ */
+class BinaryOrderReader : public OrderSource {
+public:
+    /**
+     * @brief Maps and validates a binary order file.
+     * @param filename The path to the binary file.
+     */
+    explicit BinaryOrderReader(const std::string& filename);
+
+    /**
+     * @brief Checks whether the file was mapped and its header is valid.
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Number of records in the file.
+     */
+    uint64_t recordCount() const;
+
+    /**
+     * @brief Instrument symbol dictionary, indexed by BinaryOrderRecord::instrument_id.
+     */
+    const std::vector<std::string>& symbols() const;
+
+    /**
+     * @brief Direct access to the mapped records.
+     */
+    const BinaryOrderRecord* records() const;
+
+    /**
+     * @brief Converts one record to an Order.
+     * @param record The record to convert.
+     * @param order The order to fill.
+     * @return false if the side, type or action byte is out of range; the order is left unchanged.
+     */
+    bool toOrder(const BinaryOrderRecord& record, Order& order) const;
+
+    /**
+     * @brief Fills a batch with the next orders of the file.
+     * @param batch The batch to fill.
+     * @param maxOrders The maximum number of orders to put in the batch.
+     * @return The number of orders in the batch, 0 at end of file.
+     */
+    size_t next(std::vector<Order>& batch, size_t maxOrders) override;
+
+    /**
+     * @brief Fills a columnar batch with the next orders of the file.
+     * @param batch The batch to fill.
+     * @param maxOrders The maximum number of orders to put in the batch.
+     * @return The number of orders in the batch, 0 at end of file.
+     */
+    size_t next(OrderBatch& batch, size_t maxOrders) override;
+
+    /**
+     * @brief Number of records skipped by next() for an invalid enum byte.
+     */
+    size_t rejectedCount() const;
+
+    /**
+     * @brief Checks whether a file starts with the binary order file magic.
+     * @param filename The path to the file to check.
+     */
+    static bool isBinaryFile(const std::string& filename);
+
+private:
+    /**
+     * @brief Reports the record at the current position as invalid and counts it.
+     */
+    void reject();
+
+    std::string filename_;                ///< The path to the binary file
+    MappedFile file_;                     ///< Mapping of the whole file
+    bool valid_ = false;                  ///< True if the header was validated
+    const BinaryOrderRecord* records_ = nullptr; ///< First record in the mapping
+    uint64_t count_ = 0;                  ///< Number of records
+    uint64_t position_ = 0;               ///< Next record to hand out
+    size_t rejected_ = 0;                 ///< Records skipped for an invalid enum byte
+    std::vector<std::string> symbols_;    ///< Symbol dictionary
+    std::vector<uint32_t> batchIds_;      ///< Batch dictionary id of each file symbol
+};
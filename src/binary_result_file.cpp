@@ -0,0 +1,164 @@
+/**
+ * @file binary_result_file.cpp
+ * @brief Implementation of the BinaryResultWriter and BinaryResultReader classes.
+ */
+
+#include "binary_result_file.hpp"
+#include <iostream>
+
+BinaryResultWriter::BinaryResultWriter(const std::string& filename, const OutputOptions& output)
+    : filename_(filename) {
+    if (!file_.open(filename_, output)) {
+        std::cerr << "Erreur : impossible d'ouvrir le fichier binaire " << filename_ << std::endl;
+        return;
+    }
+    // Reserve the header, it is written with the final counts by close()
+    BinaryFileHeader header{};
+    file_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+}
+
+BinaryResultWriter::~BinaryResultWriter() {
+    close();
+}
+
+bool BinaryResultWriter::isOpen() const {
+    return file_.isOpen();
+}
+
+uint64_t BinaryResultWriter::recordCount() const {
+    return count_;
+}
+
+uint64_t BinaryResultWriter::rejectedCount() const {
+    return rejected_;
+}
+
+/**
+ * @brief Appends a result as a fixed-width record.
+ *
+ * The instrument is replaced by its index in the symbol dictionary. Results whose symbol
+ * does not fit in the dictionary are reported and skipped rather than truncated.
+ *
+ * @param result The OrderResult to write.
+ */
+void BinaryResultWriter::writeOrderResult(const OrderResult& result) {
+    if (!file_.isOpen()) {
+        return;
+    }
+    if (result.instrument.size() >= BINARY_SYMBOL_SIZE) {
+        std::cerr << "Erreur : symbole " << result.instrument << " trop long pour " << filename_ << std::endl;
+        ++rejected_;
+        return;
+    }
+
+    auto [it, inserted] = symbolIds_.try_emplace(result.instrument, static_cast<uint32_t>(symbols_.size()));
+    if (inserted) {
+        symbols_.push_back(result.instrument);
+    }
+
+    BinaryResultRecord record{};
+    record.timestamp = result.timestamp;
+    record.order_id = result.order_id;
+    record.instrument_id = it->second;
+    record.quantity = result.quantity;
+    record.price = result.price;
+    record.executed_quantity = result.executed_quantity;
+    record.execution_price = result.execution_price;
+    record.counterparty_id = result.counterparty_id;
+    record.side = static_cast<uint8_t>(result.side);
+    record.type = static_cast<uint8_t>(result.type);
+    record.action = static_cast<uint8_t>(result.action);
+    record.status = static_cast<uint8_t>(result.status);
+    file_.write(reinterpret_cast<const char*>(&record), sizeof(record));
+    ++count_;
+}
+
+/**
+ * @brief Writes the staged records. The header is not valid until close().
+ */
+void BinaryResultWriter::flush() {
+    file_.flush();
+}
+
+/**
+ * @brief Writes the symbol dictionary, then the final header over the reserved one.
+ *
+ * @return true if the whole file was written, false otherwise.
+ */
+bool BinaryResultWriter::close() {
+    if (!file_.isOpen()) {
+        return false;
+    }
+
+    std::vector<BinarySymbol> table = makeSymbolTable(symbols_);
+    file_.write(reinterpret_cast<const char*>(table.data()), table.size() * sizeof(BinarySymbol));
+    BinaryFileHeader header = makeBinaryHeader(BINARY_RESULT_MAGIC, sizeof(BinaryResultRecord), count_,
+                                               static_cast<uint32_t>(symbols_.size()));
+    bool ok = file_.close(&header, sizeof(header));
+    if (!ok) {
+        std::cerr << "Erreur : écriture incomplète du fichier binaire " << filename_ << std::endl;
+    }
+    return ok;
+}
+
+/**
+ * @brief Maps the file and validates its header and layout.
+ *
+ * @param filename The path to the binary file.
+ */
+BinaryResultReader::BinaryResultReader(const std::string& filename)
+    : filename_(filename) {
+    if (!file_.open(filename_)) {
+        std::cerr << "Erreur : impossible d'ouvrir le fichier binaire " << filename_ << std::endl;
+        return;
+    }
+
+    BinaryFileHeader header;
+    if (!readBinaryHeader(file_.data(), file_.size(), BINARY_RESULT_MAGIC, sizeof(BinaryResultRecord),
+                          filename_, header, symbols_)) {
+        return;
+    }
+
+    records_ = reinterpret_cast<const BinaryResultRecord*>(file_.data() + sizeof(BinaryFileHeader));
+    count_ = header.record_count;
+    valid_ = true;
+}
+
+bool BinaryResultReader::isOpen() const {
+    return valid_;
+}
+
+uint64_t BinaryResultReader::recordCount() const {
+    return count_;
+}
+
+const std::vector<std::string>& BinaryResultReader::symbols() const {
+    return symbols_;
+}
+
+const BinaryResultRecord* BinaryResultReader::records() const {
+    return records_;
+}
+
+void BinaryResultReader::toResult(const BinaryResultRecord& record, OrderResult& result) const {
+    result.timestamp = record.timestamp;
+    result.order_id = record.order_id;
+    if (record.instrument_id < symbols_.size()) {
+        result.instrument = symbols_[record.instrument_id];
+    } else {
+        result.instrument.clear();
+    }
+    result.side = static_cast<Side>(record.side);
+    result.type = static_cast<Type>(record.type);
+    result.quantity = record.quantity;
+    result.price = record.price;
+    result.action = static_cast<Action>(record.action);
+    result.status = static_cast<OrderStatus>(record.status);
+    result.executed_quantity = record.executed_quantity;
+    result.execution_price = record.execution_price;
+    result.counterparty_id = record.counterparty_id;
+}
+
+bool BinaryResultReader::isBinaryFile(const std::string& filename) {
+    return hasBinaryMagic(filename, BINARY_RESULT_MAGIC);
+}
@@ -0,0 +1,134 @@
+/**
+ * @file binary_result_file.hpp
+ * @brief Defines the writer and reader of binary execution report files.
+ *
+ * Binary result files hold the same execution reports as the output CSV files in
+ * fixed-width little-endian records (see binary_format.hpp). Writing them avoids
+ * formatting floats to text on the output path; analytics jobs map them directly, and
+ * the bin_to_csv tool turns them back into the CSV layout when a human needs to read them.
+ */
+#pragma once
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "binary_format.hpp"
+#include "mapped_file.hpp"
+#include "order.hpp"
+#include "output_file.hpp"
+#include "result_writer.hpp"
+
+/**
+ * @class BinaryResultWriter
+ * @brief Writes order results to a binary result file.
+ *
+ * The header is only valid once close() has been called.
+ */
+class BinaryResultWriter : public ResultWriter {
+public:
+    /**
+     * @brief Creates the binary file and reserves its header.
+     * @param filename The path to the file to be written.
+     * @param output Output backend options.
+     */
+    explicit BinaryResultWriter(const std::string& filename, const OutputOptions& output = OutputOptions());
+
+    /**
+     * @brief Destructor that finalizes the file if close() was not called.
+     */
+    ~BinaryResultWriter() override;
+
+    /**
+     * @brief Checks whether the file could be created.
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Appends an order result to the file.
+     * @param result The OrderResult to write.
+     */
+    void writeOrderResult(const OrderResult& result) override;
+
+    /**
+     * @brief Writes the staged records and waits for the writes to complete.
+     */
+    void flush() override;
+
+    /**
+     * @brief Writes the symbol dictionary and the final header, then closes the file.
+     * @return True if the file was written successfully.
+     */
+    bool close();
+
+    /**
+     * @brief Number of results written so far.
+     */
+    uint64_t recordCount() const;
+
+    /**
+     * @brief Number of results skipped because their symbol is too long for the dictionary.
+     */
+    uint64_t rejectedCount() const;
+
+private:
+    std::string filename_;                               ///< The path to the binary file
+    OutputFile file_;                                    ///< The output file
+    std::vector<std::string> symbols_;                   ///< Symbol dictionary, by id
+    std::unordered_map<std::string, uint32_t> symbolIds_; ///< Symbol to dictionary id
+    uint64_t count_ = 0;                                 ///< Records written
+    uint64_t rejected_ = 0;                              ///< Results skipped for a symbol too long
+};
+
+/**
+ * @class BinaryResultReader
+ * @brief Maps a binary result file for direct access to its records.
+ */
+class BinaryResultReader {
+public:
+    /**
+     * @brief Maps and validates a binary result file.
+     * @param filename The path to the binary file.
+     */
+    explicit BinaryResultReader(const std::string& filename);
+
+    /**
+     * @brief Checks whether the file was mapped and its header is valid.
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Number of records in the file.
+     */
+    uint64_t recordCount() const;
+
+    /**
+     * @brief Instrument symbol dictionary, indexed by BinaryResultRecord::instrument_id.
+     */
+    const std::vector<std::string>& symbols() const;
+
+    /**
+     * @brief Direct access to the mapped records.
+     */
+    const BinaryResultRecord* records() const;
+
+    /**
+     * @brief Converts one record to an OrderResult.
+     * @param record The record to convert.
+     * @param result The result to fill.
+     */
+    void toResult(const BinaryResultRecord& record, OrderResult& result) const;
+
+    /**
+     * @brief Checks whether a file starts with the binary result file magic.
+     * @param filename The path to the file to check.
+     */
+    static bool isBinaryFile(const std::string& filename);
+
+private:
+    std::string filename_;                ///< The path to the binary file
+    MappedFile file_;                     ///< Mapping of the whole file
+    bool valid_ = false;                  ///< True if the header was validated
+    const BinaryResultRecord* records_ = nullptr; ///< First record in the mapping
+    uint64_t count_ = 0;                  ///< Number of records
+    std::vector<std::string> symbols_;    ///< Symbol dictionary
+};
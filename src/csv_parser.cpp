@@ -4,7 +4,20 @@
  */
 
 #include "csv_parser.hpp"
+#include "csv_scan.hpp"
+#include "mapped_file.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <condition_variable>
+#include <cstring>
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <sys/mman.h>
+#include <unistd.h>
 
 /**
  * @brief Constructs a CSV parser for the specified file.
@@ -16,8 +29,9 @@ CSVParser::CSVParser(const std::string& filename) : filename_(filename) {}
  * @brief Parses the CSV file and returns a vector of Order objects.
  * 
  * This method reads the specified CSV file line by line, skipping the header row,
- * and converts each subsequent row into an Order object. It handles conversions
- * from string representations to the appropriate enum values for Side, Type, and Action.
+ * and converts each subsequent row into an Order object with parseRow(). Rows that
+ * cannot be converted are reported to the reject sink with their line number and
+ * skipped, so a bad row never aborts the parse.
  * 
  * @return A vector containing all the orders read from the CSV file.
  */
@@ -25,6 +39,7 @@ std::vector<Order> CSVParser::parse() {
     std::vector<Order> orders;
     std::ifstream file(filename_);
     std::string line;
+    rejected_ = 0;
 
     if (!file.is_open()) {
         std::cerr << "Erreur : impossible d'ouvrir le fichier CSV " << filename_ << std::endl;
@@ -33,54 +48,770 @@ std::vector<Order> CSVParser::parse() {
 
     // Skip the header line
     std::getline(file, line);
+    size_t lineNumber = 1;
 
+    Order order;
+    ParseReject reject;
     while (std::getline(file, line)) {
-        std::stringstream ss(line);
-        std::string token;
-        Order order;
-
-        // Parse each column from the CSV row into the Order object
-        std::getline(ss, token, ','); order.timestamp = std::stoull(token);
-        std::getline(ss, token, ','); order.order_id = std::stoi(token);
-        std::getline(ss, token, ','); order.instrument = token;
-        
-        // Convert string side to enum Side
-        std::getline(ss, token, ','); 
-        token.erase(0, token.find_first_not_of(" \t"));  // Left trim
-        token.erase(token.find_last_not_of(" \t") + 1);  // Right trim
-        if (token == "BUY") {
-            order.side = Side::BUY;
-        } else if (token == "SELL") {
-            order.side = Side::SELL;
-        }
-        
-        // Convert string type to enum Type
-        std::getline(ss, token, ','); 
-        token.erase(0, token.find_first_not_of(" \t"));  // Left trim
-        token.erase(token.find_last_not_of(" \t") + 1);  // Right trim
-        if (token == "LIMIT") {
-            order.type = Type::LIMIT;
-        } else if (token == "MARKET") {
-            order.type = Type::MARKET;
-        }
-        
-        std::getline(ss, token, ','); order.quantity = std::stoi(token);
-        std::getline(ss, token, ','); order.price = std::stof(token);
-        
-        // Convert string action to enum Action
-        std::getline(ss, token, ','); 
-        token.erase(0, token.find_first_not_of(" \t"));  // Left trim
-        token.erase(token.find_last_not_of(" \t") + 1);  // Right trim
-        if (token == "NEW") {
-            order.action = Action::NEW;
-        } else if (token == "MODIFY") {
-            order.action = Action::MODIFY;
-        } else if (token == "CANCEL") {
-            order.action = Action::CANCEL;
-        }
-
-        orders.push_back(order);
+        ++lineNumber;
+        if (line.empty() || line == "\r") {
+            continue;
+        }
+        if (parseRow(line, order, &reject)) {
+            orders.push_back(order);
+        } else {
+            reject.line = lineNumber;
+            reject.row = line;
+            report(reject);
+        }
     }
 
     return orders;
-}
\ No newline at end of file
+}
+
+void CSVParser::setRejectSink(RejectSink sink) {
+    sink_ = std::move(sink);
+}
+
+size_t CSVParser::rejectedCount() const {
+    return rejected_;
+}
+
+/**
+ * @brief Prints a rejected row on standard error.
+ */
+static void printReject(const std::string& filename, const ParseReject& reject) {
+    std::cerr << "Erreur : " << filename << " ligne " << reject.line << " colonne " << reject.column
+              << " : " << reject.reason << std::endl;
+}
+
+/**
+ * @brief Delivers a rejected row to the sink, or to standard error without a sink.
+ */
+void CSVParser::report(const ParseReject& reject) {
+    ++rejected_;
+    if (sink_) {
+        sink_(reject);
+    } else {
+        printReject(filename_, reject);
+    }
+}
+
+/**
+ * @brief Removes leading and trailing spaces and tabs from a field.
+ */
+static std::string_view trim(std::string_view field) {
+    while (!field.empty() && (field.front() == ' ' || field.front() == '\t')) field.remove_prefix(1);
+    while (!field.empty() && (field.back() == ' ' || field.back() == '\t')) field.remove_suffix(1);
+    return field;
+}
+
+/**
+ * @brief Splits the next comma-separated field off the front of a row.
+ */
+static std::string_view nextField(std::string_view& row) {
+    const char* end = row.data() + row.size();
+    const char* comma = findChar(row.data(), end, ',');
+    size_t length = static_cast<size_t>(comma - row.data());
+    std::string_view field = row.substr(0, length);
+    row.remove_prefix(comma != end ? length + 1 : length);
+    return trim(field);
+}
+
+/**
+ * @brief Returns the end of the row starting at cursor: its newline, or end if it is the last one.
+ */
+static const char* findRowEnd(const char* cursor, const char* end) {
+    return findChar(cursor, end, '\n');
+}
+
+/**
+ * @brief Converts a whole field to a number with std::from_chars.
+ * @return true if the field was fully consumed by the conversion.
+ */
+template <typename T>
+static bool toNumber(std::string_view field, T& value) {
+    auto [end, ec] = std::from_chars(field.data(), field.data() + field.size(), value);
+    return ec == std::errc() && end == field.data() + field.size() && !field.empty();
+}
+
+/**
+ * @brief Converts an unsigned field with the eight-digits-at-a-time fast path.
+ */
+static bool toNumber(std::string_view field, uint64_t& value) {
+    return parseUnsigned(field, value);
+}
+
+/**
+ * @brief Converts an int field, using the digit fast path for non-negative values.
+ */
+static bool toNumber(std::string_view field, int& value) {
+    uint64_t digits;
+    if (parseUnsigned(field, digits)) {
+        if (digits > static_cast<uint64_t>(std::numeric_limits<int>::max())) {
+            return false;
+        }
+        value = static_cast<int>(digits);
+        return true;
+    }
+    return toNumber<int>(field, value);
+}
+
+/**
+ * @brief Records why a row is rejected.
+ * @return false, so that callers can write `return fail(...)`.
+ */
+static bool fail(ParseReject* reject, int column, const char* reason) {
+    if (reject) {
+        reject->column = column;
+        reject->reason = reason;
+    }
+    return false;
+}
+
+/**
+ * @struct RowFields
+ * @brief Converted fields of a CSV row, with the instrument still viewed in the row.
+ */
+struct RowFields {
+    uint64_t timestamp;
+    int order_id;
+    std::string_view instrument;
+    Side side;
+    Type type;
+    int quantity;
+    float price;
+    Action action;
+};
+
+/**
+ * @brief Parses and validates the fields of a single CSV row.
+ * 
+ * Fields are viewed in place and converted with std::from_chars. Nothing throws: the
+ * first problem found is described in `reject` and the row is refused, so the fields
+ * never carry an uninitialized enum or a garbage number.
+ */
+static bool parseFields(std::string_view row, RowFields& fields, ParseReject* reject) {
+    if (!row.empty() && row.back() == '\r') {
+        row.remove_suffix(1);
+    }
+
+    if (!toNumber(nextField(row), fields.timestamp)) return fail(reject, 1, "invalid timestamp");
+    if (!toNumber(nextField(row), fields.order_id)) return fail(reject, 2, "invalid order_id");
+
+    fields.instrument = nextField(row);
+    if (fields.instrument.empty()) return fail(reject, 3, "missing instrument");
+
+    std::string_view token = nextField(row);
+    if (token == "BUY") {
+        fields.side = Side::BUY;
+    } else if (token == "SELL") {
+        fields.side = Side::SELL;
+    } else {
+        return fail(reject, 4, "unknown side");
+    }
+
+    token = nextField(row);
+    if (token == "LIMIT") {
+        fields.type = Type::LIMIT;
+    } else if (token == "MARKET") {
+        fields.type = Type::MARKET;
+    } else {
+        return fail(reject, 5, "unknown type");
+    }
+
+    if (!toNumber(nextField(row), fields.quantity)) return fail(reject, 6, "invalid quantity");
+    if (fields.quantity < 0) return fail(reject, 6, "negative quantity");
+    if (!toNumber(nextField(row), fields.price)) return fail(reject, 7, "invalid price");
+    if (!std::isfinite(fields.price) || fields.price < 0.0f) return fail(reject, 7, "price out of range");
+
+    token = nextField(row);
+    if (token == "NEW") {
+        fields.action = Action::NEW;
+    } else if (token == "MODIFY") {
+        fields.action = Action::MODIFY;
+    } else if (token == "CANCEL") {
+        fields.action = Action::CANCEL;
+    } else {
+        return fail(reject, 8, "unknown action");
+    }
+
+    if (!trim(row).empty()) return fail(reject, 9, "too many columns");
+
+    return true;
+}
+
+/**
+ * @brief Parses and validates a single CSV row into an Order.
+ * 
+ * The only copy is the instrument symbol, which fits in the small-string buffer for
+ * usual tickers. A rejected row leaves the Order unspecified.
+ * 
+ * @param row The row, without its line terminator.
+ * @param order The order to fill.
+ * @param reject If not null, receives the column and reason of a rejection.
+ * @return true if the row is valid, false if it is rejected.
+ */
+bool CSVParser::parseRow(std::string_view row, Order& order, ParseReject* reject) {
+    RowFields fields;
+    if (!parseFields(row, fields, reject)) {
+        return false;
+    }
+    order.timestamp = fields.timestamp;
+    order.order_id = fields.order_id;
+    order.instrument.assign(fields.instrument);
+    order.side = fields.side;
+    order.type = fields.type;
+    order.quantity = fields.quantity;
+    order.price = fields.price;
+    order.action = fields.action;
+    return true;
+}
+
+/**
+ * @brief Parses and validates a single CSV row into a new row of a columnar batch.
+ * 
+ * The instrument is interned in the batch dictionary; only symbols not seen before are
+ * copied. A rejected row is not appended.
+ * 
+ * @param row The row, without its line terminator.
+ * @param batch The batch to append to.
+ * @param reject If not null, receives the column and reason of a rejection.
+ * @return true if the row is valid, false if it is rejected.
+ */
+bool CSVParser::parseRow(std::string_view row, OrderBatch& batch, ParseReject* reject) {
+    RowFields fields;
+    if (!parseFields(row, fields, reject)) {
+        return false;
+    }
+    batch.append(fields.timestamp, fields.order_id, batch.internSymbol(fields.instrument), fields.side,
+                 fields.type, fields.quantity, fields.price, fields.action);
+    return true;
+}
+
+/**
+ * @brief Appends a parsed row to a vector of orders.
+ */
+static bool appendRow(std::string_view row, std::vector<Order>& orders, ParseReject& reject) {
+    orders.emplace_back();
+    if (CSVParser::parseRow(row, orders.back(), &reject)) {
+        return true;
+    }
+    orders.pop_back();
+    return false;
+}
+
+/**
+ * @brief Appends a parsed row to a columnar batch.
+ */
+static bool appendRow(std::string_view row, OrderBatch& batch, ParseReject& reject) {
+    return CSVParser::parseRow(row, batch, &reject);
+}
+
+/**
+ * @brief Parses every row of a byte range that starts and ends on row boundaries.
+ * 
+ * Rejected rows are collected with their line number relative to the first row of the
+ * range (starting at 0), so that ranges parsed concurrently can be renumbered afterwards.
+ * 
+ * @return The number of lines in the range.
+ */
+template <typename Output>
+static size_t parseRange(const char* cursor, const char* end, Output& output,
+                         std::vector<ParseReject>& rejects) {
+    size_t lines = static_cast<size_t>(std::count(cursor, end, '\n'));
+    output.reserve(output.size() + lines + 1);
+    size_t line = 0;
+    ParseReject reject;
+    for (; cursor < end; ++line) {
+        const char* lineEnd = findRowEnd(cursor, end);
+        std::string_view row(cursor, static_cast<size_t>(lineEnd - cursor));
+        cursor = lineEnd != end ? lineEnd + 1 : end;
+
+        if (row.empty() || row == "\r") {
+            continue;
+        }
+        if (!appendRow(row, output, reject)) {
+            reject.line = line;
+            reject.row.assign(row);
+            rejects.push_back(reject);
+        }
+    }
+    return line;
+}
+
+/**
+ * @brief Parses a mapped file, skipping its header row, and reports the rejected rows.
+ */
+template <typename Output>
+static void parseMappedFile(const MappedFile& file, Output& output, std::vector<ParseReject>& rejects) {
+    const char* cursor = file.data();
+    const char* end = file.data() + file.size();
+
+    // Skip the header line
+    const char* newline = static_cast<const char*>(std::memchr(cursor, '\n', end - cursor));
+    cursor = newline ? newline + 1 : end;
+
+    parseRange(cursor, end, output, rejects);
+    for (auto& reject : rejects) {
+        reject.line += 2; // Header is line 1
+    }
+}
+
+/**
+ * @brief Parses the CSV file through a memory mapping.
+ * 
+ * Maps the whole file, skips the header row and walks the remaining rows with
+ * pointer arithmetic. The output vector is sized from a newline count up front so it
+ * never reallocates. Rejected rows are reported once the file has been parsed.
+ * 
+ * @return A vector containing all the orders read from the CSV file.
+ */
+std::vector<Order> CSVParser::parseMapped() {
+    std::vector<Order> orders;
+    MappedFile file;
+    rejected_ = 0;
+
+    if (!file.open(filename_)) {
+        std::cerr << "Erreur : impossible d'ouvrir le fichier CSV " << filename_ << std::endl;
+        return orders;
+    }
+    if (file.size() == 0) {
+        return orders;
+    }
+
+    std::vector<ParseReject> rejects;
+    parseMappedFile(file, orders, rejects);
+    for (const auto& reject : rejects) {
+        report(reject);
+    }
+
+    return orders;
+}
+
+/**
+ * @brief Parses the CSV file through a memory mapping into a columnar batch.
+ * 
+ * Same walk as parseMapped(), but every field goes straight into its column and the
+ * instruments into the batch dictionary, so no Order or std::string is built per row.
+ * 
+ * @return A batch holding all the orders read from the CSV file.
+ */
+OrderBatch CSVParser::parseBatch() {
+    OrderBatch batch;
+    MappedFile file;
+    rejected_ = 0;
+
+    if (!file.open(filename_)) {
+        std::cerr << "Erreur : impossible d'ouvrir le fichier CSV " << filename_ << std::endl;
+        return batch;
+    }
+    if (file.size() == 0) {
+        return batch;
+    }
+
+    std::vector<ParseReject> rejects;
+    parseMappedFile(file, batch, rejects);
+    for (const auto& reject : rejects) {
+        report(reject);
+    }
+
+    return batch;
+}
+
+/**
+ * @brief Parses the CSV file on several threads.
+ * 
+ * Maps the file, skips the header, then cuts the remaining bytes into equal ranges
+ * whose boundaries are pushed forward to just past the next newline, so that every row
+ * belongs to exactly one range. Each range is parsed by its own thread; the batches are
+ * returned in file order. Rejected rows are renumbered and reported in file order on the
+ * calling thread, so the sink never needs to be thread-safe.
+ * 
+ * @param threads The number of worker threads.
+ * @param minChunkBytes The minimum size of a range.
+ * @return The per-chunk order batches, in file order.
+ */
+std::vector<std::vector<Order>> CSVParser::parseParallel(unsigned threads, size_t minChunkBytes) {
+    std::vector<std::vector<Order>> chunks;
+    MappedFile file;
+    rejected_ = 0;
+
+    if (!file.open(filename_)) {
+        std::cerr << "Erreur : impossible d'ouvrir le fichier CSV " << filename_ << std::endl;
+        return chunks;
+    }
+    if (file.size() == 0) {
+        return chunks;
+    }
+
+    const char* begin = file.data();
+    const char* end = file.data() + file.size();
+
+    // Skip the header line
+    const char* newline = static_cast<const char*>(std::memchr(begin, '\n', end - begin));
+    begin = newline ? newline + 1 : end;
+
+    size_t bytes = static_cast<size_t>(end - begin);
+    size_t count = std::max<size_t>(1, std::min<size_t>(std::max(threads, 1u), bytes / std::max<size_t>(minChunkBytes, 1)));
+
+    // Cut the file into ranges aligned to row boundaries
+    std::vector<const char*> bounds = { begin };
+    for (size_t i = 1; i < count; ++i) {
+        const char* cut = std::max(begin + bytes * i / count, bounds.back());
+        newline = static_cast<const char*>(std::memchr(cut, '\n', end - cut));
+        bounds.push_back(newline ? newline + 1 : end);
+    }
+    bounds.push_back(end);
+
+    chunks.resize(count);
+    std::vector<std::vector<ParseReject>> rejects(count);
+    std::vector<size_t> lines(count);
+    std::vector<std::thread> workers;
+    workers.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        workers.emplace_back([&, i]() {
+            lines[i] = parseRange(bounds[i], bounds[i + 1], chunks[i], rejects[i]);
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    // Renumber the rejects of each chunk and report them in file order
+    size_t firstLine = 2; // Header is line 1
+    for (size_t i = 0; i < count; ++i) {
+        for (auto& reject : rejects[i]) {
+            reject.line += firstLine;
+            report(reject);
+        }
+        firstLine += lines[i];
+    }
+
+    return chunks;
+}
+
+/**
+ * @brief Parses the CSV file on several threads and hands each chunk over as soon as it is ready.
+ * 
+ * Workers claim the next chunk under a lock, cutting it at the first newline past
+ * chunkBytes, and parse it into one of maxInFlight slots; a worker waits while that many
+ * chunks are parsed but not yet consumed. The calling thread waits for the chunks in
+ * file order, reports their renumbered rejects, passes the orders to consume and
+ * releases the pages behind them, so memory stays bounded whatever the file size.
+ * 
+ * @param threads The number of worker threads.
+ * @param consume Called on the calling thread with each chunk's orders, in file order.
+ * @param chunkBytes The approximate size of a chunk.
+ * @param maxInFlight The maximum number of chunks parsed but not yet consumed (0 for twice the threads).
+ * @return The number of chunks handed to consume.
+ */
+size_t CSVParser::parseParallel(unsigned threads, const std::function<void(std::vector<Order>&)>& consume,
+                                size_t chunkBytes, size_t maxInFlight) {
+    MappedFile file;
+    rejected_ = 0;
+
+    if (!file.open(filename_)) {
+        std::cerr << "Erreur : impossible d'ouvrir le fichier CSV " << filename_ << std::endl;
+        return 0;
+    }
+    if (file.size() == 0) {
+        return 0;
+    }
+
+    const char* begin = file.data();
+    const char* end = file.data() + file.size();
+
+    // Skip the header line
+    const char* newline = static_cast<const char*>(std::memchr(begin, '\n', end - begin));
+    begin = newline ? newline + 1 : end;
+
+    threads = std::max(threads, 1u);
+    chunkBytes = std::max<size_t>(chunkBytes, 1);
+    if (maxInFlight == 0) {
+        maxInFlight = 2 * static_cast<size_t>(threads);
+    }
+
+    struct Chunk {
+        std::vector<Order> orders;
+        std::vector<ParseReject> rejects;
+        const char* end = nullptr;
+        size_t lines = 0;
+        bool ready = false;
+    };
+    std::vector<Chunk> slots(maxInFlight);
+    std::mutex mutex;
+    std::condition_variable changed;
+    const char* next = begin;  // Start of the next unclaimed chunk
+    size_t claimed = 0;        // Chunks handed to workers
+    size_t consumed = 0;       // Chunks handed to consume
+
+    auto work = [&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            changed.wait(lock, [&]() { return next == end || claimed < consumed + maxInFlight; });
+            if (next == end) {
+                return;
+            }
+
+            // Claim the next chunk, cut just past the first newline after chunkBytes
+            Chunk& chunk = slots[claimed++ % maxInFlight];
+            const char* first = next;
+            if (static_cast<size_t>(end - first) <= chunkBytes) {
+                next = end;
+            } else {
+                const char* cut = first + chunkBytes;
+                const char* row = static_cast<const char*>(std::memchr(cut, '\n', end - cut));
+                next = row ? row + 1 : end;
+            }
+            chunk.end = next;
+
+            lock.unlock();
+            chunk.lines = parseRange(first, chunk.end, chunk.orders, chunk.rejects);
+            lock.lock();
+            chunk.ready = true;
+            changed.notify_all();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (unsigned i = 0; i < threads; ++i) {
+        workers.emplace_back(work);
+    }
+
+    static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const char* released = file.data();
+    size_t firstLine = 2; // Header is line 1
+    while (true) {
+        std::unique_lock<std::mutex> lock(mutex);
+        Chunk& chunk = slots[consumed % maxInFlight];
+        changed.wait(lock, [&]() { return chunk.ready || (next == end && consumed == claimed); });
+        if (!chunk.ready) {
+            break;
+        }
+        lock.unlock();
+
+        // Renumber the rejects of the chunk and report them in file order
+        for (auto& reject : chunk.rejects) {
+            reject.line += firstLine;
+            report(reject);
+        }
+        firstLine += chunk.lines;
+        consume(chunk.orders);
+
+        // Drop the pages wholly behind this chunk; a worker reading a shared page simply faults it back in
+        size_t length = static_cast<size_t>(chunk.end - released) / pageSize * pageSize;
+        if (length > 0) {
+            madvise(const_cast<char*>(released), length, MADV_DONTNEED);
+            released += length;
+        }
+
+        chunk.orders.clear();
+        chunk.rejects.clear();
+        lock.lock();
+        chunk.ready = false;
+        ++consumed;
+        changed.notify_all();
+    }
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return consumed;
+}
+
+/**
+ * @brief Opens a CSV file for streaming and skips its header row.
+ * 
+ * @param filename The path to the CSV file to be streamed.
+ * @param useMmap Read through a memory mapping instead of a read buffer.
+ * @param bufferSize Size of the read buffer in bytes.
+ */
+CSVOrderStream::CSVOrderStream(const std::string& filename, bool useMmap, size_t bufferSize)
+    : filename_(filename), useMmap_(useMmap), open_(false) {
+    if (useMmap_) {
+        open_ = mapped_.open(filename_);
+        cursor_ = mapped_.data();
+        released_ = mapped_.data();
+    } else {
+        file_.open(filename_, std::ios::binary);
+        open_ = file_.is_open();
+        buffer_.resize(std::max<size_t>(bufferSize, 64));
+    }
+
+    if (!open_) {
+        std::cerr << "Erreur : impossible d'ouvrir le fichier CSV " << filename_ << std::endl;
+        return;
+    }
+
+    // Skip the header line
+    std::string_view header;
+    nextRow(header);
+}
+
+bool CSVOrderStream::isOpen() const {
+    return open_;
+}
+
+void CSVOrderStream::setRejectSink(RejectSink sink) {
+    sink_ = std::move(sink);
+}
+
+size_t CSVOrderStream::rejectedCount() const {
+    return rejected_;
+}
+
+/**
+ * @brief Fills a batch with the next orders of the file.
+ * 
+ * The batch keeps its elements between calls so that the instrument strings are
+ * reassigned in place rather than reallocated. Empty rows are skipped; malformed rows
+ * are reported to the reject sink and skipped.
+ * 
+ * @param batch The batch to fill.
+ * @param maxOrders The maximum number of orders to put in the batch.
+ * @return The number of orders in the batch, 0 at end of file.
+ */
+size_t CSVOrderStream::next(std::vector<Order>& batch, size_t maxOrders) {
+    if (batch.size() < maxOrders) {
+        batch.resize(maxOrders);
+    }
+
+    size_t count = 0;
+    std::string_view row;
+    ParseReject reject;
+    while (count < maxOrders && open_ && nextRow(row)) {
+        if (row.empty() || row == "\r") {
+            continue;
+        }
+        if (CSVParser::parseRow(row, batch[count], &reject)) {
+            ++count;
+        } else {
+            ++rejected_;
+            reject.line = line_;
+            reject.row.assign(row);
+            if (sink_) {
+                sink_(reject);
+            } else {
+                printReject(filename_, reject);
+            }
+        }
+    }
+
+    batch.resize(count);
+    return count;
+}
+
+/**
+ * @brief Fills a columnar batch with the next orders of the file.
+ * 
+ * Rows are parsed straight into the columns; only instruments not yet in the batch
+ * dictionary are copied. Empty rows are skipped; malformed rows are reported to the
+ * reject sink and skipped.
+ * 
+ * @param batch The batch to fill.
+ * @param maxOrders The maximum number of orders to put in the batch.
+ * @return The number of orders in the batch, 0 at end of file.
+ */
+size_t CSVOrderStream::next(OrderBatch& batch, size_t maxOrders) {
+    batch.clear();
+    batch.reserve(maxOrders);
+
+    std::string_view row;
+    ParseReject reject;
+    while (batch.size() < maxOrders && open_ && nextRow(row)) {
+        if (row.empty() || row == "\r") {
+            continue;
+        }
+        if (!CSVParser::parseRow(row, batch, &reject)) {
+            ++rejected_;
+            reject.line = line_;
+            reject.row.assign(row);
+            if (sink_) {
+                sink_(reject);
+            } else {
+                printReject(filename_, reject);
+            }
+        }
+    }
+
+    return batch.size();
+}
+
+bool CSVOrderStream::nextRow(std::string_view& row) {
+    bool found = useMmap_ ? nextMappedRow(row) : nextBufferedRow(row);
+    if (found) {
+        ++line_;
+    }
+    return found;
+}
+
+/**
+ * @brief Returns the next row from the read buffer, refilling it as needed.
+ * 
+ * Partial rows at the end of the buffer are moved to the front before the next read;
+ * the buffer only grows if a single row is longer than the whole buffer.
+ */
+bool CSVOrderStream::nextBufferedRow(std::string_view& row) {
+    while (true) {
+        const char* data = buffer_.data();
+        const char* newline = findRowEnd(data + begin_, data + end_);
+        if (newline != data + end_) {
+            size_t length = static_cast<size_t>(newline - (data + begin_));
+            row = std::string_view(data + begin_, length);
+            begin_ += length + 1;
+            return true;
+        }
+
+        if (eof_) {
+            if (begin_ == end_) {
+                return false;
+            }
+            // Last row without a trailing newline
+            row = std::string_view(data + begin_, end_ - begin_);
+            begin_ = end_;
+            return true;
+        }
+
+        // Move the partial row to the front and refill the buffer
+        std::memmove(buffer_.data(), buffer_.data() + begin_, end_ - begin_);
+        end_ -= begin_;
+        begin_ = 0;
+        if (end_ == buffer_.size()) {
+            buffer_.resize(buffer_.size() * 2);
+        }
+        file_.read(buffer_.data() + end_, static_cast<std::streamsize>(buffer_.size() - end_));
+        std::streamsize got = file_.gcount();
+        end_ += static_cast<size_t>(got);
+        if (got == 0) {
+            eof_ = true;
+        }
+    }
+}
+
+/**
+ * @brief Returns the next row from the mapping.
+ * 
+ * Pages that have been fully consumed are released in large steps so that the resident
+ * size of the mapping stays bounded while streaming very large files.
+ */
+bool CSVOrderStream::nextMappedRow(std::string_view& row) {
+    const char* end = mapped_.data() + mapped_.size();
+    if (cursor_ == nullptr || cursor_ >= end) {
+        return false;
+    }
+
+    const char* lineEnd = findRowEnd(cursor_, end);
+    row = std::string_view(cursor_, static_cast<size_t>(lineEnd - cursor_));
+    cursor_ = lineEnd != end ? lineEnd + 1 : end;
+
+    const size_t releaseStep = 16 << 20;
+    if (static_cast<size_t>(cursor_ - released_) >= 2 * releaseStep) {
+        static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        size_t length = (static_cast<size_t>(cursor_ - released_) - releaseStep) / pageSize * pageSize;
+        madvise(const_cast<char*>(released_), length, MADV_DONTNEED);
+        released_ += length;
+    }
+    return true;
+}
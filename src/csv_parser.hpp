@@ -7,11 +7,33 @@
  */
 
 #pragma once
+#include <cstddef>
+#include <functional>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <fstream>
 #include <sstream>
+#include "mapped_file.hpp"
 #include "order.hpp"
+#include "order_batch.hpp"
+#include "order_source.hpp"
+
+/**
+ * @struct ParseReject
+ * @brief Describes a CSV row that could not be converted into an Order.
+ */
+struct ParseReject {
+    size_t line = 0;           // Line number in the file (the header is line 1)
+    int column = 0;            // Column of the offending field, starting at 1
+    const char* reason = "";   // Why the row was rejected
+    std::string row;           // Raw content of the row
+};
+
+/**
+ * @brief Receives the rows rejected by the parser, in file order.
+ */
+using RejectSink = std::function<void(const ParseReject&)>;
 
 /**
  * @class CSVParser
@@ -32,10 +54,180 @@ public:
     
     /**
      * @brief Parses the CSV file and returns a vector of Order objects.
+     * 
+     * Malformed rows never throw: they are reported to the reject sink and skipped.
+     * 
      * @return A vector containing all the orders read from the CSV file.
      */
     std::vector<Order> parse();
+    
+    /**
+     * @brief Sets the sink receiving rejected rows.
+     * 
+     * Without a sink, rejected rows are reported on standard error.
+     * 
+     * @param sink The sink to call for every rejected row.
+     */
+    void setRejectSink(RejectSink sink);
+    
+    /**
+     * @brief Number of rows rejected by the last parse.
+     */
+    size_t rejectedCount() const;
+    
+    /**
+     * @brief Parses the CSV file through a memory mapping and returns a vector of Order objects.
+     * 
+     * Walks the mapped file with pointer arithmetic and converts fields with std::from_chars,
+     * without building a stream or a temporary string per row.
+     * 
+     * @return A vector containing all the orders read from the CSV file.
+     */
+    std::vector<Order> parseMapped();
+    
+    /**
+     * @brief Parses the CSV file through a memory mapping into a columnar batch.
+     * 
+     * Fields are written straight into the batch columns and instruments into its symbol
+     * dictionary, without building an Order per row.
+     * 
+     * @return A batch holding all the orders read from the CSV file.
+     */
+    OrderBatch parseBatch();
+    
+    /**
+     * @brief Parses the CSV file on several threads.
+     * 
+     * The mapped file is split into byte ranges aligned to row boundaries; each range is
+     * parsed by its own thread into its own batch.
+     * 
+     * @param threads The number of worker threads (and at most the number of chunks).
+     * @param minChunkBytes Ranges are never made smaller than this, so small files use fewer threads.
+     * @return The per-chunk order batches, in file order.
+     */
+    std::vector<std::vector<Order>> parseParallel(unsigned threads, size_t minChunkBytes = 1 << 20);
+
+    /**
+     * @brief Parses the CSV file on several threads and hands each chunk over as soon as it is ready.
+     *
+     * The mapped file is cut into row-aligned chunks of about chunkBytes. Worker threads
+     * parse them ahead of the caller, but never more than maxInFlight at a time; the calling
+     * thread passes every chunk to consume in file order, then releases its pages.
+     *
+     * @param threads The number of worker threads.
+     * @param consume Called on the calling thread with each chunk's orders, in file order.
+     * @param chunkBytes The approximate size of a chunk.
+     * @param maxInFlight The maximum number of chunks parsed but not yet consumed (0 for twice the threads).
+     * @return The number of chunks handed to consume.
+     */
+    size_t parseParallel(unsigned threads, const std::function<void(std::vector<Order>&)>& consume,
+                         size_t chunkBytes = 1 << 20, size_t maxInFlight = 0);
+
+    /**
+     * @brief Parses and validates a single CSV row into an Order without throwing.
+     * @param row The row, without its line terminator.
+     * @param order The order to fill.
+     * @param reject If not null, receives the column and reason when the row is rejected.
+     * @return True if every column was converted and validated, false if the row is rejected.
+     */
+    static bool parseRow(std::string_view row, Order& order, ParseReject* reject = nullptr);
+    
+    /**
+     * @brief Parses and validates a single CSV row into a new row of a columnar batch.
+     * @param row The row, without its line terminator.
+     * @param batch The batch to append to; nothing is appended if the row is rejected.
+     * @param reject If not null, receives the column and reason when the row is rejected.
+     * @return True if every column was converted and validated, false if the row is rejected.
+     */
+    static bool parseRow(std::string_view row, OrderBatch& batch, ParseReject* reject = nullptr);
 
 private:
+    /**
+     * @brief Delivers a rejected row to the sink, or to standard error without a sink.
+     */
+    void report(const ParseReject& reject);
+    
     std::string filename_; ///< The path to the CSV file to be parsed.
-};
\ No newline at end of file
+    RejectSink sink_;      ///< Receives rejected rows
+    size_t rejected_ = 0;  ///< Rows rejected by the last parse
+};
+
+/**
+ * @class CSVOrderStream
+ * @brief Streams orders from a CSV file in fixed-size batches.
+ * 
+ * Unlike CSVParser::parse(), the file is never materialized: rows are read through a
+ * fixed-size buffer (or a memory mapping whose consumed pages are released), so peak
+ * memory does not depend on the file size and the first batch is available immediately.
+ * Malformed rows are reported to the reject sink and skipped.
+ */
+class CSVOrderStream : public OrderSource {
+public:
+    /**
+     * @brief Opens a CSV file for streaming and skips its header row.
+     * @param filename The path to the CSV file to be streamed.
+     * @param useMmap Read through a memory mapping instead of a read buffer.
+     * @param bufferSize Size of the read buffer in bytes.
+     */
+    explicit CSVOrderStream(const std::string& filename, bool useMmap = false, size_t bufferSize = 1 << 20);
+    
+    /**
+     * @brief Checks whether the file could be opened.
+     */
+    bool isOpen() const;
+    
+    /**
+     * @brief Sets the sink receiving rejected rows (standard error by default).
+     * @param sink The sink to call for every rejected row.
+     */
+    void setRejectSink(RejectSink sink);
+    
+    /**
+     * @brief Number of rows rejected so far.
+     */
+    size_t rejectedCount() const;
+    
+    /**
+     * @brief Fills a batch with the next orders of the file.
+     * @param batch The batch to fill.
+     * @param maxOrders The maximum number of orders to put in the batch.
+     * @return The number of orders in the batch, 0 at end of file.
+     */
+    size_t next(std::vector<Order>& batch, size_t maxOrders) override;
+    
+    /**
+     * @brief Fills a columnar batch with the next orders of the file.
+     * @param batch The batch to fill.
+     * @param maxOrders The maximum number of orders to put in the batch.
+     * @return The number of orders in the batch, 0 at end of file.
+     */
+    size_t next(OrderBatch& batch, size_t maxOrders) override;
+
+private:
+    /**
+     * @brief Returns the next row of the file, without its line terminator.
+     * @param row Receives a view of the row, valid until the next call.
+     * @return False at end of file.
+     */
+    bool nextRow(std::string_view& row);
+    
+    bool nextBufferedRow(std::string_view& row);
+    bool nextMappedRow(std::string_view& row);
+    
+    std::string filename_;         ///< The path to the CSV file
+    bool useMmap_;                 ///< True if reading through a memory mapping
+    bool open_;                    ///< True if the file could be opened
+    size_t line_ = 0;              ///< Line number of the last row returned
+    RejectSink sink_;              ///< Receives rejected rows
+    size_t rejected_ = 0;          ///< Rows rejected so far
+    
+    std::ifstream file_;           ///< Input stream (buffered mode)
+    std::vector<char> buffer_;     ///< Read buffer (buffered mode)
+    size_t begin_ = 0;             ///< Start of unconsumed data in buffer_
+    size_t end_ = 0;               ///< End of valid data in buffer_
+    bool eof_ = false;             ///< True once the stream reached end of file
+    
+    MappedFile mapped_;            ///< Mapping of the file (mmap mode)
+    const char* cursor_ = nullptr; ///< Next unread byte of the mapping
+    const char* released_ = nullptr; ///< Start of the pages not yet released
+};
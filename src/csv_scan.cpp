@@ -0,0 +1,179 @@
+/**
+ * @file csv_scan.cpp
+ * @brief Implementation of the vectorized CSV scanning and digit conversion primitives.
+ */
+
+#include "csv_scan.hpp"
+#include <bit>
+#include <charconv>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define CSV_SCAN_X86 1
+#endif
+
+/**
+ * @brief Scalar kernel: byte-by-byte search.
+ */
+static const char* findCharScalar(const char* begin, const char* end, char c) {
+    for (const char* p = begin; p < end; ++p) {
+        if (*p == c) {
+            return p;
+        }
+    }
+    return end;
+}
+
+#ifdef CSV_SCAN_X86
+/**
+ * @brief SSE2 kernel: compares 16 bytes per step and extracts a bitmask of matches.
+ */
+__attribute__((target("sse2")))
+static const char* findCharSSE2(const char* begin, const char* end, char c) {
+    const __m128i needle = _mm_set1_epi8(c);
+    const char* p = begin;
+    for (; p + 16 <= end; p += 16) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, needle)));
+        if (mask != 0) {
+            return p + std::countr_zero(mask);
+        }
+    }
+    return findCharScalar(p, end, c);
+}
+
+/**
+ * @brief AVX2 kernel: compares 32 bytes per step and extracts a bitmask of matches.
+ */
+__attribute__((target("avx2")))
+static const char* findCharAVX2(const char* begin, const char* end, char c) {
+    const __m256i needle = _mm256_set1_epi8(c);
+    const char* p = begin;
+    for (; p + 32 <= end; p += 32) {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle)));
+        if (mask != 0) {
+            return p + std::countr_zero(mask);
+        }
+    }
+    return findCharSSE2(p, end, c);
+}
+#endif
+
+/**
+ * @brief Picks the widest kernel supported by the CPU.
+ */
+static ScanKernel detectScanKernel() {
+#ifdef CSV_SCAN_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return ScanKernel::AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return ScanKernel::SSE2;
+    }
+#endif
+    return ScanKernel::SCALAR;
+}
+
+static const ScanKernel selectedKernel = detectScanKernel();
+
+ScanKernel activeScanKernel() {
+    return selectedKernel;
+}
+
+const char* scanKernelName(ScanKernel kernel) {
+    switch (kernel) {
+        case ScanKernel::AVX2: return "AVX2";
+        case ScanKernel::SSE2: return "SSE2";
+        default: return "SCALAR";
+    }
+}
+
+const char* findChar(const char* begin, const char* end, char c) {
+    return findChar(selectedKernel, begin, end, c);
+}
+
+/**
+ * @brief Finds the first occurrence of a character with a specific kernel.
+ *
+ * Requests for a kernel wider than the one detected are served by the detected one.
+ */
+const char* findChar(ScanKernel kernel, const char* begin, const char* end, char c) {
+#ifdef CSV_SCAN_X86
+    if (kernel == ScanKernel::AVX2 && selectedKernel == ScanKernel::AVX2) {
+        return findCharAVX2(begin, end, c);
+    }
+    if (kernel != ScanKernel::SCALAR && selectedKernel != ScanKernel::SCALAR) {
+        return findCharSSE2(begin, end, c);
+    }
+#else
+    (void)kernel;
+#endif
+    return findCharScalar(begin, end, c);
+}
+
+/**
+ * @brief Converts eight ASCII digits at once.
+ *
+ * The digits are loaded into one 64-bit word. After subtracting '0' from every byte,
+ * adjacent digits are combined pairwise three times (1+1, 2+2, 4+4 digits) with one
+ * multiply and shift each.
+ */
+bool parseEightDigits(const char* digits, uint64_t& value) {
+    uint64_t chunk;
+    std::memcpy(&chunk, digits, sizeof(chunk));
+    if constexpr (std::endian::native == std::endian::big) {
+        chunk = __builtin_bswap64(chunk);
+    }
+
+    // Every byte must lie in '0'..'9': high nibble 3, and low nibble + 6 must not carry
+    if (((chunk & 0xF0F0F0F0F0F0F0F0ULL)
+         | (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) != 0x3333333333333333ULL) {
+        return false;
+    }
+
+    uint64_t low = chunk - 0x3030303030303030ULL;
+    low = (low * 10) + (low >> 8);
+    low = (((low & 0x000000FF000000FFULL) * 0x000F424000000064ULL)
+         + (((low >> 16) & 0x000000FF000000FFULL) * 0x0000271000000001ULL)) >> 32;
+    value = low;
+    return true;
+}
+
+/**
+ * @brief Converts a field of decimal digits to an unsigned value.
+ *
+ * Converts eight digits per step, then finishes the remaining digits one at a time.
+ * Fields longer than 19 digits may overflow and are handed to std::from_chars.
+ */
+bool parseUnsigned(std::string_view field, uint64_t& value) {
+    if (field.empty()) {
+        return false;
+    }
+    if (field.size() > 19) {
+        auto [end, ec] = std::from_chars(field.data(), field.data() + field.size(), value);
+        return ec == std::errc() && end == field.data() + field.size();
+    }
+
+    const char* p = field.data();
+    const char* end = p + field.size();
+    uint64_t result = 0;
+    uint64_t eight;
+    for (; p + 8 <= end; p += 8) {
+        if (!parseEightDigits(p, eight)) {
+            return false;
+        }
+        result = result * 100000000ULL + eight;
+    }
+    for (; p < end; ++p) {
+        unsigned digit = static_cast<unsigned char>(*p) - '0';
+        if (digit > 9) {
+            return false;
+        }
+        result = result * 10 + digit;
+    }
+    value = result;
+    return true;
+}
@@ -0,0 +1,66 @@
+/**
+ * @file csv_scan.hpp
+ * @brief Vectorized scanning and digit conversion primitives used by the CSV reader.
+ *
+ * The delimiter search compares 16 (SSE2) or 32 (AVX2) bytes at a time against the
+ * wanted character and turns the comparison into a bitmask whose lowest set bit is the
+ * match. The kernel is selected once at startup from the CPU features; a portable scalar
+ * kernel is used on other architectures. Integer fields are converted eight digits at a
+ * time with SWAR (SIMD within a register) arithmetic.
+ */
+#pragma once
+#include <cstdint>
+#include <string_view>
+
+/**
+ * @enum ScanKernel
+ * @brief Implementation used to search for delimiters
+ */
+enum class ScanKernel { SCALAR, SSE2, AVX2 };
+
+/**
+ * @brief Kernel selected for this CPU
+ */
+ScanKernel activeScanKernel();
+
+/**
+ * @brief Name of a scan kernel, for diagnostics
+ */
+const char* scanKernelName(ScanKernel kernel);
+
+/**
+ * @brief Finds the first occurrence of a character with the kernel selected for this CPU
+ *
+ * @param begin Start of the range
+ * @param end End of the range
+ * @param c The character to search for
+ * @return const char* Pointer to the first occurrence, end if not found
+ */
+const char* findChar(const char* begin, const char* end, char c);
+
+/**
+ * @brief Finds the first occurrence of a character with a specific kernel
+ *
+ * Kernels not supported by the CPU fall back to the scalar kernel.
+ */
+const char* findChar(ScanKernel kernel, const char* begin, const char* end, char c);
+
+/**
+ * @brief Converts exactly eight ASCII digits to their value
+ *
+ * @param digits Pointer to eight bytes
+ * @param value Receives the value
+ * @return bool False if any of the eight bytes is not a digit
+ */
+bool parseEightDigits(const char* digits, uint64_t& value);
+
+/**
+ * @brief Converts a field made only of decimal digits to an unsigned value
+ *
+ * Fields of up to 19 digits are converted eight digits at a time.
+ *
+ * @param field The field to convert
+ * @param value Receives the value
+ * @return bool False if the field is empty, contains a non-digit or does not fit
+ */
+bool parseUnsigned(std::string_view field, uint64_t& value);
@@ -4,8 +4,19 @@
  */
 
 #include "csv_writer.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
 #include <iostream>
 
+/**
+ * @brief Longest row produced by writeOrderResult, excluding the instrument
+ *
+ * Two 20-digit integers, three 11-character integers, two floats of at most 13 characters
+ * in general format, the longest enum names and the separators.
+ */
+static constexpr size_t MAX_ROW_SIZE = 2 * 20 + 3 * 11 + 2 * 13 + 4 + 6 + 6 + 18 + 12;
+
 /**
  * @brief Constructs a CSV writer for the specified file.
  * 
@@ -13,21 +24,93 @@
  * an error message is printed to standard error.
  * 
  * @param filename The path to the CSV file to be written.
+ * @param bufferSize Size of the output buffer in bytes.
+ * @param output Output backend options.
  */
-CSVWriter::CSVWriter(const std::string& filename) : filename_(filename) {
-    file_.open(filename);
-    if (!file_.is_open()) {
+CSVWriter::CSVWriter(const std::string& filename, size_t bufferSize, const OutputOptions& output)
+    : filename_(filename), buffer_(std::max(bufferSize, MAX_ROW_SIZE)) {
+    if (!file_.open(filename, output)) {
         std::cerr << "Erreur : impossible d'ouvrir le fichier CSV " << filename_ << std::endl;
     }
 }
 
 /**
- * @brief Destructor that closes the file if it's open.
+ * @brief Destructor that flushes the buffer and closes the file if it's open.
  */
 CSVWriter::~CSVWriter() {
-    if (file_.is_open()) {
-        file_.close();
+    drain();
+    file_.close();
+}
+
+/**
+ * @brief Hands the buffered rows to the output file in one call.
+ */
+void CSVWriter::drain() {
+    if (used_ > 0 && file_.isOpen()) {
+        file_.write(buffer_.data(), used_);
     }
+    used_ = 0;
+}
+
+/**
+ * @brief Writes the buffered rows and waits until the file has received them.
+ */
+void CSVWriter::flush() {
+    drain();
+    file_.flush();
+}
+
+/**
+ * @brief Drains the buffer if fewer than the specified number of bytes are free.
+ *
+ * Rows larger than the whole buffer grow it.
+ */
+void CSVWriter::reserve(size_t bytes) {
+    if (buffer_.size() - used_ < bytes) {
+        drain();
+        if (buffer_.size() < bytes) {
+            buffer_.resize(bytes);
+        }
+    }
+}
+
+/**
+ * @brief Appends raw characters to a row being formatted.
+ */
+static char* append(char* out, std::string_view text) {
+    std::memcpy(out, text.data(), text.size());
+    return out + text.size();
+}
+
+/**
+ * @brief Appends an integer followed by a comma.
+ */
+template <typename T>
+static char* appendField(char* out, T value) {
+    out = std::to_chars(out, out + 20, value).ptr;
+    *out++ = ',';
+    return out;
+}
+
+/**
+ * @brief Appends a price followed by a comma.
+ *
+ * Uses the general format with 6 significant digits, matching the default
+ * formatting of std::ostream.
+ */
+static char* appendField(char* out, float value) {
+    out = std::to_chars(out, out + 13, value, std::chars_format::general, 6).ptr;
+    *out++ = ',';
+    return out;
+}
+
+/**
+ * @brief Appends an enum name followed by a comma.
+ */
+static char* appendField(char* out, std::string_view name) {
+    out = append(out, name);
+    *out++ = ',';
+    return out;
 }
 
 /**
@@ -36,28 +119,38 @@ CSVWriter::~CSVWriter() {
  * Writes a comma-separated list of column names as the first row in the CSV file.
  */
 void CSVWriter::writeHeader() {
-    file_ << "timestamp,order_id,instrument,side,type,quantity,price,action,status,executed_quantity,execution_price,counterparty_id" << std::endl;
+    static constexpr std::string_view header =
+        "timestamp,order_id,instrument,side,type,quantity,price,action,status,executed_quantity,execution_price,counterparty_id\n";
+    reserve(header.size());
+    append(buffer_.data() + used_, header);
+    used_ += header.size();
 }
 
 /**
  * @brief Writes an order result to the CSV file.
  * 
- * Formats and writes all fields of the OrderResult to the CSV file as a single row.
- * Uses the conversion functions from order.hpp to convert enum values to their string representations.
+ * Formats all fields of the OrderResult directly into the output buffer as a single row.
+ * Enum values are written from the constant name tables of order.hpp.
  * 
  * @param result The OrderResult to write.
  */
 void CSVWriter::writeOrderResult(const OrderResult& result) {
-    file_ << result.timestamp << ","
-          << result.order_id << ","
-          << result.instrument << ","
-          << sideToString(result.side) << ","
-          << typeToString(result.type) << ","
-          << result.quantity << ","
-          << result.price << ","
-          << actionToString(result.action) << ","
-          << statusToString(result.status) << ","
-          << result.executed_quantity << ","
-          << result.execution_price << ","
-          << result.counterparty_id << std::endl;
+    reserve(MAX_ROW_SIZE + result.instrument.size());
+
+    char* begin = buffer_.data() + used_;
+    char* out = begin;
+    out = appendField(out, result.timestamp);
+    out = appendField(out, result.order_id);
+    out = appendField(out, std::string_view(result.instrument));
+    out = appendField(out, sideName(result.side));
+    out = appendField(out, typeName(result.type));
+    out = appendField(out, result.quantity);
+    out = appendField(out, result.price);
+    out = appendField(out, actionName(result.action));
+    out = appendField(out, statusName(result.status));
+    out = appendField(out, result.executed_quantity);
+    out = appendField(out, result.execution_price);
+    out = appendField(out, result.counterparty_id);
+    out[-1] = '\n';
+    used_ += static_cast<size_t>(out - begin);
 }
@@ -4,13 +4,17 @@
  * 
  * This file provides functionality to write the results of order processing by the matching
  * engine to CSV files. It uses the OrderResult structure and enum conversions defined in order.hpp.
+ *
+ * Rows are formatted with std::to_chars into a user-space buffer that is handed to the
+ * OutputFile only when it fills up, on flush() or when the writer is destroyed.
  */
 
 #pragma once
 #include <string>
 #include <vector>
-#include <fstream>
 #include "order.hpp"
+#include "output_file.hpp"
+#include "result_writer.hpp"
 
 /**
  * @class CSVWriter
@@ -20,16 +24,24 @@
  * includes all the original order information plus execution details.
  * It uses the OrderResult structure and related enums defined in order.hpp.
  */
-class CSVWriter {
+class CSVWriter : public ResultWriter {
 public:
     /**
      * @brief Constructs a CSV writer for the specified file.
      * @param filename The path to the CSV file to be written.
+     * @param bufferSize Size of the output buffer in bytes.
+     * @param output Output backend options.
      */
-    explicit CSVWriter(const std::string& filename);
+    explicit CSVWriter(const std::string& filename, size_t bufferSize = DEFAULT_BUFFER_SIZE,
+                       const OutputOptions& output = OutputOptions());
     
     /**
-     * @brief Destructor that closes the file if it's open.
+     * @brief Default size of the output buffer
+     */
+    static constexpr size_t DEFAULT_BUFFER_SIZE = 1 << 20;
+
+    /**
+     * @brief Destructor that flushes the buffer and closes the file if it's open.
      */
     ~CSVWriter();
     
@@ -42,9 +54,26 @@ public:
      * @brief Writes an order result to the CSV file.
      * @param result The OrderResult to write.
      */
-    void writeOrderResult(const OrderResult& result);
+    void writeOrderResult(const OrderResult& result) override;
+
+    /**
+     * @brief Writes the buffered rows to the file and waits for the writes to complete.
+     */
+    void flush() override;
     
 private:
-    std::string filename_;   ///< The path to the CSV file
-    std::ofstream file_;     ///< The output file stream
+    /**
+     * @brief Makes room for at least the specified number of bytes in the buffer.
+     */
+    void reserve(size_t bytes);
+
+    /**
+     * @brief Hands the buffered rows to the output file.
+     */
+    void drain();
+
+    std::string filename_;       ///< The path to the CSV file
+    OutputFile file_;            ///< The output file
+    std::vector<char> buffer_;   ///< Formatted rows not yet written
+    size_t used_ = 0;            ///< Number of bytes used in the buffer
 };
@@ -0,0 +1,109 @@
+/**
+ * @file engine_config.cpp
+ * @brief Implementation of the EngineConfig profile loader.
+ */
+
+#include "engine_config.hpp"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief Estimates the number of price levels per side.
+ *
+ * Uses the price range divided by the tick size when both are given, and falls back
+ * to one level per expected order otherwise.
+ *
+ * @return The expected number of levels per side.
+ */
+size_t InstrumentConfig::expectedLevels() const {
+    if (tick_size > 0.0 && max_price > min_price) {
+        size_t levels = static_cast<size_t>(std::floor((max_price - min_price) / tick_size)) + 1;
+        return std::min(levels, expected_orders);
+    }
+    return expected_orders;
+}
+
+/**
+ * @brief Loads a configuration profile from a CSV file.
+ *
+ * Skips the header row and converts each subsequent row into an InstrumentConfig.
+ * Rows that cannot be converted are reported on standard error and skipped.
+ *
+ * @param filename The path to the configuration file.
+ * @return The loaded profile.
+ */
+EngineConfig EngineConfig::load(const std::string& filename) {
+    EngineConfig config;
+    std::ifstream file(filename);
+    std::string line;
+
+    if (!file.is_open()) {
+        std::cerr << "Erreur : impossible d'ouvrir le fichier de configuration " << filename << std::endl;
+        return config;
+    }
+
+    // Skip the header line
+    std::getline(file, line);
+    size_t lineNumber = 1;
+
+    while (std::getline(file, line)) {
+        ++lineNumber;
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::stringstream ss(line);
+        std::string token;
+        std::vector<std::string> fields;
+        while (std::getline(ss, token, ',')) {
+            fields.push_back(token);
+        }
+
+        // A short or long row would otherwise shift or reuse fields
+        if (fields.size() != 5) {
+            std::cerr << "Erreur : ligne " << lineNumber << " invalide dans " << filename << std::endl;
+            continue;
+        }
+
+        InstrumentConfig instrument;
+        try {
+            instrument.instrument = fields[0];
+            instrument.expected_orders = std::stoull(fields[1]);
+            instrument.min_price = std::stod(fields[2]);
+            instrument.max_price = std::stod(fields[3]);
+            instrument.tick_size = std::stod(fields[4]);
+        } catch (const std::exception&) {
+            std::cerr << "Erreur : ligne " << lineNumber << " invalide dans " << filename << std::endl;
+            continue;
+        }
+
+        if (instrument.instrument.empty() || instrument.tick_size < 0.0) {
+            std::cerr << "Erreur : ligne " << lineNumber << " invalide dans " << filename << std::endl;
+            continue;
+        }
+
+        config.instruments.push_back(instrument);
+    }
+
+    return config;
+}
+
+/**
+ * @brief Finds the configuration of an instrument.
+ *
+ * @param instrument The instrument identifier.
+ * @return Pointer to the configuration, nullptr if the instrument is not configured.
+ */
+const InstrumentConfig* EngineConfig::find(const std::string& instrument) const {
+    for (const auto& config : instruments) {
+        if (config.instrument == instrument) {
+            return &config;
+        }
+    }
+    return nullptr;
+}
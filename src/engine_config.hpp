@@ -0,0 +1,60 @@
+/**
+ * @file engine_config.hpp
+ * @brief Defines the EngineConfig profile used to pre-size the matching engine at startup.
+ *
+ * The profile lists the instruments expected during the session together with sizing hints
+ * (expected live orders, price range) and the tick size of each instrument. It is loaded from
+ * a CSV file with the following columns:
+ *
+ *     instrument,expected_orders,min_price,max_price,tick_size
+ */
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @struct InstrumentConfig
+ * @brief Sizing hints and trading parameters for one instrument
+ */
+struct InstrumentConfig {
+    std::string instrument;        // Trading instrument (e.g., "AAPL")
+    size_t expected_orders = 0;    // Expected number of live orders in the book
+    double min_price = 0.0;        // Lower bound of the expected price range
+    double max_price = 0.0;        // Upper bound of the expected price range
+    double tick_size = 0.0;        // Minimum price increment (0 disables tick checks)
+
+    /**
+     * @brief Estimate the number of price levels per side from the price range and tick size
+     *
+     * @return size_t Expected number of levels, bounded by the expected number of orders
+     */
+    size_t expectedLevels() const;
+};
+
+/**
+ * @class EngineConfig
+ * @brief Configuration profile for MatchingEngine
+ */
+class EngineConfig {
+public:
+    std::vector<InstrumentConfig> instruments;  ///< Instruments expected during the session
+
+    /**
+     * @brief Load a configuration profile from a CSV file
+     *
+     * Malformed rows are reported on standard error and skipped.
+     *
+     * @param filename The path to the configuration file
+     * @return EngineConfig The loaded profile, empty if the file cannot be opened
+     */
+    static EngineConfig load(const std::string& filename);
+
+    /**
+     * @brief Find the configuration of an instrument
+     *
+     * @param instrument The instrument identifier
+     * @return const InstrumentConfig* Pointer to the configuration, nullptr if not found
+     */
+    const InstrumentConfig* find(const std::string& instrument) const;
+};
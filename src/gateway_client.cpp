@@ -0,0 +1,110 @@
+/**
+ * @file gateway_client.cpp
+ * @brief Implementation of the blocking gateway client.
+ */
+
+#include "gateway_client.hpp"
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+GatewayClient::~GatewayClient() {
+    close();
+}
+
+bool GatewayClient::connect(uint16_t port) {
+    close();
+    fd_ = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd_ < 0) {
+        std::cerr << "Erreur : impossible de créer le socket : " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(port);
+    if (::connect(fd_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+        std::cerr << "Erreur : impossible de se connecter au port " << port << " : " << std::strerror(errno) << std::endl;
+        close();
+        return false;
+    }
+    int enable = 1;
+    setsockopt(fd_, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+    return true;
+}
+
+bool GatewayClient::sendOrders(const std::vector<Order>& orders) {
+    out_.resize(orders.size() * sizeof(OrderMessage));
+    OrderMessage message;
+    for (size_t i = 0; i < orders.size(); ++i) {
+        if (!encodeOrder(orders[i], message)) {
+            std::cerr << "Erreur : symbole trop long pour l'ordre " << orders[i].order_id << std::endl;
+            return false;
+        }
+        std::memcpy(out_.data() + i * sizeof(OrderMessage), &message, sizeof(message));
+    }
+    return sendRaw(out_.data(), out_.size());
+}
+
+bool GatewayClient::sendRaw(const void* data, size_t size) {
+    const char* bytes = static_cast<const char*>(data);
+    while (size > 0) {
+        ssize_t sent = send(fd_, bytes, size, MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        bytes += sent;
+        size -= static_cast<size_t>(sent);
+    }
+    return true;
+}
+
+/**
+ * @brief Reads whatever is available and keeps a partial report for the next call.
+ */
+size_t GatewayClient::receive(std::vector<ExecutionReport>& reports, bool wait) {
+    size_t appended = 0;
+    while (fd_ >= 0) {
+        size_t used = in_.size();
+        in_.resize(used + 65536);
+        ssize_t got = recv(fd_, in_.data() + used, 65536, wait && appended == 0 ? 0 : MSG_DONTWAIT);
+        if (got <= 0) {
+            in_.resize(used);
+            if (got < 0 && errno == EINTR) {
+                continue;
+            }
+            if (got == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+                close();
+            }
+            break;
+        }
+        in_.resize(used + static_cast<size_t>(got));
+
+        size_t offset = 0;
+        while (in_.size() - offset >= sizeof(ExecutionReport)) {
+            ExecutionReport report;
+            std::memcpy(&report, in_.data() + offset, sizeof(report));
+            reports.push_back(report);
+            offset += sizeof(report);
+            ++appended;
+        }
+        in_.erase(in_.begin(), in_.begin() + static_cast<std::ptrdiff_t>(offset));
+    }
+    return appended;
+}
+
+void GatewayClient::close() {
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+    in_.clear();
+}
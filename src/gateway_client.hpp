@@ -0,0 +1,66 @@
+/**
+ * @file gateway_client.hpp
+ * @brief Defines the GatewayClient class, a blocking client of the order-entry gateway.
+ */
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "gateway_protocol.hpp"
+
+/**
+ * @class GatewayClient
+ * @brief Sends orders to an OrderGateway on 127.0.0.1 and reads its reports
+ */
+class GatewayClient {
+public:
+    GatewayClient() = default;
+
+    /**
+     * @brief Destructor that closes the connection
+     */
+    ~GatewayClient();
+
+    GatewayClient(const GatewayClient&) = delete;
+    GatewayClient& operator=(const GatewayClient&) = delete;
+
+    /**
+     * @brief Connects to the gateway listening on the given local port
+     * @return bool False if the connection failed
+     */
+    bool connect(uint16_t port);
+
+    /**
+     * @brief Sends orders, all encoded into a single write
+     * @return bool False if an order could not be encoded or the connection failed
+     */
+    bool sendOrders(const std::vector<Order>& orders);
+
+    /**
+     * @brief Sends raw bytes, for tests of malformed input
+     * @return bool False if the connection failed
+     */
+    bool sendRaw(const void* data, size_t size);
+
+    /**
+     * @brief Appends the complete reports received so far
+     * @param reports Vector the reports are appended to
+     * @param wait Blocks until at least one report arrives if true
+     * @return size_t Number of reports appended; 0 if the connection was closed
+     */
+    size_t receive(std::vector<ExecutionReport>& reports, bool wait = true);
+
+    /**
+     * @brief Closes the connection
+     */
+    void close();
+
+    /**
+     * @brief Checks whether the client is connected
+     */
+    bool isOpen() const { return fd_ >= 0; }
+
+private:
+    int fd_ = -1;
+    std::vector<char> in_;   ///< Received bytes not yet split into reports
+    std::vector<char> out_;  ///< Encoding buffer, reused
+};
@@ -0,0 +1,56 @@
+/**
+ * @file gateway_protocol.cpp
+ * @brief Conversion between orders, results and gateway messages.
+ */
+
+#include "gateway_protocol.hpp"
+#include <cstring>
+
+bool encodeOrder(const Order& order, OrderMessage& message) {
+    if (order.instrument.size() > BINARY_SYMBOL_SIZE) {
+        return false;
+    }
+    std::memset(&message, 0, sizeof(message));
+    message.header.length = sizeof(OrderMessage);
+    message.header.type = static_cast<uint8_t>(MessageType::ORDER);
+    message.order_id = order.order_id;
+    message.timestamp = order.timestamp;
+    message.quantity = order.quantity;
+    message.price = order.price;
+    std::memcpy(message.instrument, order.instrument.data(), order.instrument.size());
+    message.side = static_cast<uint8_t>(order.side);
+    message.type = static_cast<uint8_t>(order.type);
+    message.action = static_cast<uint8_t>(order.action);
+    return true;
+}
+
+/**
+ * @brief Decodes an order, refusing enum values the engine does not know.
+ */
+bool decodeOrder(const OrderMessage& message, Order& order) {
+    if (message.side > static_cast<uint8_t>(Side::SELL) || message.type > static_cast<uint8_t>(Type::LIMIT)
+        || message.action > static_cast<uint8_t>(Action::CANCEL) || message.instrument[0] == '\0') {
+        return false;
+    }
+    order.timestamp = message.timestamp;
+    order.order_id = message.order_id;
+    order.instrument.assign(message.instrument, strnlen(message.instrument, BINARY_SYMBOL_SIZE));
+    order.side = static_cast<Side>(message.side);
+    order.type = static_cast<Type>(message.type);
+    order.quantity = message.quantity;
+    order.price = message.price;
+    order.action = static_cast<Action>(message.action);
+    return true;
+}
+
+void encodeReport(const OrderResult& result, MessageType type, ExecutionReport& report) {
+    std::memset(&report, 0, sizeof(report));
+    report.header.length = sizeof(ExecutionReport);
+    report.header.type = static_cast<uint8_t>(type);
+    report.order_id = result.order_id;
+    report.timestamp = result.timestamp;
+    report.status = static_cast<uint8_t>(result.status);
+    report.executed_quantity = result.executed_quantity;
+    report.execution_price = result.execution_price;
+    report.counterparty_id = result.counterparty_id;
+}
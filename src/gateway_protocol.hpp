@@ -0,0 +1,94 @@
+/**
+ * @file gateway_protocol.hpp
+ * @brief Defines the binary messages exchanged with the order-entry gateway.
+ *
+ * Every message starts with a MessageHeader whose length field is the size of the whole
+ * message, so a reader can split a byte stream into messages without knowing every type.
+ * Messages are fixed-size little-endian structs, sent back to back on the connection:
+ * - clients send ORDER messages (OrderMessage),
+ * - the gateway answers each order with one ACK (ExecutionReport) to the sending session,
+ *   and sends a FILL to the owner of every resting order the order executed against.
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "binary_format.hpp"
+#include "order.hpp"
+
+/**
+ * @enum MessageType
+ * @brief Type byte of a gateway message
+ */
+enum class MessageType : uint8_t {
+    ORDER = 'O',  // New, modify or cancel request, client to gateway
+    ACK = 'A',    // Result of a request, to the session that sent it
+    FILL = 'F'    // Execution of a resting order, to the session that owns it
+};
+
+/**
+ * @brief Largest message the gateway accepts
+ */
+constexpr size_t MAX_MESSAGE_SIZE = 256;
+
+/**
+ * @struct MessageHeader
+ * @brief Common prefix of every message
+ */
+struct MessageHeader {
+    uint16_t length;   // Size of the whole message, header included
+    uint8_t type;      // MessageType value
+    uint8_t reserved;  // Always zero
+};
+
+/**
+ * @struct OrderMessage
+ * @brief Order request sent by a client
+ */
+struct OrderMessage {
+    MessageHeader header;
+    int32_t order_id;                     // Unique order identifier
+    uint64_t timestamp;                   // Timestamp in nanoseconds
+    int32_t quantity;                     // Number of units
+    float price;                          // Price per unit (ignored for MARKET orders)
+    char instrument[BINARY_SYMBOL_SIZE];  // Symbol, zero-padded
+    uint8_t side;                         // Side enum value
+    uint8_t type;                         // Type enum value
+    uint8_t action;                       // Action enum value
+    uint8_t reserved[5];                  // Padding, always zero
+};
+
+/**
+ * @struct ExecutionReport
+ * @brief Result of processing an order, sent as an ACK or a FILL
+ */
+struct ExecutionReport {
+    MessageHeader header;
+    int32_t order_id;           // Order the report is about
+    uint64_t timestamp;         // Timestamp of the order
+    uint8_t status;             // OrderStatus enum value
+    uint8_t reserved[3];        // Padding, always zero
+    int32_t executed_quantity;  // Quantity executed by this event
+    float execution_price;      // Price of the execution
+    int32_t counterparty_id;    // Order on the other side of the execution
+};
+
+static_assert(sizeof(MessageHeader) == 4, "Unexpected message header size");
+static_assert(sizeof(OrderMessage) == 48, "Unexpected order message size");
+static_assert(sizeof(ExecutionReport) == 32, "Unexpected execution report size");
+
+/**
+ * @brief Encodes an order as an ORDER message
+ * @return bool False if the instrument symbol does not fit in the message
+ */
+bool encodeOrder(const Order& order, OrderMessage& message);
+
+/**
+ * @brief Decodes an ORDER message
+ * @return bool False if the message carries an unknown enum value or no instrument
+ */
+bool decodeOrder(const OrderMessage& message, Order& order);
+
+/**
+ * @brief Encodes an order result as an ACK or FILL report
+ */
+void encodeReport(const OrderResult& result, MessageType type, ExecutionReport& report);
@@ -0,0 +1,34 @@
+/**
+ * @file latency_stats.cpp
+ * @brief Implementation of the latency summary.
+ */
+
+#include "latency_stats.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+double percentile(const std::vector<double>& sorted, double fraction) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    double rank = std::ceil(fraction * static_cast<double>(sorted.size()));
+    size_t index = rank < 1.0 ? 0 : static_cast<size_t>(rank) - 1;
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+LatencySummary summarizeLatencies(std::vector<double>& samples) {
+    LatencySummary summary;
+    if (samples.empty()) {
+        return summary;
+    }
+    std::sort(samples.begin(), samples.end());
+    summary.count = samples.size();
+    summary.mean = std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<double>(samples.size());
+    summary.p50 = percentile(samples, 0.50);
+    summary.p90 = percentile(samples, 0.90);
+    summary.p99 = percentile(samples, 0.99);
+    summary.p999 = percentile(samples, 0.999);
+    summary.max = samples.back();
+    return summary;
+}
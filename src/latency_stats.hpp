@@ -0,0 +1,39 @@
+/**
+ * @file latency_stats.hpp
+ * @brief Summary statistics of latency samples.
+ */
+#pragma once
+#include <cstddef>
+#include <vector>
+
+/**
+ * @struct LatencySummary
+ * @brief Distribution of a set of latency samples, in the unit of the samples
+ */
+struct LatencySummary {
+    size_t count = 0;   // Number of samples
+    double mean = 0.0;  // Arithmetic mean
+    double p50 = 0.0;   // Median
+    double p90 = 0.0;   // 90th percentile
+    double p99 = 0.0;   // 99th percentile
+    double p999 = 0.0;  // 99.9th percentile
+    double max = 0.0;   // Largest sample
+};
+
+/**
+ * @brief Computes the distribution of latency samples
+ *
+ * Percentiles use the nearest-rank method on the sorted samples.
+ *
+ * @param samples The samples; sorted in place
+ * @return LatencySummary All zeros if there are no samples
+ */
+LatencySummary summarizeLatencies(std::vector<double>& samples);
+
+/**
+ * @brief Nearest-rank percentile of sorted samples
+ * @param sorted Samples in ascending order
+ * @param fraction Percentile as a fraction, e.g. 0.99
+ * @return double The percentile, 0 if there are no samples
+ */
+double percentile(const std::vector<double>& sorted, double fraction);
@@ -0,0 +1,260 @@
+/**
+ * @file logger.cpp
+ * @brief Implementation of the asynchronous Logger.
+ */
+
+#include "logger.hpp"
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <iostream>
+
+/**
+ * @brief Number of records in each thread's ring
+ */
+static constexpr size_t RING_CAPACITY = 8192;
+
+/**
+ * @struct Logger::Format
+ * @brief Registered format string split into literal text and placeholders
+ */
+struct Logger::Format {
+    /**
+     * @brief Literal text followed by a placeholder
+     */
+    struct Segment {
+        std::string text;     // Text before the placeholder
+        int precision = -1;   // Decimals of a {:.Nf} placeholder, -1 for {}
+        bool hasArg = false;  // False for the trailing text
+    };
+    std::vector<Segment> segments;
+};
+
+bool parseLogLevel(std::string_view name, LogLevel& level) {
+    constexpr std::string_view names[] = {"trace", "debug", "info", "warn", "error", "off"};
+    for (size_t i = 0; i < std::size(names); ++i) {
+        if (name == names[i]) {
+            level = static_cast<LogLevel>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+Logger& Logger::instance() {
+    static Logger logger;
+    return logger;
+}
+
+Logger::Logger()
+    : level_(LogLevel::INFO), blockWhenFull_(false), dropped_(0), out_(&std::cout) {
+    thread_ = std::thread(&Logger::run, this);
+}
+
+Logger::~Logger() {
+    {
+        std::lock_guard<std::mutex> lock(stateMutex_);
+        stop_ = true;
+    }
+    wake_.notify_one();
+    thread_.join();
+}
+
+void Logger::setOutput(std::ostream& out) {
+    flush();
+    std::lock_guard<std::mutex> lock(stateMutex_);
+    out_ = &out;
+}
+
+/**
+ * @brief Splits a format string into segments once, at registration.
+ */
+uint16_t Logger::registerFormat(const char* format) {
+    auto parsed = std::make_unique<Format>();
+    std::string_view rest(format);
+    Format::Segment segment;
+    while (!rest.empty()) {
+        size_t open = rest.find('{');
+        size_t close = open == std::string_view::npos ? open : rest.find('}', open);
+        if (close == std::string_view::npos) {
+            break;
+        }
+        segment.text.append(rest.substr(0, open));
+        std::string_view spec = rest.substr(open + 1, close - open - 1);
+        if (spec.size() >= 4 && spec.substr(0, 2) == ":." && spec.back() == 'f') {
+            std::from_chars(spec.data() + 2, spec.data() + spec.size() - 1, segment.precision);
+        }
+        segment.hasArg = true;
+        parsed->segments.push_back(std::move(segment));
+        segment = Format::Segment();
+        rest.remove_prefix(close + 1);
+    }
+    segment.text.append(rest);
+    parsed->segments.push_back(std::move(segment));
+
+    std::lock_guard<std::mutex> lock(formatsMutex_);
+    formats_.push_back(std::move(parsed));
+    return static_cast<uint16_t>(formats_.size() - 1);
+}
+
+void Logger::putString(LogRecord& record, std::string_view text) {
+    if (record.size + 1 + sizeof(uint16_t) > LogRecord::PAYLOAD_SIZE) {
+        return;
+    }
+    size_t room = LogRecord::PAYLOAD_SIZE - record.size - 1 - sizeof(uint16_t);
+    uint16_t length = static_cast<uint16_t>(std::min(text.size(), room));
+    record.payload[record.size++] = static_cast<char>(ArgType::STRING);
+    std::memcpy(record.payload + record.size, &length, sizeof(length));
+    record.size += sizeof(length);
+    std::memcpy(record.payload + record.size, text.data(), length);
+    record.size += length;
+}
+
+/**
+ * @brief Pushes a record into the calling thread's ring.
+ *
+ * The ring is created and registered on the thread's first record. A ring stays
+ * registered after its thread exits so that its last records are still written.
+ */
+void Logger::push(const LogRecord& record) {
+    thread_local std::shared_ptr<Ring> ring;
+    if (!ring) {
+        ring = std::make_shared<Ring>(RING_CAPACITY);
+        std::lock_guard<std::mutex> lock(ringsMutex_);
+        rings_.push_back(ring);
+    }
+    while (!ring->tryPush(record)) {
+        if (!blockWhenFull_.load(std::memory_order_relaxed)) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        wake_.notify_one();
+        std::this_thread::yield();
+    }
+}
+
+void Logger::flush() {
+    std::unique_lock<std::mutex> lock(stateMutex_);
+    if (stop_) {
+        return;
+    }
+    uint64_t generation = ++flushRequested_;
+    wake_.notify_one();
+    flushed_.wait(lock, [this, generation] { return flushCompleted_ >= generation; });
+}
+
+/**
+ * @brief Drains the rings until stopped, sleeping briefly when they are empty.
+ *
+ * Every pass empties all rings, so a flush requested before a pass is complete when
+ * the pass ends.
+ */
+void Logger::run() {
+    std::unique_lock<std::mutex> lock(stateMutex_);
+    while (true) {
+        uint64_t generation = flushRequested_;
+        bool stopping = stop_;
+        std::ostream* out = out_;
+        lock.unlock();
+
+        size_t written = 0;
+        while (size_t count = drain(*out)) {
+            written += count;
+        }
+
+        lock.lock();
+        if (generation > flushCompleted_) {
+            flushCompleted_ = generation;
+            flushed_.notify_all();
+        }
+        if (stopping) {
+            return;
+        }
+        if (written == 0) {
+            wake_.wait_for(lock, std::chrono::milliseconds(1),
+                           [this, generation] { return stop_ || flushRequested_ != generation; });
+        }
+    }
+}
+
+size_t Logger::drain(std::ostream& out) {
+    std::vector<std::shared_ptr<Ring>> rings;
+    {
+        std::lock_guard<std::mutex> lock(ringsMutex_);
+        rings = rings_;
+    }
+
+    size_t written = 0;
+    std::string text;
+    LogRecord record;
+    {
+        std::lock_guard<std::mutex> lock(formatsMutex_);
+        for (const auto& ring : rings) {
+            while (ring->tryPop(record)) {
+                format(record, text);
+                text.push_back('\n');
+                ++written;
+            }
+        }
+    }
+    if (written > 0) {
+        out.write(text.data(), static_cast<std::streamsize>(text.size()));
+        out.flush();
+    }
+    return written;
+}
+
+/**
+ * @brief Appends the text of a record, decoding its arguments in order.
+ */
+void Logger::format(const LogRecord& record, std::string& line) const {
+    if (record.formatId >= formats_.size()) {
+        return;
+    }
+    const Format& format = *formats_[record.formatId];
+    size_t position = 0;
+    char number[64];
+    for (const auto& segment : format.segments) {
+        line.append(segment.text);
+        if (!segment.hasArg || position >= record.size) {
+            continue;
+        }
+        auto type = static_cast<ArgType>(record.payload[position++]);
+        char* end = number;
+        switch (type) {
+            case ArgType::INT: {
+                int64_t value;
+                std::memcpy(&value, record.payload + position, sizeof(value));
+                position += sizeof(value);
+                end = std::to_chars(number, number + sizeof(number), value).ptr;
+                break;
+            }
+            case ArgType::UINT: {
+                uint64_t value;
+                std::memcpy(&value, record.payload + position, sizeof(value));
+                position += sizeof(value);
+                end = std::to_chars(number, number + sizeof(number), value).ptr;
+                break;
+            }
+            case ArgType::DOUBLE: {
+                double value;
+                std::memcpy(&value, record.payload + position, sizeof(value));
+                position += sizeof(value);
+                auto result = segment.precision >= 0
+                    ? std::to_chars(number, number + sizeof(number), value, std::chars_format::fixed, segment.precision)
+                    : std::to_chars(number, number + sizeof(number), value, std::chars_format::general, 6);
+                end = result.ec == std::errc() ? result.ptr : number;
+                break;
+            }
+            case ArgType::STRING: {
+                uint16_t length;
+                std::memcpy(&length, record.payload + position, sizeof(length));
+                position += sizeof(length);
+                line.append(record.payload + position, length);
+                position += length;
+                break;
+            }
+        }
+        line.append(number, end);
+    }
+}
@@ -0,0 +1,239 @@
+/**
+ * @file logger.hpp
+ * @brief Defines the asynchronous binary Logger and the ENGINE_LOG macros.
+ *
+ * Logging threads never format text. A log call copies a format id and its raw arguments
+ * into a fixed-size record in a ring owned by the calling thread; a background thread
+ * drains the rings, formats the records and writes them out. Each call site registers
+ * its format string once, the first time it is reached.
+ *
+ * The level is checked before the arguments are evaluated, so disabled levels cost one
+ * relaxed atomic load. Building with -DENGINE_LOGGING_DISABLED (make LOGGING=0) removes
+ * the calls entirely.
+ *
+ * Format strings use {} for each argument, or {:.Nf} for a float with N decimals.
+ */
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "spsc_queue.hpp"
+
+/**
+ * @enum LogLevel
+ * @brief Severity of a log record, in increasing order
+ */
+enum class LogLevel : uint8_t { TRACE, DEBUG, INFO, WARN, ERROR, OFF };
+
+/**
+ * @brief Parses a level name (trace, debug, info, warn, error, off)
+ * @return bool False if the name is unknown
+ */
+bool parseLogLevel(std::string_view name, LogLevel& level);
+
+/**
+ * @struct LogRecord
+ * @brief Fixed-size record holding a format id and its encoded arguments
+ */
+struct LogRecord {
+    static constexpr size_t PAYLOAD_SIZE = 116;
+
+    uint16_t formatId;               // Registered format of the call site
+    uint16_t size;                   // Bytes used in the payload
+    char payload[PAYLOAD_SIZE];      // Type-tagged arguments
+};
+
+static_assert(sizeof(LogRecord) == 120, "Unexpected log record size");
+
+/**
+ * @class Logger
+ * @brief Process-wide asynchronous logger with per-thread rings
+ */
+class Logger {
+public:
+    /**
+     * @brief Tag of an encoded argument
+     */
+    enum class ArgType : uint8_t { INT, UINT, DOUBLE, STRING };
+
+    /**
+     * @brief The process-wide logger, started on first use
+     */
+    static Logger& instance();
+
+    ~Logger();
+
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+    /**
+     * @brief Sets the minimum level of the records that are kept
+     */
+    void setLevel(LogLevel level) { level_.store(level, std::memory_order_relaxed); }
+
+    /**
+     * @brief Minimum level of the records that are kept
+     */
+    LogLevel level() const { return level_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Checks whether records of a level are kept
+     */
+    bool enabled(LogLevel level) const { return level >= level_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Sets the stream the background thread writes to (std::cout by default)
+     */
+    void setOutput(std::ostream& out);
+
+    /**
+     * @brief Wait for the background thread instead of dropping records when a ring is full
+     */
+    void setBlockWhenFull(bool block) { blockWhenFull_.store(block, std::memory_order_relaxed); }
+
+    /**
+     * @brief Registers the format string of a call site
+     * @return uint16_t The id to pass to log()
+     */
+    uint16_t registerFormat(const char* format);
+
+    /**
+     * @brief Encodes a record into the calling thread's ring
+     *
+     * Integers, floating-point numbers and strings are supported. Strings longer than the
+     * space left in the record are truncated.
+     */
+    template <typename... Args>
+    void log(uint16_t formatId, const Args&... args) {
+        LogRecord record;
+        record.formatId = formatId;
+        record.size = 0;
+        (encode(record, args), ...);
+        push(record);
+    }
+
+    /**
+     * @brief Waits until every record logged before the call has been written out
+     */
+    void flush();
+
+    /**
+     * @brief Number of records dropped because a ring was full
+     */
+    uint64_t droppedCount() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    struct Format;
+    using Ring = SPSCQueue<LogRecord>;
+
+    Logger();
+
+    /**
+     * @brief Encodes one argument with its type tag
+     */
+    template <typename T>
+    static void encode(LogRecord& record, const T& value) {
+        if constexpr (std::is_same_v<T, bool>) {
+            put(record, ArgType::UINT, static_cast<uint64_t>(value));
+        } else if constexpr (std::is_enum_v<T>) {
+            put(record, ArgType::INT, static_cast<int64_t>(value));
+        } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+            put(record, ArgType::INT, static_cast<int64_t>(value));
+        } else if constexpr (std::is_integral_v<T>) {
+            put(record, ArgType::UINT, static_cast<uint64_t>(value));
+        } else if constexpr (std::is_floating_point_v<T>) {
+            put(record, ArgType::DOUBLE, static_cast<double>(value));
+        } else {
+            putString(record, std::string_view(value));
+        }
+    }
+
+    /**
+     * @brief Appends a type tag and a fixed-size value, if there is room
+     */
+    template <typename T>
+    static void put(LogRecord& record, ArgType type, T value) {
+        if (record.size + 1 + sizeof(T) > LogRecord::PAYLOAD_SIZE) {
+            return;
+        }
+        record.payload[record.size++] = static_cast<char>(type);
+        std::memcpy(record.payload + record.size, &value, sizeof(T));
+        record.size += sizeof(T);
+    }
+
+    /**
+     * @brief Encodes a string argument as its length followed by its bytes
+     */
+    static void putString(LogRecord& record, std::string_view text);
+
+    /**
+     * @brief Pushes a record into the calling thread's ring, creating it on first use
+     */
+    void push(const LogRecord& record);
+
+    /**
+     * @brief Background thread loop
+     */
+    void run();
+
+    /**
+     * @brief Formats and writes every record currently in the rings
+     * @return size_t Number of records written
+     */
+    size_t drain(std::ostream& out);
+
+    /**
+     * @brief Appends the formatted text of a record; formatsMutex_ must be held
+     */
+    void format(const LogRecord& record, std::string& line) const;
+
+    std::atomic<LogLevel> level_;                ///< Minimum level kept
+    std::atomic<bool> blockWhenFull_;            ///< Wait instead of dropping on a full ring
+    std::atomic<uint64_t> dropped_;              ///< Records dropped on full rings
+    std::ostream* out_;                          ///< Destination of the formatted records
+
+    mutable std::mutex formatsMutex_;            ///< Protects formats_
+    std::vector<std::unique_ptr<Format>> formats_; ///< Registered formats, by id
+
+    std::mutex ringsMutex_;                      ///< Protects rings_
+    std::vector<std::shared_ptr<Ring>> rings_;   ///< One ring per logging thread
+
+    std::mutex stateMutex_;                      ///< Protects the flush and stop state
+    std::condition_variable wake_;               ///< Wakes the background thread
+    std::condition_variable flushed_;            ///< Signals completed flushes
+    uint64_t flushRequested_ = 0;                ///< Last flush generation requested
+    uint64_t flushCompleted_ = 0;                ///< Last flush generation completed
+    bool stop_ = false;                          ///< Asks the background thread to exit
+    std::thread thread_;                         ///< The background thread
+};
+
+#ifdef ENGINE_LOGGING_DISABLED
+#define ENGINE_LOG(level, format, ...) ((void)0)
+#else
+/**
+ * @brief Logs a record if its level is enabled; arguments are only evaluated when it is
+ */
+#define ENGINE_LOG(level, format, ...)                                                    \
+    do {                                                                                  \
+        Logger& engineLogger_ = Logger::instance();                                       \
+        if (engineLogger_.enabled(level)) {                                               \
+            static const uint16_t engineLogFormat_ = engineLogger_.registerFormat(format); \
+            engineLogger_.log(engineLogFormat_ __VA_OPT__(,) __VA_ARGS__);                \
+        }                                                                                 \
+    } while (0)
+#endif
+
+#define ENGINE_LOG_TRACE(format, ...) ENGINE_LOG(LogLevel::TRACE, format __VA_OPT__(,) __VA_ARGS__)
+#define ENGINE_LOG_DEBUG(format, ...) ENGINE_LOG(LogLevel::DEBUG, format __VA_OPT__(,) __VA_ARGS__)
+#define ENGINE_LOG_INFO(format, ...) ENGINE_LOG(LogLevel::INFO, format __VA_OPT__(,) __VA_ARGS__)
+#define ENGINE_LOG_WARN(format, ...) ENGINE_LOG(LogLevel::WARN, format __VA_OPT__(,) __VA_ARGS__)
+#define ENGINE_LOG_ERROR(format, ...) ENGINE_LOG(LogLevel::ERROR, format __VA_OPT__(,) __VA_ARGS__)
@@ -3,15 +3,27 @@
  * @brief Main entry point for the matching engine application.
  * 
  * This file implements the main function that orchestrates the flow of the application:
- * 1. Parsing order data from an input CSV file
- * 2. Processing orders through the matching engine
+ * 1. Parsing order data from an input CSV file (or reading a binary order file)
+ * 2. Processing orders through the matching engine, optionally on a parse/match/write pipeline
  * 3. Writing results to an output CSV file
  * 4. Displaying statistics and order book status
  */
 
+#include "async_result_writer.hpp"
+#include "binary_order_file.hpp"
+#include "binary_result_file.hpp"
 #include "csv_parser.hpp"
 #include "csv_writer.hpp"
+#include "engine_config.hpp"
+#include "logger.hpp"
+#include "market_data_publisher.hpp"
 #include "matching_engine.hpp"
+#include "pipeline.hpp"
+#include "snapshot.hpp"
+#include <algorithm>
+#include <memory>
+#include <span>
+#include <unordered_set>
 #include <iostream>
 #include <iomanip>
 #include <vector>
@@ -19,45 +31,6 @@
 #include <chrono>
 #include <ctime>
 
-/**
- * @brief Helper function to print order details to the console.
- * 
- * Formats and displays the key attributes of an order for debugging purposes.
- * 
- * @param order The order to display.
- */
-void printOrder(const Order& order) {
-    std::cout << "Order #" << order.order_id << " - "
-              << sideToString(order.side) << " " 
-              << order.quantity << " "
-              << order.instrument << " @ "
-              << std::fixed << std::setprecision(2) << order.price
-              << " [" << actionToString(order.action) << "] "
-              << (order.type == Type::MARKET ? "MARKET" : "LIMIT")
-              << std::endl;
-}
-
-/**
- * @brief Helper function to print order result details to the console.
- * 
- * Formats and displays the results of order processing, including execution
- * information if applicable.
- * 
- * @param result The order result to display.
- */
-void printOrderResult(const OrderResult& result) {
-    std::cout << "Result for Order #" << result.order_id << ": "
-              << statusToString(result.status);
-    
-    if (result.executed_quantity > 0) {
-        std::cout << " - Executed " << result.executed_quantity 
-                  << " @ " << std::fixed << std::setprecision(2) << result.execution_price
-                  << " (Counterparty: " << result.counterparty_id << ")";
-    }
-    
-    std::cout << std::endl;
-}
-
 /**
  * @brief Main function - entry point of the application.
  * 
@@ -67,44 +40,273 @@ void printOrderResult(const OrderResult& result) {
  */
 int main(int argc, char* argv[]) {
     // Check arguments
-    if (argc != 3) {
-        std::cerr << "Usage: " << argv[0] << " <input_file> <output_file>" << std::endl;
+    if (argc < 3) {
+        std::cerr << "Usage: " << argv[0] << " <input_file> <output_file> [--config <file>] [--mmap] [--batch-size <n>] [--parse-threads <n>] [--snapshot-every <n>] [--output-policy block|drop] [--output-format csv|binary] [--direct-io] [--no-io-uring] [--pipeline] [--log-level <level>] [--market-data <shm-name>] [--market-data-udp <address>:<port>]" << std::endl;
         return 1;
     }
 
     std::string inputFile = argv[1];
     std::string outputFile = argv[2];
     
+    // Parse options
+    std::string configFile;
+    bool useMmap = false;
+    size_t batchSize = 4096;
+    unsigned parseThreads = 1;
+    size_t snapshotEvery = 0;
+    Backpressure outputPolicy = Backpressure::BLOCK;
+    bool outputPolicySet = false;
+    bool binaryOutput = false;
+    OutputOptions outputOptions;
+    bool pipelined = false;
+    LogLevel logLevel = LogLevel::DEBUG;
+    MarketDataOptions marketDataOptions;
+    for (int i = 3; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--config" && i + 1 < argc) {
+            configFile = argv[++i];
+        } else if (arg == "--mmap") {
+            useMmap = true;
+        } else if (arg == "--parse-threads" && i + 1 < argc) {
+            parseThreads = static_cast<unsigned>(std::stoul(argv[++i]));
+        } else if (arg == "--batch-size" && i + 1 < argc) {
+            batchSize = std::max<size_t>(1, std::stoul(argv[++i]));
+        } else if (arg == "--snapshot-every" && i + 1 < argc) {
+            snapshotEvery = std::stoul(argv[++i]);
+        } else if (arg == "--output-policy" && i + 1 < argc) {
+            std::string policy = argv[++i];
+            if (policy != "block" && policy != "drop") {
+                std::cerr << "Unknown output policy: " << policy << std::endl;
+                return 1;
+            }
+            outputPolicy = policy == "drop" ? Backpressure::DROP : Backpressure::BLOCK;
+            outputPolicySet = true;
+        } else if (arg == "--output-format" && i + 1 < argc) {
+            std::string format = argv[++i];
+            if (format != "csv" && format != "binary") {
+                std::cerr << "Unknown output format: " << format << std::endl;
+                return 1;
+            }
+            binaryOutput = format == "binary";
+        } else if (arg == "--direct-io") {
+            outputOptions.directIo = true;
+        } else if (arg == "--no-io-uring") {
+            outputOptions.useIoUring = false;
+        } else if (arg == "--pipeline") {
+            pipelined = true;
+        } else if (arg == "--market-data" && i + 1 < argc) {
+            marketDataOptions.ringName = argv[++i];
+        } else if (arg == "--market-data-udp" && i + 1 < argc) {
+            std::string destination = argv[++i];
+            size_t colon = destination.rfind(':');
+            if (colon == std::string::npos) {
+                std::cerr << "Invalid market-data destination: " << destination << std::endl;
+                return 1;
+            }
+            marketDataOptions.udpAddress = destination.substr(0, colon);
+            marketDataOptions.udpPort = static_cast<uint16_t>(std::stoul(destination.substr(colon + 1)));
+        } else if (arg == "--log-level" && i + 1 < argc) {
+            std::string level = argv[++i];
+            if (!parseLogLevel(level, logLevel)) {
+                std::cerr << "Unknown log level: " << level << std::endl;
+                return 1;
+            }
+        } else {
+            std::cerr << "Unknown option: " << arg << std::endl;
+            return 1;
+        }
+    }
+    
+    // The pipeline parses on one thread and its writer stage always waits for the file
+    if (pipelined && parseThreads > 1) {
+        std::cerr << "--parse-threads cannot be combined with --pipeline" << std::endl;
+        return 1;
+    }
+    if (pipelined && outputPolicySet) {
+        std::cerr << "--output-policy cannot be combined with --pipeline" << std::endl;
+        return 1;
+    }
+    
+#ifndef ENGINE_LOGGING_DISABLED
+    // Order traces are formatted on the logger's thread; wait for it rather than lose them
+    Logger::instance().setLevel(logLevel);
+    Logger::instance().setBlockWhenFull(true);
+#endif
+    
     // Record start time for performance measurement
     auto startTime = std::chrono::high_resolution_clock::now();
     
-    // Parse the input file
-    CSVParser parser(inputFile);
-    std::vector<Order> orders = parser.parse();
+    // Create the writer for the output file; results are written on a separate thread,
+    // either by the asynchronous writer or by the pipeline's writer stage
+    std::unique_ptr<ResultWriter> fileWriter;
+    BinaryResultWriter* binaryWriter = nullptr;
+    if (binaryOutput) {
+        auto writer = std::make_unique<BinaryResultWriter>(outputFile, outputOptions);
+        binaryWriter = writer.get();
+        fileWriter = std::move(writer);
+    } else {
+        auto csvWriter = std::make_unique<CSVWriter>(outputFile, CSVWriter::DEFAULT_BUFFER_SIZE, outputOptions);
+        csvWriter->writeHeader();
+        fileWriter = std::move(csvWriter);
+    }
+    std::unique_ptr<AsyncResultWriter> asyncWriter;
+    if (!pipelined) {
+        asyncWriter = std::make_unique<AsyncResultWriter>(*fileWriter, 8192, outputPolicy);
+    }
     
-    std::cout << "Loaded " << orders.size() << " orders from " << inputFile << std::endl;
+    // Create the matching engine, pre-sized from the configuration profile if given
+    EngineConfig config;
+    if (!configFile.empty()) {
+        config = EngineConfig::load(configFile);
+    }
+    MatchingEngine engine(config);
     
-    // Create the writer for the output file
-    CSVWriter writer(outputFile);
-    writer.writeHeader();
+    // Publish the book changes as a binary market-data feed if asked to
+    std::unique_ptr<MarketDataPublisher> publisher;
+    if (!marketDataOptions.ringName.empty() || !marketDataOptions.udpAddress.empty()) {
+        publisher = std::make_unique<MarketDataPublisher>(marketDataOptions);
+        if (!publisher->isOpen()) {
+            return 1;
+        }
+        engine.setMarketDataPublisher(publisher.get());
+    }
+    SnapshotManager snapshots;
+    size_t processed = 0;
+    size_t snapshotSeq = 0;
     
-    // Create the matching engine
-    MatchingEngine engine;
+    // Instruments in order of first appearance, for the final report
+    std::vector<std::string> instruments;
+    std::unordered_set<std::string> seenInstruments;
     
-    // Process all orders
-    for (const auto& order : orders) {
-        // Display order for debugging
-        std::cout << "\nProcessing ";
-        printOrder(order);
+    // Report a matched order and its results, and take periodic snapshots
+    auto onOrder = [&](const Order& order, std::span<const OrderResult> results) {
+        // Trace the order and its results for debugging
+        ENGINE_LOG_DEBUG("\nProcessing Order #{} - {} {} {} @ {:.2f} [{}] {}",
+                         order.order_id, sideName(order.side), order.quantity, order.instrument,
+                         order.price, actionName(order.action), typeName(order.type));
+        for (const auto& result : results) {
+            if (result.executed_quantity > 0) {
+                ENGINE_LOG_DEBUG("Result for Order #{}: {} - Executed {} @ {:.2f} (Counterparty: {})",
+                                 result.order_id, statusName(result.status), result.executed_quantity,
+                                 result.execution_price, result.counterparty_id);
+            } else {
+                ENGINE_LOG_DEBUG("Result for Order #{}: {}", result.order_id, statusName(result.status));
+            }
+        }
         
-        // Process the order and get results
-        std::vector<OrderResult> results = engine.processOrder(order);
+        if (seenInstruments.insert(order.instrument).second) {
+            instruments.push_back(order.instrument);
+        }
         
-        // Write all results to the output file and display them
-        for (const auto& result : results) {
-            writer.writeOrderResult(result);
-            printOrderResult(result);
+        // Periodically snapshot the books without pausing matching
+        ++processed;
+        if (snapshotEvery > 0 && processed % snapshotEvery == 0) {
+            std::string snapshotFile = outputFile + ".snapshot." + std::to_string(++snapshotSeq) + ".csv";
+            if (!snapshots.begin(engine, snapshotFile)) {
+                --snapshotSeq; // Previous snapshot still being written, skip this one
+            }
+        }
+    };
+    
+    // Match a batch of orders, in order
+    auto processOrders = [&](const std::vector<Order>& orders) {
+        for (const auto& order : orders) {
+            // Process the order and write all results to the output file
+            std::vector<OrderResult> results = engine.processOrder(order);
+            for (const auto& result : results) {
+                asyncWriter->writeOrderResult(result);
+            }
+            onOrder(order, results);
+        }
+    };
+    
+    // Pull every batch of a source through the matching engine
+    auto processSource = [&](OrderSource& source) {
+        if (pipelined) {
+            Pipeline pipeline(source, engine, *fileWriter, batchSize);
+            pipeline.setOrderCallback(onOrder);
+            pipeline.run();
+#ifndef ENGINE_LOGGING_DISABLED
+            Logger::instance().flush();
+#endif
+            std::cout << std::endl;
+            pipeline.printStats(std::cout);
+        } else {
+            // Read columnar batches and match each one with a single engine call. Batches
+            // are cut at snapshot boundaries so that a snapshot sees the books right after its order
+            auto nextBatchSize = [&]() {
+                return snapshotEvery > 0 ? std::min(batchSize, snapshotEvery - processed % snapshotEvery) : batchSize;
+            };
+            OrderBatch batch;
+            std::vector<OrderResult> results;
+            std::vector<size_t> resultEnds;
+            Order order;
+            while (source.next(batch, nextBatchSize()) > 0) {
+                results.clear();
+                engine.processBatch(batch, results, &resultEnds);
+                size_t begin = 0;
+                for (size_t i = 0; i < batch.size(); ++i) {
+                    for (size_t r = begin; r < resultEnds[i]; ++r) {
+                        asyncWriter->writeOrderResult(results[r]);
+                    }
+                    batch.toOrder(i, order);
+                    onOrder(order, std::span<const OrderResult>(results.data() + begin, resultEnds[i] - begin));
+                    begin = resultEnds[i];
+                }
+            }
+        }
+    };
+    
+    // Malformed rows are reported on standard error and skipped
+    size_t rejected = 0;
+    
+    if (BinaryOrderReader::isBinaryFile(inputFile)) {
+        // Binary files need no parsing, the mapped records are handed out directly
+        BinaryOrderReader reader(inputFile);
+        if (!reader.isOpen()) {
+            return 1;
+        }
+        
+        std::cout << "Reading " << reader.recordCount() << " binary orders from " << inputFile << std::endl;
+        processSource(reader);
+        rejected = reader.rejectedCount();
+    } else if (parseThreads > 1) {
+        // Parse the file in parallel chunks and match each one in file order as soon as it is ready
+        CSVParser parser(inputFile);
+        std::cout << "Parsing orders from " << inputFile << " on " << parseThreads << " threads" << std::endl;
+        size_t chunks = parser.parseParallel(parseThreads, [&](std::vector<Order>& chunk) {
+            processOrders(chunk);
+        });
+        std::cout << "Matched " << chunks << " parsed chunks" << std::endl;
+        rejected = parser.rejectedCount();
+    } else {
+        // Open the input file as a stream of order batches
+        CSVOrderStream stream(inputFile, useMmap);
+        if (!stream.isOpen()) {
+            return 1;
         }
+        
+        std::cout << "Streaming orders from " << inputFile << std::endl;
+        
+        // Process the orders batch by batch as they are read
+        processSource(stream);
+        rejected = stream.rejectedCount();
+    }
+    
+#ifndef ENGINE_LOGGING_DISABLED
+    // Write out the order traces before the summary
+    Logger::instance().flush();
+#endif
+    
+    if (snapshotEvery > 0) {
+        snapshots.wait();
+        std::cout << "\nSnapshots written: " << snapshots.completedCount()
+                  << " (max pause " << snapshots.maxPause().count() << " ns)" << std::endl;
+    }
+    
+    // Drain the results still buffered before reporting
+    if (asyncWriter) {
+        asyncWriter->close();
     }
     
     // Record end time and calculate processing time
@@ -112,20 +314,30 @@ int main(int argc, char* argv[]) {
     auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
     
     // Print statistics
-    std::cout << "\nProcessed " << orders.size() << " orders in " 
+    std::cout << "\nProcessed " << processed << " orders in " 
               << duration.count() << " milliseconds" << std::endl;
+    if (rejected > 0) {
+        std::cout << "Rejected " << rejected << " malformed rows" << std::endl;
+    }
+    if (asyncWriter && asyncWriter->droppedCount() > 0) {
+        std::cout << "Dropped " << asyncWriter->droppedCount() << " results under output backpressure" << std::endl;
+    }
+    if (binaryWriter && binaryWriter->rejectedCount() > 0) {
+        std::cout << "Skipped " << binaryWriter->rejectedCount() << " results with symbols too long for the binary output" << std::endl;
+    }
+#ifndef ENGINE_LOGGING_DISABLED
+    if (Logger::instance().droppedCount() > 0) {
+        std::cout << "Dropped " << Logger::instance().droppedCount() << " log records" << std::endl;
+    }
+#endif
+    if (publisher) {
+        std::cout << "Published " << publisher->stats().messages << " market-data messages in "
+                  << publisher->stats().batches << " batches" << std::endl;
+    }
     std::cout << "Results written to " << outputFile << std::endl;
     
     // Print order book status for each instrument
     std::cout << "\nFinal Order Book Status:" << std::endl;
-    std::vector<std::string> instruments;
-    
-    // Get all unique instruments from the orders
-    for (const auto& order : orders) {
-        if (std::find(instruments.begin(), instruments.end(), order.instrument) == instruments.end()) {
-            instruments.push_back(order.instrument);
-        }
-    }
     
     // Print order book for each instrument
     for (const auto& instrument : instruments) {
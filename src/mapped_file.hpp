@@ -0,0 +1,76 @@
+/**
+ * @file mapped_file.hpp
+ * @brief Defines the MappedFile class, a read-only memory mapping of a whole file.
+ *
+ * Mapping the input lets parsers walk the file with pointer arithmetic instead of
+ * copying it line by line through stream buffers.
+ */
+#pragma once
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+/**
+ * @class MappedFile
+ * @brief RAII wrapper around a read-only mmap() of a file
+ */
+class MappedFile {
+public:
+    /**
+     * @brief Default constructor, creates an unmapped file
+     */
+    MappedFile() = default;
+
+    /**
+     * @brief Maps the specified file
+     * @param filename The path to the file to map
+     */
+    explicit MappedFile(const std::string& filename);
+
+    /**
+     * @brief Destructor that unmaps the file
+     */
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * @brief Maps the specified file, unmapping any previous one
+     * @param filename The path to the file to map
+     * @return True if the file was opened (an empty file is opened but not mapped)
+     */
+    bool open(const std::string& filename);
+
+    /**
+     * @brief Unmaps the file
+     */
+    void close();
+
+    /**
+     * @brief Checks whether a file is open
+     */
+    bool isOpen() const { return open_; }
+
+    /**
+     * @brief Pointer to the first byte of the file
+     */
+    const char* data() const { return data_; }
+
+    /**
+     * @brief Size of the file in bytes
+     */
+    size_t size() const { return size_; }
+
+    /**
+     * @brief View over the whole file
+     */
+    std::string_view view() const { return std::string_view(data_, size_); }
+
+private:
+    const char* data_ = nullptr;  ///< Start of the mapping
+    size_t size_ = 0;             ///< Length of the mapping
+    bool open_ = false;           ///< True if a file is open
+};
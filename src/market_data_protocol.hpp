@@ -0,0 +1,142 @@
+/**
+ * @file market_data_protocol.hpp
+ * @brief Defines the binary market-data messages published by the engine.
+ *
+ * The feed is modelled on ITCH: every message carries a sequence number, the timestamp
+ * of the input that caused it and a locate code identifying the instrument. Locate codes
+ * are announced by an INSTRUMENT_DIRECTORY message before their first use. Messages are
+ * fixed-layout little-endian structs; the length field of the header gives the size of
+ * the whole message, so a reader can skip types it does not know.
+ *
+ * Over UDP, the messages of a datagram follow a MarketDataPacketHeader, in the manner of
+ * MoldUDP64: the header gives the sequence number of the first message and the count.
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "binary_format.hpp"
+
+/**
+ * @enum MarketDataType
+ * @brief Type byte of a market-data message
+ */
+enum class MarketDataType : uint8_t {
+    INSTRUMENT_DIRECTORY = 'R',  // Binds a locate code to a symbol
+    ADD_ORDER = 'A',             // Order added to the book
+    DELETE_ORDER = 'D',          // Order removed from the book
+    REPLACE_ORDER = 'U',         // Order modified in place, keeping its id
+    ORDER_EXECUTED = 'E',        // Resting order executed against an incoming order
+    LEVEL_UPDATE = 'L'           // New aggregate state of a price level
+};
+
+/**
+ * @struct MarketDataHeader
+ * @brief Common prefix of every market-data message
+ */
+struct MarketDataHeader {
+    uint16_t length;     // Size of the whole message, header included
+    uint8_t type;        // MarketDataType value
+    uint8_t reserved;    // Always zero
+    uint32_t locate;     // Instrument locate code
+    uint64_t sequence;   // Sequence number, 1 for the first message of the feed
+    uint64_t timestamp;  // Timestamp of the input that caused the message
+};
+
+/**
+ * @struct InstrumentDirectoryMessage
+ * @brief Announces the symbol of a locate code
+ */
+struct InstrumentDirectoryMessage {
+    MarketDataHeader header;
+    char symbol[BINARY_SYMBOL_SIZE];  // Symbol, zero-padded
+};
+
+/**
+ * @struct AddOrderMessage
+ * @brief Order added to the book; also used for REPLACE_ORDER with the new attributes
+ */
+struct AddOrderMessage {
+    MarketDataHeader header;
+    int32_t order_id;   // Order identifier
+    int32_t quantity;   // Quantity resting in the book
+    float price;        // Limit price
+    uint8_t side;       // Side enum value
+    uint8_t reserved[3];
+};
+
+/**
+ * @struct DeleteOrderMessage
+ * @brief Order removed from the book
+ */
+struct DeleteOrderMessage {
+    MarketDataHeader header;
+    int32_t order_id;   // Order identifier
+    uint8_t side;       // Side of the removed order
+    uint8_t reserved[3];
+    float price;        // Price of the removed order
+    uint32_t reserved2;
+};
+
+/**
+ * @struct OrderExecutedMessage
+ * @brief Execution of a resting order
+ */
+struct OrderExecutedMessage {
+    MarketDataHeader header;
+    int32_t order_id;           // Resting order executed
+    int32_t executed_quantity;  // Quantity of this execution
+    float execution_price;      // Price of this execution
+    int32_t counterparty_id;    // Incoming order it executed against
+    uint64_t match_number;      // Feed-wide execution number
+};
+
+/**
+ * @struct LevelUpdateMessage
+ * @brief Aggregate state of a price level after an input; quantity 0 means the level is gone
+ */
+struct LevelUpdateMessage {
+    MarketDataHeader header;
+    float price;        // Level price
+    int32_t quantity;   // Total quantity resting at the level
+    int32_t count;      // Number of orders at the level
+    uint8_t side;       // Side enum value
+    uint8_t reserved[3];
+};
+
+/**
+ * @brief Largest message of the feed, and the payload size of a shared-memory slot
+ */
+constexpr size_t MARKET_DATA_MESSAGE_SIZE = 56;
+
+/**
+ * @union MarketDataMessage
+ * @brief Storage for any market-data message; header is valid for every type
+ */
+union MarketDataMessage {
+    MarketDataHeader header;
+    InstrumentDirectoryMessage directory;
+    AddOrderMessage add;
+    DeleteOrderMessage remove;
+    OrderExecutedMessage executed;
+    LevelUpdateMessage level;
+    char bytes[MARKET_DATA_MESSAGE_SIZE];
+};
+
+/**
+ * @struct MarketDataPacketHeader
+ * @brief Prefix of a UDP datagram
+ */
+struct MarketDataPacketHeader {
+    uint64_t sequence;  // Sequence number of the first message of the datagram
+    uint16_t count;     // Number of messages in the datagram
+    uint16_t reserved[3];
+};
+
+static_assert(sizeof(MarketDataHeader) == 24, "Unexpected market-data header size");
+static_assert(sizeof(InstrumentDirectoryMessage) == 40, "Unexpected directory message size");
+static_assert(sizeof(AddOrderMessage) == 40, "Unexpected add order message size");
+static_assert(sizeof(DeleteOrderMessage) == 40, "Unexpected delete order message size");
+static_assert(sizeof(OrderExecutedMessage) == 48, "Unexpected order executed message size");
+static_assert(sizeof(LevelUpdateMessage) == 40, "Unexpected level update message size");
+static_assert(sizeof(MarketDataMessage) == MARKET_DATA_MESSAGE_SIZE, "Unexpected market-data message size");
+static_assert(sizeof(MarketDataPacketHeader) == 16, "Unexpected packet header size");
@@ -0,0 +1,185 @@
+/**
+ * @file market_data_publisher.cpp
+ * @brief Implementation of the market-data publisher.
+ */
+
+#include "market_data_publisher.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+/**
+ * @brief Opens the ring and the UDP socket that the options ask for.
+ *
+ * For a multicast destination the socket sends through the loopback interface with a
+ * TTL of 0, so the feed never leaves the host.
+ */
+MarketDataPublisher::MarketDataPublisher(const MarketDataOptions& options) {
+    if (!options.ringName.empty()) {
+        ring_ = std::make_unique<MarketDataRingWriter>(options.ringName, options.ringSlots);
+        open_ = ring_->isOpen();
+    }
+    if (!options.udpAddress.empty()) {
+        in_addr address{};
+        if (inet_pton(AF_INET, options.udpAddress.c_str(), &address) != 1) {
+            std::cerr << "Erreur : adresse UDP invalide : " << options.udpAddress << std::endl;
+            open_ = false;
+            return;
+        }
+        socket_ = socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+        if (socket_ < 0) {
+            std::cerr << "Erreur : impossible de créer le socket UDP : " << std::strerror(errno) << std::endl;
+            open_ = false;
+            return;
+        }
+        if (IN_MULTICAST(ntohl(address.s_addr))) {
+            in_addr loopback{};
+            loopback.s_addr = htonl(INADDR_LOOPBACK);
+            unsigned char ttl = 0;
+            unsigned char loop = 1;
+            if (setsockopt(socket_, IPPROTO_IP, IP_MULTICAST_IF, &loopback, sizeof(loopback)) != 0
+                || setsockopt(socket_, IPPROTO_IP, IP_MULTICAST_TTL, &ttl, sizeof(ttl)) != 0
+                || setsockopt(socket_, IPPROTO_IP, IP_MULTICAST_LOOP, &loop, sizeof(loop)) != 0) {
+                std::cerr << "Erreur : multicast indisponible sur l'interface loopback : " << std::strerror(errno) << std::endl;
+                open_ = false;
+            }
+        }
+        udpAddress_ = address.s_addr;
+        udpPort_ = htons(options.udpPort);
+        datagram_.reserve(MARKET_DATA_DATAGRAM_SIZE);
+    }
+}
+
+MarketDataPublisher::~MarketDataPublisher() {
+    if (socket_ >= 0) {
+        close(socket_);
+    }
+}
+
+/**
+ * @brief Resolves the locate code of the book, announcing it on first use.
+ */
+void MarketDataPublisher::beginInput(const OrderBook& book, uint64_t timestamp) {
+    book_ = &book;
+    timestamp_ = timestamp;
+    batch_.clear();
+
+    auto [it, inserted] = locates_.emplace(&book, static_cast<uint32_t>(locates_.size() + 1));
+    locate_ = it->second;
+    if (inserted) {
+        const std::string& symbol = book.getInstrument();
+        MarketDataMessage& message = append(MarketDataType::INSTRUMENT_DIRECTORY, sizeof(InstrumentDirectoryMessage));
+        std::memcpy(message.directory.symbol, symbol.data(), std::min(symbol.size(), BINARY_SYMBOL_SIZE));
+    }
+}
+
+MarketDataMessage& MarketDataPublisher::append(MarketDataType type, size_t size) {
+    MarketDataMessage& message = batch_.emplace_back();
+    std::memset(&message, 0, sizeof(message));
+    message.header.length = static_cast<uint16_t>(size);
+    message.header.type = static_cast<uint8_t>(type);
+    message.header.locate = locate_;
+    message.header.sequence = ++sequence_;
+    message.header.timestamp = timestamp_;
+    return message;
+}
+
+void MarketDataPublisher::addOrder(const Order& order) {
+    MarketDataMessage& message = append(MarketDataType::ADD_ORDER, sizeof(AddOrderMessage));
+    message.add.order_id = order.order_id;
+    message.add.quantity = order.quantity;
+    message.add.price = order.price;
+    message.add.side = static_cast<uint8_t>(order.side);
+}
+
+void MarketDataPublisher::deleteOrder(const Order& resting) {
+    MarketDataMessage& message = append(MarketDataType::DELETE_ORDER, sizeof(DeleteOrderMessage));
+    message.remove.order_id = resting.order_id;
+    message.remove.side = static_cast<uint8_t>(resting.side);
+    message.remove.price = resting.price;
+}
+
+void MarketDataPublisher::replaceOrder(const Order& order) {
+    MarketDataMessage& message = append(MarketDataType::REPLACE_ORDER, sizeof(AddOrderMessage));
+    message.add.order_id = order.order_id;
+    message.add.quantity = order.quantity;
+    message.add.price = order.price;
+    message.add.side = static_cast<uint8_t>(order.side);
+}
+
+void MarketDataPublisher::orderExecuted(const OrderResult& match) {
+    MarketDataMessage& message = append(MarketDataType::ORDER_EXECUTED, sizeof(OrderExecutedMessage));
+    message.executed.order_id = match.order_id;
+    message.executed.executed_quantity = match.executed_quantity;
+    message.executed.execution_price = match.execution_price;
+    message.executed.counterparty_id = match.counterparty_id;
+    message.executed.match_number = ++matchNumber_;
+}
+
+/**
+ * @brief Turns the book's level deltas into LEVEL_UPDATE messages, then publishes.
+ */
+void MarketDataPublisher::endInput() {
+    deltas_.clear();
+    book_->levelDeltas(deltas_);
+    for (const auto& delta : deltas_) {
+        MarketDataMessage& message = append(MarketDataType::LEVEL_UPDATE, sizeof(LevelUpdateMessage));
+        message.level.price = static_cast<float>(delta.price);
+        message.level.quantity = delta.quantity;
+        message.level.count = delta.count;
+        message.level.side = static_cast<uint8_t>(delta.side);
+    }
+
+    if (batch_.empty()) {
+        return;
+    }
+    if (ring_) {
+        ring_->publish(batch_);
+    }
+    if (socket_ >= 0) {
+        sendDatagrams();
+    }
+    stats_.messages += batch_.size();
+    ++stats_.batches;
+    batch_.clear();
+}
+
+/**
+ * @brief Packs the batch's messages behind a packet header, starting a new datagram
+ * whenever the next message would not fit.
+ */
+void MarketDataPublisher::sendDatagrams() {
+    sockaddr_in destination{};
+    destination.sin_family = AF_INET;
+    destination.sin_addr.s_addr = udpAddress_;
+    destination.sin_port = udpPort_;
+
+    size_t first = 0;
+    while (first < batch_.size()) {
+        datagram_.resize(sizeof(MarketDataPacketHeader));
+        size_t last = first;
+        while (last < batch_.size()
+               && datagram_.size() + batch_[last].header.length <= MARKET_DATA_DATAGRAM_SIZE) {
+            datagram_.insert(datagram_.end(), batch_[last].bytes, batch_[last].bytes + batch_[last].header.length);
+            ++last;
+        }
+        MarketDataPacketHeader header{};
+        header.sequence = batch_[first].header.sequence;
+        header.count = static_cast<uint16_t>(last - first);
+        std::memcpy(datagram_.data(), &header, sizeof(header));
+
+        ssize_t sent = sendto(socket_, datagram_.data(), datagram_.size(), MSG_DONTWAIT,
+                              reinterpret_cast<const sockaddr*>(&destination), sizeof(destination));
+        if (sent < 0) {
+            ++stats_.sendErrors;
+        } else {
+            ++stats_.datagrams;
+        }
+        first = last;
+    }
+}
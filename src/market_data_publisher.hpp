@@ -0,0 +1,150 @@
+/**
+ * @file market_data_publisher.hpp
+ * @brief Defines the MarketDataPublisher class, which turns book changes into a binary feed.
+ *
+ * The MatchingEngine reports each book change to the publisher while it processes an
+ * order. The publisher gives every message the next sequence number and keeps the
+ * messages of the current input together; when the input is done it appends one
+ * LEVEL_UPDATE per LevelDelta the book recorded and publishes the whole batch at once:
+ * - to a shared-memory ring (one release store per batch) for consumers on the host,
+ * - optionally to a UDP destination, packed into as few datagrams as fit the batch.
+ *   A multicast group address is sent on the loopback interface only.
+ */
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "market_data_protocol.hpp"
+#include "market_data_ring.hpp"
+#include "order_book.hpp"
+
+/**
+ * @brief Largest UDP payload sent, small enough to avoid IP fragmentation on Ethernet
+ */
+constexpr size_t MARKET_DATA_DATAGRAM_SIZE = 1472;
+
+/**
+ * @struct MarketDataOptions
+ * @brief Destinations of the feed
+ */
+struct MarketDataOptions {
+    std::string ringName;       // Shared-memory object name, e.g. "/engine_md"; empty for none
+    size_t ringSlots = 65536;   // Messages held by the ring
+    std::string udpAddress;     // Destination IPv4 address, e.g. "239.1.1.1"; empty for none
+    uint16_t udpPort = 0;       // Destination port
+};
+
+/**
+ * @struct MarketDataStats
+ * @brief Counters of a publisher
+ */
+struct MarketDataStats {
+    uint64_t messages = 0;      // Messages published
+    uint64_t batches = 0;       // Inputs that produced at least one message
+    uint64_t datagrams = 0;     // UDP datagrams sent
+    uint64_t sendErrors = 0;    // UDP datagrams the kernel refused
+};
+
+/**
+ * @class MarketDataPublisher
+ * @brief Sequences book changes and publishes them per processed input
+ */
+class MarketDataPublisher {
+public:
+    /**
+     * @brief Creates the configured destinations
+     * @param options Ring name and UDP destination
+     */
+    explicit MarketDataPublisher(const MarketDataOptions& options);
+
+    /**
+     * @brief Destructor that closes the socket and removes the ring
+     */
+    ~MarketDataPublisher();
+
+    MarketDataPublisher(const MarketDataPublisher&) = delete;
+    MarketDataPublisher& operator=(const MarketDataPublisher&) = delete;
+
+    /**
+     * @brief Checks whether every configured destination could be created
+     */
+    bool isOpen() const { return open_; }
+
+    /**
+     * @brief Starts the batch of an input
+     * @param book Book of the input's instrument, read when the batch ends
+     * @param timestamp Timestamp stamped on the batch's messages
+     */
+    void beginInput(const OrderBook& book, uint64_t timestamp);
+
+    /**
+     * @brief Records an order added to the book
+     */
+    void addOrder(const Order& order);
+
+    /**
+     * @brief Records an order removed from the book
+     * @param resting The order as it was in the book
+     */
+    void deleteOrder(const Order& resting);
+
+    /**
+     * @brief Records an order replaced in the book
+     * @param order The order as it is now
+     */
+    void replaceOrder(const Order& order);
+
+    /**
+     * @brief Records the execution of a resting order
+     * @param match The result of the resting order
+     */
+    void orderExecuted(const OrderResult& match);
+
+    /**
+     * @brief Appends the level updates of the input and publishes its batch
+     */
+    void endInput();
+
+    /**
+     * @brief Sequence number of the last message published, 0 if none
+     */
+    uint64_t lastSequence() const { return sequence_; }
+
+    /**
+     * @brief Publisher counters
+     */
+    const MarketDataStats& stats() const { return stats_; }
+
+private:
+    /**
+     * @brief Appends a message of the given type and size to the batch
+     */
+    MarketDataMessage& append(MarketDataType type, size_t size);
+
+    /**
+     * @brief Sends the batch in datagrams of at most MARKET_DATA_DATAGRAM_SIZE bytes
+     */
+    void sendDatagrams();
+
+    std::unique_ptr<MarketDataRingWriter> ring_;
+    int socket_ = -1;
+    uint32_t udpAddress_ = 0;         ///< Destination address, network byte order
+    uint16_t udpPort_ = 0;            ///< Destination port, network byte order
+    bool open_ = true;
+
+    uint64_t sequence_ = 0;           ///< Last sequence number assigned
+    uint64_t matchNumber_ = 0;        ///< Last match number assigned
+    std::unordered_map<const OrderBook*, uint32_t> locates_;  ///< Locate code of each book seen
+
+    // State of the current input
+    const OrderBook* book_ = nullptr;
+    uint32_t locate_ = 0;
+    uint64_t timestamp_ = 0;
+    std::vector<MarketDataMessage> batch_;
+    std::vector<LevelDelta> deltas_;  ///< Levels changed by the input, reused
+    std::vector<char> datagram_;
+
+    MarketDataStats stats_;
+};
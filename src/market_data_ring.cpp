@@ -0,0 +1,177 @@
+/**
+ * @file market_data_ring.cpp
+ * @brief Implementation of the shared-memory market-data ring.
+ */
+
+#include "market_data_ring.hpp"
+#include <bit>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+constexpr size_t WORD_COUNT = MARKET_DATA_MESSAGE_SIZE / sizeof(uint64_t);
+
+/**
+ * @brief Bytes of the shared-memory object for a number of slots
+ */
+static size_t ringBytes(size_t slotCount) {
+    return sizeof(MarketDataRingHeader) + slotCount * sizeof(MarketDataSlot);
+}
+
+/**
+ * @brief Creates the object with O_EXCL after unlinking a stale one, sizes and maps it.
+ *
+ * ftruncate() zero-fills the object, so every slot starts with sequence 0. The header's
+ * magic number is written last, once the object is ready.
+ */
+MarketDataRingWriter::MarketDataRingWriter(const std::string& name, size_t slotCount) : name_(name) {
+    slotCount = std::bit_ceil(slotCount < 2 ? size_t{2} : slotCount);
+    shm_unlink(name_.c_str());
+    int fd = shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        std::cerr << "Erreur : impossible de créer la mémoire partagée " << name_ << " : " << std::strerror(errno) << std::endl;
+        return;
+    }
+    size_t size = ringBytes(slotCount);
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        std::cerr << "Erreur : impossible de dimensionner la mémoire partagée " << name_ << std::endl;
+        ::close(fd);
+        shm_unlink(name_.c_str());
+        return;
+    }
+    void* mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        std::cerr << "Erreur : impossible de projeter la mémoire partagée " << name_ << std::endl;
+        shm_unlink(name_.c_str());
+        return;
+    }
+
+    mappedSize_ = size;
+    header_ = new (mapping) MarketDataRingHeader();
+    header_->slotCount = static_cast<uint32_t>(slotCount);
+    header_->published.store(0, std::memory_order_relaxed);
+    slots_ = reinterpret_cast<MarketDataSlot*>(static_cast<char*>(mapping) + sizeof(MarketDataRingHeader));
+    mask_ = slotCount - 1;
+    std::atomic_thread_fence(std::memory_order_release);
+    header_->magic = MARKET_DATA_RING_MAGIC;
+}
+
+MarketDataRingWriter::~MarketDataRingWriter() {
+    if (header_) {
+        munmap(header_, mappedSize_);
+        shm_unlink(name_.c_str());
+    }
+}
+
+/**
+ * @brief Writes each message as a seqlock-protected slot, then moves the published mark once.
+ */
+void MarketDataRingWriter::publish(std::span<const MarketDataMessage> messages) {
+    if (!header_ || messages.empty()) {
+        return;
+    }
+    uint64_t words[WORD_COUNT];
+    for (const auto& message : messages) {
+        uint64_t sequence = message.header.sequence;
+        MarketDataSlot& slot = slots_[(sequence - 1) & mask_];
+        std::memcpy(words, message.bytes, sizeof(words));
+
+        slot.sequence.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i < WORD_COUNT; ++i) {
+            slot.words[i].store(words[i], std::memory_order_relaxed);
+        }
+        slot.sequence.store(sequence, std::memory_order_release);
+    }
+    header_->published.store(messages.back().header.sequence, std::memory_order_release);
+}
+
+MarketDataRingReader::MarketDataRingReader(const std::string& name) {
+    int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        std::cerr << "Erreur : impossible d'ouvrir la mémoire partagée " << name << " : " << std::strerror(errno) << std::endl;
+        return;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(MarketDataRingHeader)) {
+        std::cerr << "Erreur : mémoire partagée " << name << " invalide" << std::endl;
+        ::close(fd);
+        return;
+    }
+    size_t size = static_cast<size_t>(st.st_size);
+    void* mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        std::cerr << "Erreur : impossible de projeter la mémoire partagée " << name << std::endl;
+        return;
+    }
+
+    auto* header = static_cast<const MarketDataRingHeader*>(mapping);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (header->magic != MARKET_DATA_RING_MAGIC || size < ringBytes(header->slotCount)) {
+        std::cerr << "Erreur : " << name << " n'est pas un flux de données de marché" << std::endl;
+        munmap(mapping, size);
+        return;
+    }
+
+    header_ = header;
+    mappedSize_ = size;
+    slotCount_ = header->slotCount;
+    slots_ = reinterpret_cast<const MarketDataSlot*>(static_cast<const char*>(mapping) + sizeof(MarketDataRingHeader));
+    uint64_t published = header_->published.load(std::memory_order_acquire);
+    next_ = published >= slotCount_ ? published - slotCount_ + 1 : 1;
+}
+
+MarketDataRingReader::~MarketDataRingReader() {
+    if (header_) {
+        munmap(const_cast<MarketDataRingHeader*>(header_), mappedSize_);
+    }
+}
+
+/**
+ * @brief Copies published slots, checking each slot's sequence before and after the copy.
+ */
+size_t MarketDataRingReader::poll(std::vector<MarketDataMessage>& messages, size_t maxMessages) {
+    if (!header_) {
+        return 0;
+    }
+    uint64_t published = header_->published.load(std::memory_order_acquire);
+    size_t appended = 0;
+    uint64_t words[WORD_COUNT];
+    while (next_ <= published && appended < maxMessages) {
+        // Messages more than a ring behind the writer are gone
+        if (published - next_ >= slotCount_) {
+            uint64_t oldest = published - slotCount_ + 1;
+            lost_ += oldest - next_;
+            next_ = oldest;
+        }
+
+        const MarketDataSlot& slot = slots_[(next_ - 1) & (slotCount_ - 1)];
+        uint64_t before = slot.sequence.load(std::memory_order_acquire);
+        for (size_t i = 0; i < WORD_COUNT; ++i) {
+            words[i] = slot.words[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint64_t after = slot.sequence.load(std::memory_order_relaxed);
+        if (before != next_ || after != next_) {
+            // The writer lapped this reader while it was copying
+            ++lost_;
+            ++next_;
+            published = header_->published.load(std::memory_order_acquire);
+            continue;
+        }
+
+        MarketDataMessage message;
+        std::memcpy(message.bytes, words, sizeof(words));
+        messages.push_back(message);
+        ++next_;
+        ++appended;
+    }
+    return appended;
+}
@@ -0,0 +1,147 @@
+/**
+ * @file market_data_ring.hpp
+ * @brief Defines a shared-memory broadcast ring carrying the market-data feed.
+ *
+ * The ring lives in a POSIX shared-memory object so that consumers in other processes on
+ * the same host read the feed without a syscall. It has one writer and any number of
+ * readers; readers never slow the writer down. Each slot holds one message and the
+ * sequence number it was written with:
+ * - the writer stores the messages of a batch, each bracketed by a sequence store
+ *   (zero while the slot is being written), then publishes the batch with a single
+ *   release store of the last sequence number in the ring header;
+ * - a reader copies a slot and checks that its sequence number is unchanged, so a slot
+ *   overwritten during the copy is detected. A reader that falls more than a ring behind
+ *   skips to the oldest message still available and counts the messages it lost.
+ */
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+#include "market_data_protocol.hpp"
+
+/**
+ * @brief Identifies a shared-memory object created by MarketDataRingWriter
+ */
+constexpr uint64_t MARKET_DATA_RING_MAGIC = 0x474E49524B52444DULL;  // "MDRKRING"
+
+/**
+ * @struct MarketDataRingHeader
+ * @brief Header at the start of the shared-memory object
+ */
+struct MarketDataRingHeader {
+    uint64_t magic;                                    // MARKET_DATA_RING_MAGIC
+    uint32_t slotCount;                                // Number of slots, a power of two
+    uint32_t reserved;
+    alignas(64) std::atomic<uint64_t> published;       // Sequence number of the last published message
+};
+
+/**
+ * @struct MarketDataSlot
+ * @brief One message and its sequence number, on its own cache line
+ */
+struct alignas(64) MarketDataSlot {
+    std::atomic<uint64_t> sequence;                                      // 0 while being written
+    std::atomic<uint64_t> words[MARKET_DATA_MESSAGE_SIZE / sizeof(uint64_t)];  // Message bytes
+};
+
+static_assert(sizeof(MarketDataSlot) == 64, "A slot should fill exactly one cache line");
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Shared-memory atomics must be lock-free");
+
+/**
+ * @class MarketDataRingWriter
+ * @brief Creates the ring and writes the feed into it
+ */
+class MarketDataRingWriter {
+public:
+    /**
+     * @brief Creates (or recreates) the shared-memory object
+     * @param name Name of the object, e.g. "/engine_md"
+     * @param slotCount Requested number of slots, rounded up to a power of two
+     */
+    MarketDataRingWriter(const std::string& name, size_t slotCount);
+
+    /**
+     * @brief Destructor that unmaps and unlinks the object
+     */
+    ~MarketDataRingWriter();
+
+    MarketDataRingWriter(const MarketDataRingWriter&) = delete;
+    MarketDataRingWriter& operator=(const MarketDataRingWriter&) = delete;
+
+    /**
+     * @brief Checks whether the ring was created
+     */
+    bool isOpen() const { return header_ != nullptr; }
+
+    /**
+     * @brief Writes a batch of messages and publishes them together
+     *
+     * The sequence number in each message header must follow the previous message.
+     */
+    void publish(std::span<const MarketDataMessage> messages);
+
+private:
+    std::string name_;
+    MarketDataRingHeader* header_ = nullptr;  ///< Start of the mapping
+    MarketDataSlot* slots_ = nullptr;         ///< First slot, after the header
+    size_t mask_ = 0;                         ///< slotCount - 1
+    size_t mappedSize_ = 0;
+};
+
+/**
+ * @class MarketDataRingReader
+ * @brief Reads the feed from a ring created by another thread or process
+ */
+class MarketDataRingReader {
+public:
+    /**
+     * @brief Opens an existing ring read-only
+     *
+     * Reading starts at the oldest message still held by the ring.
+     *
+     * @param name Name of the shared-memory object
+     */
+    explicit MarketDataRingReader(const std::string& name);
+
+    /**
+     * @brief Destructor that unmaps the object
+     */
+    ~MarketDataRingReader();
+
+    MarketDataRingReader(const MarketDataRingReader&) = delete;
+    MarketDataRingReader& operator=(const MarketDataRingReader&) = delete;
+
+    /**
+     * @brief Checks whether the ring was opened
+     */
+    bool isOpen() const { return header_ != nullptr; }
+
+    /**
+     * @brief Appends the messages published since the last call
+     * @param messages Vector the messages are appended to
+     * @param maxMessages Maximum number of messages to append
+     * @return size_t Number of messages appended
+     */
+    size_t poll(std::vector<MarketDataMessage>& messages, size_t maxMessages = SIZE_MAX);
+
+    /**
+     * @brief Number of messages overwritten before this reader could copy them
+     */
+    uint64_t lost() const { return lost_; }
+
+    /**
+     * @brief Sequence number of the next message to read
+     */
+    uint64_t nextSequence() const { return next_; }
+
+private:
+    const MarketDataRingHeader* header_ = nullptr;
+    const MarketDataSlot* slots_ = nullptr;
+    size_t slotCount_ = 0;
+    size_t mappedSize_ = 0;
+    uint64_t next_ = 1;   ///< Sequence number of the next message to read
+    uint64_t lost_ = 0;
+};
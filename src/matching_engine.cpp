@@ -4,10 +4,35 @@
  * @brief Implementation of the matching engine functionality
  */
 #include "matching_engine.hpp"
+#include "market_data_publisher.hpp"
 #include <iostream>
 
-// Default constructor
-MatchingEngine::MatchingEngine() {}
+// Constructor: all books allocate from the given memory resource
+MatchingEngine::MatchingEngine(std::pmr::memory_resource* resource)
+    : resource_(resource), orderBooks(resource) {}
+
+/**
+ * @brief Construct a pre-sized engine from a configuration profile
+ * 
+ * The storage for all configured books is allocated (and zero-filled, so its pages are
+ * faulted in) before the session starts. A pool resource on top of it recycles freed
+ * nodes, so the opening flow neither rehashes the id indexes nor grows the heap.
+ */
+MatchingEngine::MatchingEngine(const EngineConfig& config, std::pmr::memory_resource* upstream)
+    : arenaStorage_(configuredBytes(config), upstream),
+      arena_(arenaStorage_.empty() ? nullptr : std::make_unique<std::pmr::monotonic_buffer_resource>(
+                 arenaStorage_.data(), arenaStorage_.size(), upstream)),
+      pool_(arena_ ? std::make_unique<std::pmr::unsynchronized_pool_resource>(arena_.get()) : nullptr),
+      resource_(pool_ ? static_cast<std::pmr::memory_resource*>(pool_.get()) : upstream),
+      orderBooks(resource_) {
+    orderBooks.reserve(config.instruments.size());
+    for (const auto& instrument : config.instruments) {
+        auto [it, inserted] = orderBooks.emplace(instrument.instrument,
+                                                 OrderBook(instrument.instrument, resource_));
+        it->second.reserve(instrument.expected_orders);
+        it->second.setTickSize(instrument.tick_size);
+    }
+}
 
 /**
  * @brief Process an incoming order
@@ -16,26 +41,120 @@ MatchingEngine::MatchingEngine() {}
  * (new, cancel, modify) and routes it to the appropriate handler.
  */
 std::vector<OrderResult> MatchingEngine::processOrder(const Order& order) {
-    // Check if we need to create a new order book for this instrument
-    if (orderBooks.find(order.instrument) == orderBooks.end()) {
-        orderBooks.emplace(order.instrument, OrderBook(order.instrument));
+    return processOrder(order, bookFor(order.instrument));
+}
+
+/**
+ * @brief Find the order book of an instrument, creating it on first use
+ */
+OrderBook& MatchingEngine::bookFor(const std::string& instrument) {
+    auto it = orderBooks.find(instrument);
+    if (it == orderBooks.end()) {
+        it = orderBooks.emplace(instrument, OrderBook(instrument, resource_)).first;
+        it->second.setLevelTracking(publisher_ != nullptr);
+    }
+    return it->second;
+}
+
+/**
+ * @brief Route an order to the handler of its action
+ */
+std::vector<OrderResult> MatchingEngine::processOrder(const Order& order, OrderBook& book) {
+    // The book changes made by the handler are published as one batch
+    if (publisher_) {
+        book.clearLevelChanges();
+        publisher_->beginInput(book, order.timestamp);
     }
     
     // Process order based on action
+    std::vector<OrderResult> results;
     switch (order.action) {
         case Action::NEW:
-            return handleNewOrder(order);
+            results = handleNewOrder(order, book);
+            break;
         case Action::CANCEL:
-            return handleCancelOrder(order);
+            results = handleCancelOrder(order, book);
+            break;
         case Action::MODIFY:
-            return handleModifyOrder(order);
+            results = handleModifyOrder(order, book);
+            break;
         default:
             // Unrecognized action, return rejected
-            std::vector<OrderResult> results;
-            OrderResult result = createOrderResult(order, OrderStatus::REJECTED);
-            results.push_back(result);
-            return results;
+            results.push_back(createOrderResult(order, OrderStatus::REJECTED));
+            break;
     }
+    
+    if (publisher_) {
+        publisher_->endInput();
+    }
+    return results;
+}
+
+/**
+ * @brief Process a batch of orders in sequence
+ * 
+ * Orders are processed exactly as by processOrder(), one after the other, and their
+ * results are appended to the caller's vector so that its capacity is reused across batches.
+ */
+size_t MatchingEngine::processBatch(const std::vector<Order>& batch, std::vector<OrderResult>& results) {
+    size_t before = results.size();
+    for (const auto& order : batch) {
+        std::vector<OrderResult> orderResults = processOrder(order);
+        results.insert(results.end(), orderResults.begin(), orderResults.end());
+    }
+    return results.size() - before;
+}
+
+/**
+ * @brief Process a columnar batch of orders in sequence
+ * 
+ * The whole batch is validated first with OrderBatch::validate(). Books are then
+ * resolved lazily by instrument id, so each instrument costs one hash lookup per batch.
+ * Each valid row is converted into a reused Order (its instrument fits in the
+ * small-string buffer for usual tickers) and processed as by processOrder().
+ */
+size_t MatchingEngine::processBatch(const OrderBatch& batch, std::vector<OrderResult>& results,
+                                    std::vector<size_t>* resultEnds) {
+    size_t before = results.size();
+    batch.validate(batchValid_);
+    
+    const auto& symbols = batch.symbols();
+    const uint32_t* instrumentIds = batch.instrumentIds();
+    batchBooks_.assign(symbols.size(), nullptr);
+    if (resultEnds) {
+        resultEnds->clear();
+        resultEnds->reserve(batch.size());
+    }
+    
+    for (size_t i = 0; i < batch.size(); ++i) {
+        batch.toOrder(i, batchOrder_);
+        if (!batchValid_[i]) {
+            results.push_back(createOrderResult(batchOrder_, OrderStatus::REJECTED));
+        } else {
+            OrderBook*& book = batchBooks_[instrumentIds[i]];
+            if (!book) {
+                book = &bookFor(symbols[instrumentIds[i]]);
+            }
+            std::vector<OrderResult> orderResults = processOrder(batchOrder_, *book);
+            results.insert(results.end(), orderResults.begin(), orderResults.end());
+        }
+        if (resultEnds) {
+            resultEnds->push_back(results.size());
+        }
+    }
+    return results.size() - before;
+}
+
+/**
+ * @brief Compute the storage needed by all books of a configuration profile
+ */
+size_t MatchingEngine::configuredBytes(const EngineConfig& config) {
+    size_t bytes = 0;
+    for (const auto& instrument : config.instruments) {
+        bytes += OrderBook::estimateMemory(instrument.expected_orders, instrument.expectedLevels());
+    }
+    // The pool grows its chunks geometrically, leave headroom for the last one
+    return 2 * bytes;
 }
 
 /**
@@ -52,6 +171,30 @@ OrderBook* MatchingEngine::getOrderBook(const std::string& instrument) {
     return nullptr;
 }
 
+/**
+ * @brief Get all order books managed by the engine
+ * 
+ * @return const BookMap& Order books keyed by instrument
+ */
+const MatchingEngine::BookMap& MatchingEngine::getOrderBooks() const {
+    return orderBooks;
+}
+
+/**
+ * @brief Publish every book change to a market-data feed
+ * 
+ * Level tracking is enabled on the books only while a publisher is attached, so that
+ * books of an engine without a feed do not record their changed levels.
+ * 
+ * @param publisher The publisher, nullptr to stop publishing
+ */
+void MatchingEngine::setMarketDataPublisher(MarketDataPublisher* publisher) {
+    publisher_ = publisher;
+    for (auto& [instrument, book] : orderBooks) {
+        book.setLevelTracking(publisher_ != nullptr);
+    }
+}
+
 /**
  * @brief Process a new order
  * 
@@ -59,8 +202,11 @@ OrderBook* MatchingEngine::getOrderBook(const std::string& instrument) {
  * 1. Try to match against existing orders
  * 2. If not fully executed, add the remaining quantity to the book
  */
-std::vector<OrderResult> MatchingEngine::handleNewOrder(const Order& order) {
-    OrderBook& book = orderBooks[order.instrument];
+std::vector<OrderResult> MatchingEngine::handleNewOrder(const Order& order, OrderBook& book) {
+    // Reject limit orders priced off the instrument's tick grid
+    if (order.type == Type::LIMIT && !book.isValidPrice(order.price)) {
+        return { createOrderResult(order, OrderStatus::REJECTED) };
+    }
     
     // First try to match the order
     std::vector<OrderResult> results = matchOrders(order, book);
@@ -68,9 +214,19 @@ std::vector<OrderResult> MatchingEngine::handleNewOrder(const Order& order) {
     // If order was not fully executed, add remaining quantity to the book
     OrderResult& orderResult = results[0]; // First result is always the new order
     
+    // The other results are executions of resting orders
+    if (publisher_) {
+        for (size_t i = 1; i < results.size(); ++i) {
+            publisher_->orderExecuted(results[i]);
+        }
+    }
+    
     if (orderResult.status != OrderStatus::EXECUTED) {
         // Add to order book (remaining quantity)
         book.addOrder(order);
+        if (publisher_) {
+            publisher_->addOrder(order);
+        }
     }
     
     return results;
@@ -81,12 +237,21 @@ std::vector<OrderResult> MatchingEngine::handleNewOrder(const Order& order) {
  * 
  * Attempts to cancel an existing order and returns the result
  */
-std::vector<OrderResult> MatchingEngine::handleCancelOrder(const Order& order) {
-    OrderBook& book = orderBooks[order.instrument];
+std::vector<OrderResult> MatchingEngine::handleCancelOrder(const Order& order, OrderBook& book) {
     std::vector<OrderResult> results;
     
+    // Keep the resting order for the market-data feed before it is removed
+    Order resting;
+    const Order* found = publisher_ ? book.findOrder(order.order_id) : nullptr;
+    if (found) {
+        resting = *found;
+    }
+    
     // Try to cancel the order
     bool canceled = book.cancelOrder(order.order_id);
+    if (canceled && found) {
+        publisher_->deleteOrder(resting);
+    }
     
     // Create result
     OrderResult result = createOrderResult(order, 
@@ -101,12 +266,15 @@ std::vector<OrderResult> MatchingEngine::handleCancelOrder(const Order& order) {
  * 
  * Attempts to modify an existing order and returns the result
  */
-std::vector<OrderResult> MatchingEngine::handleModifyOrder(const Order& order) {
-    OrderBook& book = orderBooks[order.instrument];
+std::vector<OrderResult> MatchingEngine::handleModifyOrder(const Order& order, OrderBook& book) {
     std::vector<OrderResult> results;
     
-    // Try to modify the order
-    bool modified = book.modifyOrder(order);
+    // Try to modify the order (off-tick limit prices are rejected)
+    bool modified = (order.type != Type::LIMIT || book.isValidPrice(order.price))
+                    && book.modifyOrder(order);
+    if (modified && publisher_) {
+        publisher_->replaceOrder(order);
+    }
     
     // Create result
     OrderResult result = createOrderResult(order, 
@@ -10,18 +10,43 @@
  */
 #pragma once
 #include "order.hpp"
+#include "order_batch.hpp"
 #include "order_book.hpp"
 #include "csv_writer.hpp"
+#include "engine_config.hpp"
+#include <memory>
+#include <memory_resource>
 #include <unordered_map>
 #include <vector>
 #include <string>
 
+class MarketDataPublisher;
+
 class MatchingEngine {
 public:
+    // Maps instrument to order book
+    using BookMap = std::pmr::unordered_map<std::string, OrderBook>;
+    
+    /**
+     * @brief Constructor
+     * 
+     * @param resource Memory resource used by the book map and by every order book
+     *        created by the engine (e.g. a session arena or a per-shard pool)
+     */
+    explicit MatchingEngine(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    
     /**
-     * @brief Default constructor
+     * @brief Constructor from a configuration profile
+     * 
+     * Pre-creates the order book of every configured instrument, reserves its id index,
+     * sets its tick size, and backs all books with a pool whose storage is allocated
+     * and touched up front from the configured capacities.
+     * 
+     * @param config The configuration profile
+     * @param upstream Memory resource the pre-sized storage is allocated from
      */
-    MatchingEngine();
+    explicit MatchingEngine(const EngineConfig& config,
+                            std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
     
     /**
      * @brief Process an order and return the results
@@ -31,6 +56,30 @@ public:
      */
     std::vector<OrderResult> processOrder(const Order& order);
     
+    /**
+     * @brief Process a batch of orders in sequence
+     * 
+     * @param batch The orders to process
+     * @param results Receives the results of every order of the batch, appended in processing order
+     * @return size_t The number of results appended
+     */
+    size_t processBatch(const std::vector<Order>& batch, std::vector<OrderResult>& results);
+    
+    /**
+     * @brief Process a columnar batch of orders in sequence
+     * 
+     * The batch is validated in one pass over its columns; invalid rows get a REJECTED
+     * result. The order book of each instrument is looked up once per batch instead of
+     * once per order. Valid rows are processed exactly as by processOrder().
+     * 
+     * @param batch The orders to process
+     * @param results Receives the results of every order of the batch, appended in processing order
+     * @param resultEnds If not null, receives for each order the end offset of its results in results
+     * @return size_t The number of results appended
+     */
+    size_t processBatch(const OrderBatch& batch, std::vector<OrderResult>& results,
+                        std::vector<size_t>* resultEnds = nullptr);
+    
     /**
      * @brief Get the order book for a specific instrument
      * 
@@ -39,33 +88,93 @@ public:
      */
     OrderBook* getOrderBook(const std::string& instrument);
     
+    /**
+     * @brief Get all order books managed by the engine
+     * 
+     * @return const BookMap& Order books keyed by instrument
+     */
+    const BookMap& getOrderBooks() const;
+    
+    /**
+     * @brief Publish every book change to a market-data feed
+     * 
+     * The publisher receives the changes of each processed order as one batch.
+     * 
+     * @param publisher The publisher, nullptr to stop publishing; not owned
+     */
+    void setMarketDataPublisher(MarketDataPublisher* publisher);
+    
 private:
+    // Pre-sized storage and pool backing the books when a configuration is given
+    std::pmr::vector<std::byte> arenaStorage_;
+    std::unique_ptr<std::pmr::monotonic_buffer_resource> arena_;
+    std::unique_ptr<std::pmr::unsynchronized_pool_resource> pool_;
+    
+    // Memory resource shared by the book map and the order books
+    std::pmr::memory_resource* resource_;
+    
     // Maps instrument to order book
-    std::unordered_map<std::string, OrderBook> orderBooks;
+    BookMap orderBooks;
+    
+    // Receives the book changes, if market data is published
+    MarketDataPublisher* publisher_ = nullptr;
+    
+    // Scratch state of the columnar batch path, kept to reuse its capacity
+    OrderBatch::Column<uint8_t> batchValid_;
+    std::vector<OrderBook*> batchBooks_;
+    Order batchOrder_;
+    
+    /**
+     * @brief Compute the storage needed by all books of a configuration profile
+     * 
+     * @param config The configuration profile
+     * @return size_t Number of bytes to reserve up front
+     */
+    static size_t configuredBytes(const EngineConfig& config);
+    
+    /**
+     * @brief Find the order book of an instrument, creating it if needed
+     * 
+     * @param instrument The instrument identifier
+     * @return OrderBook& The order book of the instrument
+     */
+    OrderBook& bookFor(const std::string& instrument);
+    
+    /**
+     * @brief Route an order to its handler once its book is known
+     * 
+     * @param order The order to process
+     * @param book The order book of the order's instrument
+     * @return std::vector<OrderResult> The results of processing the order
+     */
+    std::vector<OrderResult> processOrder(const Order& order, OrderBook& book);
     
     /**
      * @brief Handle a new order
      * 
      * @param order The new order to process
+     * @param book The order book of the order's instrument
      * @return std::vector<OrderResult> The results of processing the order
      */
-    std::vector<OrderResult> handleNewOrder(const Order& order);
+    std::vector<OrderResult> handleNewOrder(const Order& order, OrderBook& book);
     
     /**
      * @brief Handle a cancel order request
      * 
      * @param order The cancel order request
+     * @param book The order book of the order's instrument
      * @return std::vector<OrderResult> The results of processing the request
      */
-    std::vector<OrderResult> handleCancelOrder(const Order& order);
+    std::vector<OrderResult> handleCancelOrder(const Order& order, OrderBook& book);
     
     /**
      * @brief Handle a modify order request
      * 
      * @param order The modify order request
+     * @param book The order book of the order's instrument
      * @return std::vector<OrderResult> The results of processing the request
      */
-    std::vector<OrderResult> handleModifyOrder(const Order& order);
+    std::vector<OrderResult> handleModifyOrder(const Order& order, OrderBook& book);
     
     /**
      * @brief Match orders for a specific instrument
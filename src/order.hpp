@@ -12,6 +12,7 @@
 #pragma once
 #include <cstdint>
 #include <string>
+#include <string_view>
 
 /**
  * @enum Side
@@ -46,30 +47,48 @@ struct Order {
     Action action;           // NEW, MODIFY, or CANCEL
 };
 
+/**
+ * @brief Name of a Side value, without allocation
+ */
+constexpr std::string_view sideName(Side side) {
+    return side == Side::BUY ? "BUY" : "SELL";
+}
+
+/**
+ * @brief Name of a Type value, without allocation
+ */
+constexpr std::string_view typeName(Type type) {
+    return type == Type::LIMIT ? "LIMIT" : "MARKET";
+}
+
+/**
+ * @brief Name of an Action value, without allocation
+ */
+constexpr std::string_view actionName(Action action) {
+    constexpr std::string_view names[] = {"NEW", "MODIFY", "CANCEL"};
+    auto index = static_cast<unsigned>(action);
+    return index < std::size(names) ? names[index] : "UNKNOWN";
+}
+
 /**
  * @brief Convert Side enum to string
  */
 inline std::string sideToString(Side side) {
-    return side == Side::BUY ? "BUY" : "SELL";
+    return std::string(sideName(side));
 }
 
 /**
  * @brief Convert Type enum to string
  */
 inline std::string typeToString(Type type) {
-    return type == Type::LIMIT ? "LIMIT" : "MARKET";
+    return std::string(typeName(type));
 }
 
 /**
  * @brief Convert Action enum to string
  */
 inline std::string actionToString(Action action) {
-    switch (action) {
-        case Action::NEW: return "NEW";
-        case Action::MODIFY: return "MODIFY";
-        case Action::CANCEL: return "CANCEL";
-        default: return "UNKNOWN";
-    }
+    return std::string(actionName(action));
 }
 
 /**
@@ -84,18 +103,20 @@ enum class OrderStatus {
     REJECTED              // Order is rejected
 };
 
+/**
+ * @brief Name of an OrderStatus value, without allocation
+ */
+constexpr std::string_view statusName(OrderStatus status) {
+    constexpr std::string_view names[] = {"PENDING", "PARTIALLY_EXECUTED", "EXECUTED", "CANCELED", "REJECTED"};
+    auto index = static_cast<unsigned>(status);
+    return index < std::size(names) ? names[index] : "UNKNOWN";
+}
+
 /**
  * @brief Convert OrderStatus enum to string
  */
 inline std::string statusToString(OrderStatus status) {
-    switch (status) {
-        case OrderStatus::PENDING: return "PENDING";
-        case OrderStatus::PARTIALLY_EXECUTED: return "PARTIALLY_EXECUTED";
-        case OrderStatus::EXECUTED: return "EXECUTED";
-        case OrderStatus::CANCELED: return "CANCELED";
-        case OrderStatus::REJECTED: return "REJECTED";
-        default: return "UNKNOWN";
-    }
+    return std::string(statusName(status));
 }
 
 /**
@@ -0,0 +1,138 @@
+/**
+ * @file order_batch.cpp
+ * @brief Implementation of the columnar OrderBatch.
+ */
+
+#include "order_batch.hpp"
+#include <limits>
+
+void OrderBatch::clear() {
+    timestamps_.clear();
+    orderIds_.clear();
+    instrumentIds_.clear();
+    sides_.clear();
+    types_.clear();
+    quantities_.clear();
+    prices_.clear();
+    actions_.clear();
+}
+
+void OrderBatch::reserve(size_t orders) {
+    timestamps_.reserve(orders);
+    orderIds_.reserve(orders);
+    instrumentIds_.reserve(orders);
+    sides_.reserve(orders);
+    types_.reserve(orders);
+    quantities_.reserve(orders);
+    prices_.reserve(orders);
+    actions_.reserve(orders);
+}
+
+/**
+ * @brief Looks the symbol up without building a string; only new symbols are copied.
+ */
+uint32_t OrderBatch::internSymbol(std::string_view symbol) {
+    auto it = symbolIds_.find(symbol);
+    if (it != symbolIds_.end()) {
+        return it->second;
+    }
+    uint32_t id = static_cast<uint32_t>(symbols_.size());
+    symbols_.emplace_back(symbol);
+    symbolIds_.emplace(symbols_.back(), id);
+    return id;
+}
+
+void OrderBatch::append(uint64_t timestamp, int orderId, uint32_t instrumentId, Side side, Type type,
+                        int quantity, float price, Action action) {
+    timestamps_.push_back(timestamp);
+    orderIds_.push_back(orderId);
+    instrumentIds_.push_back(instrumentId);
+    sides_.push_back(static_cast<uint8_t>(side));
+    types_.push_back(static_cast<uint8_t>(type));
+    quantities_.push_back(quantity);
+    prices_.push_back(price);
+    actions_.push_back(static_cast<uint8_t>(action));
+}
+
+void OrderBatch::append(const Order& order) {
+    append(order.timestamp, order.order_id, internSymbol(order.instrument), order.side, order.type,
+           order.quantity, order.price, order.action);
+}
+
+void OrderBatch::toOrder(size_t index, Order& order) const {
+    order.timestamp = timestamps_[index];
+    order.order_id = orderIds_[index];
+    uint32_t instrumentId = instrumentIds_[index];
+    if (instrumentId < symbols_.size()) {
+        order.instrument = symbols_[instrumentId];
+    } else {
+        order.instrument.clear();
+    }
+    order.side = static_cast<Side>(sides_[index]);
+    order.type = static_cast<Type>(types_[index]);
+    order.quantity = quantities_[index];
+    order.price = prices_[index];
+    order.action = static_cast<Action>(actions_[index]);
+}
+
+/**
+ * @brief Checks every row with branch-free comparisons.
+ *
+ * Each condition is evaluated for every row and combined with bitwise ands, so the loop
+ * has no data-dependent branch and vectorizes. The price test also rejects NaN, which
+ * fails both comparisons.
+ */
+size_t OrderBatch::validate(Column<uint8_t>& valid) const {
+    const size_t n = size();
+    valid.resize(n);
+
+    const uint32_t symbolCount = static_cast<uint32_t>(symbols_.size());
+    const float maxPrice = std::numeric_limits<float>::max();
+    const uint32_t* instrumentIds = instrumentIds_.data();
+    const uint8_t* sides = sides_.data();
+    const uint8_t* types = types_.data();
+    const int32_t* quantities = quantities_.data();
+    const float* prices = prices_.data();
+    const uint8_t* actions = actions_.data();
+    uint8_t* out = valid.data();
+
+    size_t count = 0;
+    for (size_t i = 0; i < n; ++i) {
+        uint8_t ok = static_cast<uint8_t>((quantities[i] >= 0) & (prices[i] >= 0.0f) & (prices[i] <= maxPrice)
+                                          & (sides[i] <= static_cast<uint8_t>(Side::SELL))
+                                          & (types[i] <= static_cast<uint8_t>(Type::LIMIT))
+                                          & (actions[i] <= static_cast<uint8_t>(Action::CANCEL))
+                                          & (instrumentIds[i] < symbolCount));
+        out[i] = ok;
+        count += ok;
+    }
+    return count;
+}
+
+/**
+ * @brief Counts the rows of each instrument, then scatters the row indices.
+ *
+ * The scatter walks the rows in order, so each group keeps the batch order.
+ */
+void OrderBatch::groupByInstrument(std::vector<uint32_t>& offsets, std::vector<uint32_t>& indices) const {
+    const size_t n = size();
+    const size_t symbolCount = symbols_.size();
+    offsets.assign(symbolCount + 1, 0);
+
+    for (size_t i = 0; i < n; ++i) {
+        if (instrumentIds_[i] < symbolCount) {
+            ++offsets[instrumentIds_[i] + 1];
+        }
+    }
+    for (size_t s = 0; s < symbolCount; ++s) {
+        offsets[s + 1] += offsets[s];
+    }
+
+    indices.resize(offsets[symbolCount]);
+    std::vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+    for (size_t i = 0; i < n; ++i) {
+        if (instrumentIds_[i] < symbolCount) {
+            indices[cursor[instrumentIds_[i]]++] = static_cast<uint32_t>(i);
+        }
+    }
+}
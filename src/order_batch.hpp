@@ -0,0 +1,172 @@
+/**
+ * @file order_batch.hpp
+ * @brief Defines the OrderBatch class, a struct-of-arrays batch of orders.
+ *
+ * An OrderBatch stores each order field in its own cache-line-aligned column instead of
+ * an array of Order objects. Instruments are stored as ids into a symbol dictionary
+ * owned by the batch, so no column holds a std::string. Passes over whole batches
+ * (validation, grouping by instrument) then read a few dense arrays of plain integers
+ * and floats, which the compiler can vectorize.
+ *
+ * The dictionary survives clear(), so a batch reused across calls keeps the same id for
+ * a symbol and consumers can cache per-symbol state (e.g. the order book) by id.
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "order.hpp"
+
+/**
+ * @class AlignedAllocator
+ * @brief Allocator returning storage aligned to a given boundary
+ */
+template <typename T, size_t Alignment>
+class AlignedAllocator {
+public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() = default;
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) {}
+
+    T* allocate(size_t n) {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+    }
+
+    void deallocate(T* p, size_t) {
+        ::operator delete(p, std::align_val_t(Alignment));
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const { return true; }
+};
+
+/**
+ * @class OrderBatch
+ * @brief Columnar batch of orders with a symbol dictionary
+ */
+class OrderBatch {
+public:
+    /**
+     * @brief Alignment of every column, one cache line
+     */
+    static constexpr size_t ALIGNMENT = 64;
+
+    /**
+     * @brief Storage of one column
+     */
+    template <typename T>
+    using Column = std::vector<T, AlignedAllocator<T, ALIGNMENT>>;
+
+    /**
+     * @brief Number of orders in the batch
+     */
+    size_t size() const { return timestamps_.size(); }
+
+    /**
+     * @brief Checks whether the batch holds no order
+     */
+    bool empty() const { return timestamps_.empty(); }
+
+    /**
+     * @brief Removes every order, keeping the capacity and the symbol dictionary
+     */
+    void clear();
+
+    /**
+     * @brief Reserves room for a number of orders in every column
+     */
+    void reserve(size_t orders);
+
+    /**
+     * @brief Returns the id of a symbol, adding it to the dictionary if needed
+     */
+    uint32_t internSymbol(std::string_view symbol);
+
+    /**
+     * @brief Symbol dictionary, indexed by instrument id
+     */
+    const std::vector<std::string>& symbols() const { return symbols_; }
+
+    /**
+     * @brief Appends an order given field by field
+     */
+    void append(uint64_t timestamp, int orderId, uint32_t instrumentId, Side side, Type type,
+                int quantity, float price, Action action);
+
+    /**
+     * @brief Appends an Order, interning its instrument
+     */
+    void append(const Order& order);
+
+    /**
+     * @brief Converts one row back to an Order
+     *
+     * Rows whose instrument id is not in the dictionary get an empty instrument.
+     */
+    void toOrder(size_t index, Order& order) const;
+
+    /**
+     * @brief Checks every row in one pass over the columns
+     *
+     * A row is valid if its quantity is not negative, its price is finite and not
+     * negative, its side, type and action are known and its instrument is in the
+     * dictionary.
+     *
+     * @param valid Receives 1 for each valid row and 0 for each invalid one
+     * @return size_t Number of valid rows
+     */
+    size_t validate(Column<uint8_t>& valid) const;
+
+    /**
+     * @brief Groups the rows by instrument with a counting sort
+     *
+     * The rows of instrument id s are indices[offsets[s]] to indices[offsets[s + 1]],
+     * in batch order. Rows with an unknown instrument are left out.
+     *
+     * @param offsets Receives symbols().size() + 1 offsets into indices
+     * @param indices Receives the row indices grouped by instrument
+     */
+    void groupByInstrument(std::vector<uint32_t>& offsets, std::vector<uint32_t>& indices) const;
+
+    const uint64_t* timestamps() const { return timestamps_.data(); }
+    const int32_t* orderIds() const { return orderIds_.data(); }
+    const uint32_t* instrumentIds() const { return instrumentIds_.data(); }
+    const uint8_t* sides() const { return sides_.data(); }
+    const uint8_t* types() const { return types_.data(); }
+    const int32_t* quantities() const { return quantities_.data(); }
+    const float* prices() const { return prices_.data(); }
+    const uint8_t* actions() const { return actions_.data(); }
+
+private:
+    /**
+     * @brief Hash accepting both std::string and std::string_view keys
+     */
+    struct SymbolHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view symbol) const { return std::hash<std::string_view>()(symbol); }
+    };
+
+    Column<uint64_t> timestamps_;     ///< Timestamps in nanoseconds
+    Column<int32_t> orderIds_;        ///< Order identifiers
+    Column<uint32_t> instrumentIds_;  ///< Indices into symbols_
+    Column<uint8_t> sides_;           ///< Side values
+    Column<uint8_t> types_;           ///< Type values
+    Column<int32_t> quantities_;      ///< Quantities
+    Column<float> prices_;            ///< Prices
+    Column<uint8_t> actions_;         ///< Action values
+
+    std::vector<std::string> symbols_;  ///< Symbol dictionary, by id
+    std::unordered_map<std::string, uint32_t, SymbolHash, std::equal_to<>> symbolIds_; ///< Symbol to id
+};
@@ -4,13 +4,19 @@
  */
 
 #include "order_book.hpp"
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <limits>
 
 /**
  * @brief Constructor that initializes an order book for a specific financial instrument.
  * @param instrument_ The identifier of the financial instrument.
+ * @param resource The memory resource used by the price levels, order lists and id index.
  */
-OrderBook::OrderBook(const std::string& instrument_) : instrument(instrument_) {}
+OrderBook::OrderBook(const std::string& instrument_, std::pmr::memory_resource* resource)
+    : instrument(instrument_), buy_orders(resource), sell_orders(resource), order_lookup(resource),
+      changed_levels(resource) {}
 
 /**
  * @brief Returns the identifier of the instrument this order book is for.
@@ -20,6 +26,14 @@ const std::string& OrderBook::getInstrument() const {
     return instrument;
 }
 
+/**
+ * @brief Returns the memory resource all of the book's containers allocate from.
+ * @return The memory resource given at construction.
+ */
+std::pmr::memory_resource* OrderBook::getMemoryResource() const {
+    return order_lookup.get_allocator().resource();
+}
+
 /**
  * @brief Gets the map of buy orders sorted by price in descending order.
  * 
@@ -28,7 +42,7 @@ const std::string& OrderBook::getInstrument() const {
  * 
  * @return Reference to the map of buy orders organized by price.
  */
-std::map<double, std::list<Order>, std::greater<double>>& OrderBook::getBuyOrderMap() {
+OrderBook::BuyLevels& OrderBook::getBuyOrderMap() {
     return buy_orders;
 }
 
@@ -40,7 +54,7 @@ std::map<double, std::list<Order>, std::greater<double>>& OrderBook::getBuyOrder
  * 
  * @return Reference to the map of sell orders organized by price.
  */
-std::map<double, std::list<Order>>& OrderBook::getSellOrderMap() {
+OrderBook::SellLevels& OrderBook::getSellOrderMap() {
     return sell_orders;
 }
 
@@ -55,8 +69,8 @@ std::map<double, std::list<Order>>& OrderBook::getSellOrderMap() {
  * @param side The side of the order (BUY or SELL).
  * @return Reference to the map of buy orders.
  */
-std::map<double, std::list<Order>, std::greater<double>>& OrderBook::getOrderMap(Side side) {
-    static_assert(sizeof(std::list<Order>) == sizeof(std::list<Order>), 
+OrderBook::BuyLevels& OrderBook::getOrderMap(Side side) {
+    static_assert(sizeof(OrderList) == sizeof(OrderList), 
                   "This function always returns buy_orders, but uses this static_assert "
                   "to prevent compiler warnings.");
     if (side == Side::BUY) {
@@ -87,6 +101,7 @@ void OrderBook::addOrder(const Order& order) {
         auto it = std::prev(order_list.end());
         order_lookup[order.order_id] = { order.side, it };
     }
+    recordLevel(order.side, order.price);
 }
 
 /**
@@ -121,6 +136,7 @@ bool OrderBook::cancelOrder(int order_id) {
     }
 
     order_lookup.erase(order_id);
+    recordLevel(side, price);
     return true;
 }
 
@@ -141,12 +157,154 @@ bool OrderBook::modifyOrder(const Order& new_order) {
     return true;
 }
 
+/**
+ * @brief Finds a resting order through the id index.
+ * 
+ * @param order_id The ID of the order.
+ * @return Pointer to the order in its price level, nullptr if not found.
+ */
+const Order* OrderBook::findOrder(int order_id) const {
+    auto it = order_lookup.find(order_id);
+    return it == order_lookup.end() ? nullptr : &*it->second.second;
+}
+
+/**
+ * @brief Enables or disables the recording of changed price levels.
+ * 
+ * @param enabled True to record changed levels.
+ */
+void OrderBook::setLevelTracking(bool enabled) {
+    track_levels = enabled;
+    changed_levels.clear();
+}
+
+/**
+ * @brief Forgets the recorded price levels, keeping the capacity for the next order.
+ */
+void OrderBook::clearLevelChanges() {
+    changed_levels.clear();
+}
+
+/**
+ * @brief Records a price level the first time it changes.
+ * 
+ * An order changes at most a few levels, so a linear scan is cheaper than a set.
+ * 
+ * @param side The side of the level.
+ * @param price The price of the level.
+ */
+void OrderBook::recordLevel(Side side, double price) {
+    if (!track_levels) {
+        return;
+    }
+    std::pair<Side, double> level(side, price);
+    if (std::find(changed_levels.begin(), changed_levels.end(), level) == changed_levels.end()) {
+        changed_levels.push_back(level);
+    }
+}
+
+/**
+ * @brief Reads the current state of each recorded level.
+ * 
+ * The order count comes from the level's list size; the quantity is summed over the
+ * level's orders. A level that no longer exists is reported with quantity and count 0.
+ * 
+ * @param deltas Vector the deltas are appended to.
+ * @return The number of deltas appended.
+ */
+size_t OrderBook::levelDeltas(std::vector<LevelDelta>& deltas) const {
+    for (const auto& [side, price] : changed_levels) {
+        LevelDelta delta{side, price, 0, 0};
+        const OrderList* orders = nullptr;
+        if (side == Side::BUY) {
+            auto it = buy_orders.find(price);
+            orders = it != buy_orders.end() ? &it->second : nullptr;
+        } else {
+            auto it = sell_orders.find(price);
+            orders = it != sell_orders.end() ? &it->second : nullptr;
+        }
+        if (orders) {
+            delta.count = static_cast<int>(orders->size());
+            for (const auto& order : *orders) {
+                delta.quantity += order.quantity;
+            }
+        }
+        deltas.push_back(delta);
+    }
+    return changed_levels.size();
+}
+
+/**
+ * @brief Pre-sizes the order id index so that it does not rehash during the session.
+ * 
+ * @param expected_orders Expected number of live orders in the book.
+ */
+void OrderBook::reserve(size_t expected_orders) {
+    order_lookup.reserve(expected_orders);
+}
+
+/**
+ * @brief Sets the minimum price increment used to validate limit prices.
+ * 
+ * @param tick_size_ The tick size, 0 to disable tick checks.
+ */
+void OrderBook::setTickSize(double tick_size_) {
+    tick_size = tick_size_;
+}
+
+/**
+ * @brief Returns the minimum price increment of the instrument.
+ * @return The tick size, 0 if not set.
+ */
+double OrderBook::getTickSize() const {
+    return tick_size;
+}
+
+/**
+ * @brief Checks whether a price lies on the tick grid.
+ * 
+ * Prices are stored as float, so the check tolerates the rounding error of the
+ * float representation rather than requiring an exact multiple. The distance to the
+ * nearest grid price is compared in price units: a float cent price such as 100.01
+ * is off the grid by up to half a float ulp, which is far above a fixed fraction of
+ * a tick once prices reach a few hundred.
+ * 
+ * @param price The price to check.
+ * @return true if the price is a multiple of the tick size or no tick size is set.
+ */
+bool OrderBook::isValidPrice(double price) const {
+    if (tick_size <= 0.0) {
+        return true;
+    }
+    double nearest = std::round(price / tick_size) * tick_size;
+    double tolerance = std::max(tick_size * 1e-3, std::fabs(price) * std::numeric_limits<float>::epsilon());
+    return std::fabs(price - nearest) <= tolerance;
+}
+
+/**
+ * @brief Estimates the memory a book of a given size allocates.
+ * 
+ * Counts one list node and one id index node per order, one map node per price
+ * level on each side, and the id index bucket array.
+ * 
+ * @param expected_orders Expected number of live orders.
+ * @param expected_levels Expected number of price levels per side.
+ * @return Approximate number of bytes.
+ */
+size_t OrderBook::estimateMemory(size_t expected_orders, size_t expected_levels) {
+    const size_t listNode = sizeof(Order) + 2 * sizeof(void*);
+    const size_t lookupNode = sizeof(OrderLookup::value_type) + 2 * sizeof(void*);
+    const size_t levelNode = sizeof(BuyLevels::value_type) + 4 * sizeof(void*);
+    const size_t bucket = sizeof(void*);
+    return expected_orders * (listNode + lookupNode + bucket) + 2 * expected_levels * levelNode;
+}
+
 /**
  * @brief Gets a const reference to the buy side of the order book.
  * 
  * @return Const reference to the map of buy orders sorted by price.
  */
-const std::map<double, std::list<Order>, std::greater<double>>& OrderBook::getBuySide() const {
+const OrderBook::BuyLevels& OrderBook::getBuySide() const {
     return buy_orders;
 }
 
@@ -155,6 +313,6 @@ const std::map<double, std::list<Order>, std::greater<double>>& OrderBook::getBu
  * 
  * @return Const reference to the map of sell orders sorted by price.
  */
-const std::map<double, std::list<Order>>& OrderBook::getSellSide() const {
+const OrderBook::SellLevels& OrderBook::getSellSide() const {
     return sell_orders;
 }
@@ -10,16 +10,46 @@
 #pragma once
 #include <map>
 #include <list>
+#include <memory_resource>
 #include <unordered_map>
 #include <string>
+#include <utility>
+#include <vector>
 #include "order.hpp"
 
+/**
+ * @struct LevelDelta
+ * @brief New state of a price level changed by an order
+ */
+struct LevelDelta {
+    Side side;       // Side of the level
+    double price;    // Price of the level
+    int quantity;    // Total quantity resting at the level, 0 if the level is gone
+    int count;       // Number of orders at the level
+};
+
 /**
  * @class OrderBook
  * @brief Maintains the order book for a specific instrument
+ * 
+ * All containers (price levels, order lists and the id index) allocate from the
+ * std::pmr::memory_resource given at construction, so a book can live in an arena
+ * or a per-thread pool instead of the global heap.
  */
 class OrderBook {
 public:
+    // Orders resting at a single price level, in time priority
+    using OrderList = std::pmr::list<Order>;
+    
+    // BUY side price levels, sorted from high to low price
+    using BuyLevels = std::pmr::map<double, OrderList, std::greater<double>>;
+    
+    // SELL side price levels, sorted from low to high price
+    using SellLevels = std::pmr::map<double, OrderList>;
+    
+    // Maps order_id to pair of (side, iterator to order in the list)
+    using OrderLookup = std::pmr::unordered_map<int, std::pair<Side, OrderList::iterator>>;
+    
     /**
      * @brief Default constructor required for std::unordered_map
      */
@@ -29,8 +59,10 @@ public:
      * @brief Constructor with instrument name
      * 
      * @param instrument The instrument identifier
+     * @param resource Memory resource used by all the book's containers
      */
-    OrderBook(const std::string& instrument);
+    OrderBook(const std::string& instrument,
+              std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
     /**
      * @brief Add a new order to the book
@@ -55,55 +87,141 @@ public:
      */
     bool modifyOrder(const Order& order);
     
+    /**
+     * @brief Find a resting order by its ID
+     * 
+     * @param order_id The ID of the order
+     * @return const Order* The order as it rests in the book, nullptr if not found
+     */
+    const Order* findOrder(int order_id) const;
+    
+    /**
+     * @brief Enable or disable the recording of changed price levels
+     * 
+     * When enabled, every add and cancel records its price level, once per level until
+     * clearLevelChanges() is called. Disabling also clears the recorded levels.
+     * 
+     * @param enabled True to record changed levels
+     */
+    void setLevelTracking(bool enabled);
+    
+    /**
+     * @brief Forget the price levels recorded so far
+     */
+    void clearLevelChanges();
+    
+    /**
+     * @brief Append the new state of every level changed since the last clear
+     * 
+     * Levels are listed in the order they were first changed. The cost is proportional
+     * to the number of orders at the changed levels, not to the size of the book.
+     * 
+     * @param deltas Vector the deltas are appended to
+     * @return size_t The number of deltas appended
+     */
+    size_t levelDeltas(std::vector<LevelDelta>& deltas) const;
+    
+    /**
+     * @brief Pre-size the order id index for an expected number of live orders
+     * 
+     * @param expected_orders Expected number of live orders in the book
+     */
+    void reserve(size_t expected_orders);
+    
+    /**
+     * @brief Set the minimum price increment of the instrument
+     * 
+     * @param tick_size The tick size (0 disables tick checks)
+     */
+    void setTickSize(double tick_size);
+    
+    /**
+     * @brief Get the minimum price increment of the instrument
+     * 
+     * @return double The tick size, 0 if not set
+     */
+    double getTickSize() const;
+    
+    /**
+     * @brief Check whether a limit price is a multiple of the tick size
+     * 
+     * @param price The price to check
+     * @return bool True if the price is on the tick grid or no tick size is set
+     */
+    bool isValidPrice(double price) const;
+    
+    /**
+     * @brief Estimate the memory used by a book of a given size
+     * 
+     * @param expected_orders Expected number of live orders
+     * @param expected_levels Expected number of price levels per side
+     * @return size_t Approximate number of bytes allocated from the memory resource
+     */
+    static size_t estimateMemory(size_t expected_orders, size_t expected_levels);
+    
     /**
      * @brief Get the instrument name
      * 
      * @return const std::string& The instrument identifier
      */
     const std::string& getInstrument() const;
+    
+    /**
+     * @brief Get the memory resource used by the book's containers
+     * 
+     * @return std::pmr::memory_resource* The book's memory resource
+     */
+    std::pmr::memory_resource* getMemoryResource() const;
 
     /**
      * @brief Get the buy side of the book
      * 
-     * @return const std::map<double, std::list<Order>, std::greater<double>>& 
-     *         Buy orders sorted from highest to lowest price
+     * @return const BuyLevels& Buy orders sorted from highest to lowest price
      */
-    const std::map<double, std::list<Order>, std::greater<double>>& getBuySide() const;
+    const BuyLevels& getBuySide() const;
     
     /**
      * @brief Get the sell side of the book
      * 
-     * @return const std::map<double, std::list<Order>>& 
-     *         Sell orders sorted from lowest to highest price
+     * @return const SellLevels& Sell orders sorted from lowest to highest price
      */
-    const std::map<double, std::list<Order>>& getSellSide() const;
+    const SellLevels& getSellSide() const;
 
 private:
     std::string instrument;  // Instrument identifier
+    double tick_size = 0.0;  // Minimum price increment (0 if unknown)
 
     // BUY side sorted from high to low price (best prices first)
-    std::map<double, std::list<Order>, std::greater<double>> buy_orders;
+    BuyLevels buy_orders;
     
     // SELL side sorted from low to high price (best prices first)
-    std::map<double, std::list<Order>> sell_orders;
+    SellLevels sell_orders;
 
     // Quick lookup for MODIFY and CANCEL operations
-    // Maps order_id to pair of (side, iterator to order in the list)
-    std::unordered_map<int, std::pair<Side, std::list<Order>::iterator>> order_lookup;
+    OrderLookup order_lookup;
+    
+    // Price levels changed since the last clearLevelChanges(), if tracking is enabled
+    bool track_levels = false;
+    std::pmr::vector<std::pair<Side, double>> changed_levels;
+    
+    /**
+     * @brief Record a changed price level if tracking is enabled
+     */
+    void recordLevel(Side side, double price);
 
     /**
      * @brief Helper to get the buy order map for internal use
      */
-    std::map<double, std::list<Order>, std::greater<double>>& getBuyOrderMap();
+    BuyLevels& getBuyOrderMap();
     
     /**
      * @brief Helper to get the sell order map for internal use
      */
-    std::map<double, std::list<Order>>& getSellOrderMap();
+    SellLevels& getSellOrderMap();
     
     /**
      * @brief Legacy helper for compatibility
      * @note Has limitations and should be used with caution
      */
-    std::map<double, std::list<Order>, std::greater<double>>& getOrderMap(Side side);
+    BuyLevels& getOrderMap(Side side);
 };
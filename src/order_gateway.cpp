@@ -0,0 +1,381 @@
+/**
+ * @file order_gateway.cpp
+ * @brief Implementation of the TCP order-entry gateway.
+ */
+
+#include "order_gateway.hpp"
+#include "logger.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+/**
+ * @brief epoll tags of the non-session descriptors; sessions use their id
+ */
+static constexpr uint64_t LISTEN_TAG = UINT64_MAX;
+static constexpr uint64_t RESPONSE_TAG = UINT64_MAX - 1;
+
+OrderGateway::OrderGateway(MatchingEngine& engine, const GatewayOptions& options)
+    : engine_(engine), options_(options), stop_(false), engineStop_(false),
+      requests_(options.queueCapacity), responses_(options.queueCapacity) {}
+
+OrderGateway::~OrderGateway() {
+    if (engineThread_.joinable()) {
+        engineStop_.store(true, std::memory_order_release);
+        signal(requestEvent_);
+        engineThread_.join();
+    }
+    for (auto& [id, session] : sessions_) {
+        close(session.fd);
+    }
+    for (int fd : {listenFd_, epollFd_, requestEvent_, responseEvent_}) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+}
+
+/**
+ * @brief Registers a descriptor with an epoll instance.
+ */
+static bool addToEpoll(int epollFd, int fd, uint32_t events, uint64_t tag) {
+    epoll_event event{};
+    event.events = events;
+    event.data.u64 = tag;
+    return epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) == 0;
+}
+
+/**
+ * @brief Creates the listening socket on 127.0.0.1 and the wake-up eventfds.
+ */
+bool OrderGateway::start() {
+    listenFd_ = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    epollFd_ = epoll_create1(EPOLL_CLOEXEC);
+    requestEvent_ = eventfd(0, EFD_CLOEXEC);
+    responseEvent_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (listenFd_ < 0 || epollFd_ < 0 || requestEvent_ < 0 || responseEvent_ < 0) {
+        std::cerr << "Erreur : impossible de créer les descripteurs de la passerelle : " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    int enable = 1;
+    setsockopt(listenFd_, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(options_.port);
+    if (bind(listenFd_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(listenFd_, SOMAXCONN) != 0) {
+        std::cerr << "Erreur : impossible d'écouter sur le port " << options_.port << " : " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    socklen_t length = sizeof(address);
+    getsockname(listenFd_, reinterpret_cast<sockaddr*>(&address), &length);
+    port_ = ntohs(address.sin_port);
+
+    if (!addToEpoll(epollFd_, listenFd_, EPOLLIN, LISTEN_TAG) || !addToEpoll(epollFd_, responseEvent_, EPOLLIN, RESPONSE_TAG)) {
+        std::cerr << "Erreur : epoll_ctl a échoué : " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    engineThread_ = std::thread(&OrderGateway::matchLoop, this);
+    ENGINE_LOG_INFO("Gateway listening on 127.0.0.1:{}", port_);
+    return true;
+}
+
+/**
+ * @brief Waits for socket and queue events and serves them until stopped.
+ *
+ * Each iteration handles every ready descriptor, then moves the reports produced by the
+ * engine into the session buffers, sends them, and wakes the engine once if any request
+ * was queued.
+ */
+void OrderGateway::run() {
+    std::vector<epoll_event> events(static_cast<size_t>(std::max(options_.maxEvents, 1)));
+    while (!stop_.load(std::memory_order_acquire)) {
+        int ready = epoll_wait(epollFd_, events.data(), static_cast<int>(events.size()), -1);
+        if (ready < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            std::cerr << "Erreur : epoll_wait a échoué : " << std::strerror(errno) << std::endl;
+            break;
+        }
+
+        for (int i = 0; i < ready; ++i) {
+            uint64_t tag = events[i].data.u64;
+            if (tag == LISTEN_TAG) {
+                acceptSessions();
+            } else if (tag == RESPONSE_TAG) {
+                uint64_t count;
+                while (read(responseEvent_, &count, sizeof(count)) > 0) {
+                }
+            } else if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+                readSession(tag);
+            } else if (events[i].events & EPOLLOUT) {
+                auto it = sessions_.find(tag);
+                if (it != sessions_.end() && !it->second.dirty) {
+                    it->second.dirty = true;
+                    dirty_.push_back(tag);
+                }
+            }
+        }
+
+        if (requestsPending_) {
+            signal(requestEvent_);
+            requestsPending_ = false;
+        }
+        drainResponses();
+        flushSessions();
+    }
+}
+
+void OrderGateway::stop() {
+    stop_.store(true, std::memory_order_release);
+    signal(responseEvent_);
+}
+
+void OrderGateway::signal(int fd) {
+    uint64_t one = 1;
+    ssize_t written = write(fd, &one, sizeof(one));
+    (void)written; // Only fails if the counter would overflow, and then the reader is awake anyway
+}
+
+void OrderGateway::acceptSessions() {
+    while (true) {
+        int fd = accept4(listenFd_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                std::cerr << "Erreur : accept a échoué : " << std::strerror(errno) << std::endl;
+            }
+            return;
+        }
+        int enable = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+
+        uint64_t id = nextSession_++;
+        if (!addToEpoll(epollFd_, fd, EPOLLIN, id)) {
+            close(fd);
+            continue;
+        }
+        sessions_[id].fd = fd;
+        ++stats_.sessions;
+        ENGINE_LOG_INFO("Session {} connected", id);
+    }
+}
+
+/**
+ * @brief Reads up to readSize bytes from a session and queues every complete message.
+ */
+void OrderGateway::readSession(uint64_t id) {
+    auto it = sessions_.find(id);
+    if (it == sessions_.end()) {
+        return;
+    }
+    Session& session = it->second;
+
+    size_t used = session.in.size();
+    session.in.resize(used + options_.readSize);
+    ssize_t got = recv(session.fd, session.in.data() + used, options_.readSize, 0);
+    if (got <= 0) {
+        session.in.resize(used);
+        if (got < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+            return;
+        }
+        ENGINE_LOG_INFO("Session {} disconnected", id);
+        closeSession(id);
+        return;
+    }
+    session.in.resize(used + static_cast<size_t>(got));
+    ++stats_.recvCalls;
+
+    if (!parseMessages(id, session)) {
+        ++stats_.protocolErrors;
+        std::cerr << "Erreur : message invalide sur la session " << id << ", connexion fermée" << std::endl;
+        closeSession(id);
+    }
+}
+
+/**
+ * @brief Queues every complete message at the front of the session's input.
+ *
+ * A partial message at the end stays in the buffer until the rest arrives.
+ */
+bool OrderGateway::parseMessages(uint64_t id, Session& session) {
+    size_t offset = 0;
+    Request request;
+    request.session = id;
+    while (session.in.size() - offset >= sizeof(MessageHeader)) {
+        MessageHeader header;
+        std::memcpy(&header, session.in.data() + offset, sizeof(header));
+        if (header.length < sizeof(MessageHeader) || header.length > MAX_MESSAGE_SIZE) {
+            return false;
+        }
+        if (session.in.size() - offset < header.length) {
+            break;
+        }
+        if (header.type != static_cast<uint8_t>(MessageType::ORDER) || header.length != sizeof(OrderMessage)) {
+            return false;
+        }
+        std::memcpy(&request.message, session.in.data() + offset, sizeof(OrderMessage));
+        pushRequest(request);
+        offset += header.length;
+        ++stats_.messages;
+    }
+    session.in.erase(session.in.begin(), session.in.begin() + static_cast<std::ptrdiff_t>(offset));
+    return true;
+}
+
+/**
+ * @brief Queues a request; while the queue is full, the engine is woken and its reports
+ * are taken off the egress queue so that it can never block on a full egress queue.
+ */
+void OrderGateway::pushRequest(const Request& request) {
+    while (!requests_.tryPush(request)) {
+        signal(requestEvent_);
+        drainResponses();
+        std::this_thread::yield();
+    }
+    requestsPending_ = true;
+}
+
+void OrderGateway::drainResponses() {
+    Response response;
+    while (responses_.tryPop(response)) {
+        auto it = sessions_.find(response.session);
+        if (it == sessions_.end()) {
+            continue; // Session closed since the order was sent
+        }
+        Session& session = it->second;
+        const char* bytes = reinterpret_cast<const char*>(&response.report);
+        session.out.insert(session.out.end(), bytes, bytes + sizeof(response.report));
+        if (!session.dirty) {
+            session.dirty = true;
+            dirty_.push_back(response.session);
+        }
+        ++stats_.reports;
+    }
+}
+
+void OrderGateway::flushSessions() {
+    std::vector<uint64_t> dirty;
+    dirty.swap(dirty_);
+    for (uint64_t id : dirty) {
+        auto it = sessions_.find(id);
+        if (it == sessions_.end()) {
+            continue;
+        }
+        it->second.dirty = false;
+        if (!flushSession(id, it->second)) {
+            closeSession(id);
+        }
+    }
+}
+
+/**
+ * @brief Sends the pending output of a session with one send() call.
+ *
+ * If the socket buffer is full the rest stays pending and the session is registered for
+ * EPOLLOUT; the registration is dropped once everything has been sent.
+ */
+bool OrderGateway::flushSession(uint64_t id, Session& session) {
+    if (session.outSent < session.out.size()) {
+        ssize_t sent = send(session.fd, session.out.data() + session.outSent, session.out.size() - session.outSent,
+                            MSG_NOSIGNAL);
+        ++stats_.sendCalls;
+        if (sent < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+            return false;
+        }
+        if (sent > 0) {
+            session.outSent += static_cast<size_t>(sent);
+        }
+    }
+
+    bool pending = session.outSent < session.out.size();
+    if (!pending) {
+        session.out.clear();
+        session.outSent = 0;
+    }
+    if (pending != session.wantWrite) {
+        epoll_event event{};
+        event.events = EPOLLIN | (pending ? EPOLLOUT : 0u);
+        event.data.u64 = id;
+        epoll_ctl(epollFd_, EPOLL_CTL_MOD, session.fd, &event);
+        session.wantWrite = pending;
+    }
+    return true;
+}
+
+void OrderGateway::closeSession(uint64_t id) {
+    auto it = sessions_.find(id);
+    if (it == sessions_.end()) {
+        return;
+    }
+    epoll_ctl(epollFd_, EPOLL_CTL_DEL, it->second.fd, nullptr);
+    close(it->second.fd);
+    sessions_.erase(it);
+}
+
+/**
+ * @brief Processes requests until stopped, sleeping on the eventfd when none are queued.
+ *
+ * The network thread signals after queueing, so a request pushed between the last
+ * failed pop and the read() leaves the counter non-zero and the read returns at once.
+ */
+void OrderGateway::matchLoop() {
+    Request request;
+    while (true) {
+        size_t handled = 0;
+        while (requests_.tryPop(request)) {
+            handleRequest(request);
+            if (++handled % 256 == 0) {
+                signal(responseEvent_);
+            }
+        }
+        if (handled > 0) {
+            signal(responseEvent_);
+        }
+        if (engineStop_.load(std::memory_order_acquire)) {
+            return;
+        }
+        uint64_t count;
+        ssize_t got = read(requestEvent_, &count, sizeof(count));
+        (void)got;
+    }
+}
+
+/**
+ * @brief Matches one order and routes its results as ACKs and FILLs.
+ */
+void OrderGateway::handleRequest(const Request& request) {
+    if (!decodeOrder(request.message, order_)) {
+        OrderResult rejected{};
+        rejected.order_id = request.message.order_id;
+        rejected.timestamp = request.message.timestamp;
+        rejected.status = OrderStatus::REJECTED;
+        pushResponse(request.session, rejected, MessageType::ACK);
+        return;
+    }
+
+    std::vector<OrderResult> results = engine_.processOrder(order_);
+    router_.route(request.session, order_, results, [this](uint64_t session, const OrderResult& result, MessageType type) {
+        pushResponse(session, result, type);
+    });
+}
+
+void OrderGateway::pushResponse(uint64_t session, const OrderResult& result, MessageType type) {
+    Response response;
+    response.session = session;
+    encodeReport(result, type, response.report);
+    while (!responses_.tryPush(response)) {
+        signal(responseEvent_);
+        std::this_thread::yield();
+    }
+}
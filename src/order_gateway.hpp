@@ -0,0 +1,221 @@
+/**
+ * @file order_gateway.hpp
+ * @brief Defines the OrderGateway class, a local TCP order-entry server for the engine.
+ *
+ * The gateway runs two threads:
+ * - the network thread (run()) owns every socket. It waits in a level-triggered epoll
+ *   loop, reads each ready session with one large recv(), splits the bytes into
+ *   messages and queues the decoded orders for the engine. Reports coming back are
+ *   appended to the output buffer of their session, and each session with pending bytes
+ *   is flushed with one send() per loop iteration, so many messages share a syscall in
+ *   both directions.
+ * - the engine thread owns the MatchingEngine. It drains the ingress queue, processes
+ *   the orders in arrival order and queues one ACK per order for the sending session and
+ *   one FILL per resting order executed, for the session that entered it.
+ *
+ * The threads exchange fixed-size items through two SPSCQueues and wake each other with
+ * eventfds, signalled once per batch rather than once per message.
+ */
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "gateway_protocol.hpp"
+#include "matching_engine.hpp"
+#include "report_router.hpp"
+#include "spsc_queue.hpp"
+
+/**
+ * @struct GatewayOptions
+ * @brief Configuration of an OrderGateway
+ */
+struct GatewayOptions {
+    uint16_t port = 9000;          // Port on 127.0.0.1, 0 to let the kernel pick one
+    size_t queueCapacity = 65536;  // Capacity of the ingress and egress queues
+    size_t readSize = 65536;       // Bytes read from a session per recv()
+    int maxEvents = 64;            // Events handled per epoll_wait()
+};
+
+/**
+ * @struct GatewayStats
+ * @brief Counters of the network thread
+ */
+struct GatewayStats {
+    uint64_t sessions = 0;        // Connections accepted
+    uint64_t messages = 0;        // Order messages received
+    uint64_t reports = 0;         // Reports queued for sending
+    uint64_t recvCalls = 0;       // recv() calls that returned data
+    uint64_t sendCalls = 0;       // send() calls
+    uint64_t protocolErrors = 0;  // Sessions closed for a malformed message
+};
+
+/**
+ * @class OrderGateway
+ * @brief TCP order-entry gateway feeding a MatchingEngine
+ */
+class OrderGateway {
+public:
+    /**
+     * @brief Creates a stopped gateway
+     * @param engine The engine to feed; only the engine thread touches it while running
+     * @param options Port and queue sizes
+     */
+    explicit OrderGateway(MatchingEngine& engine, const GatewayOptions& options = GatewayOptions());
+
+    /**
+     * @brief Destructor that stops the engine thread and closes every socket
+     */
+    ~OrderGateway();
+
+    OrderGateway(const OrderGateway&) = delete;
+    OrderGateway& operator=(const OrderGateway&) = delete;
+
+    /**
+     * @brief Binds the listening socket and starts the engine thread
+     * @return bool False if a socket could not be created or bound
+     */
+    bool start();
+
+    /**
+     * @brief Runs the network loop on the calling thread until stop() is called
+     */
+    void run();
+
+    /**
+     * @brief Asks run() to return; safe from any thread and from a signal handler
+     */
+    void stop();
+
+    /**
+     * @brief Port the gateway listens on, known after start()
+     */
+    uint16_t port() const { return port_; }
+
+    /**
+     * @brief Counters of the network thread; consistent once run() has returned
+     */
+    const GatewayStats& stats() const { return stats_; }
+
+private:
+    /**
+     * @struct Request
+     * @brief Order received on a session, network thread to engine thread
+     */
+    struct Request {
+        uint64_t session;
+        OrderMessage message;
+    };
+
+    /**
+     * @struct Response
+     * @brief Report for a session, engine thread to network thread
+     */
+    struct Response {
+        uint64_t session;
+        ExecutionReport report;
+    };
+
+    /**
+     * @struct Session
+     * @brief Connection state owned by the network thread
+     */
+    struct Session {
+        int fd = -1;
+        std::vector<char> in;    // Received bytes not yet split into messages
+        std::vector<char> out;   // Encoded reports not yet sent
+        size_t outSent = 0;      // Bytes of out already sent
+        bool dirty = false;      // Listed in dirty_
+        bool wantWrite = false;  // Registered for EPOLLOUT
+    };
+
+    /**
+     * @brief Accepts every pending connection
+     */
+    void acceptSessions();
+
+    /**
+     * @brief Reads a session and queues its complete messages
+     */
+    void readSession(uint64_t id);
+
+    /**
+     * @brief Splits the received bytes of a session into messages
+     * @return bool False on a malformed message
+     */
+    bool parseMessages(uint64_t id, Session& session);
+
+    /**
+     * @brief Queues a request for the engine, draining responses while the queue is full
+     */
+    void pushRequest(const Request& request);
+
+    /**
+     * @brief Moves every queued response to the output buffer of its session
+     */
+    void drainResponses();
+
+    /**
+     * @brief Sends the pending output of every session that has some
+     */
+    void flushSessions();
+
+    /**
+     * @brief Sends as much of a session's output as the socket accepts
+     * @return bool False if the connection failed
+     */
+    bool flushSession(uint64_t id, Session& session);
+
+    /**
+     * @brief Closes a session and forgets it
+     */
+    void closeSession(uint64_t id);
+
+    /**
+     * @brief Engine thread loop
+     */
+    void matchLoop();
+
+    /**
+     * @brief Processes one request and queues its reports
+     */
+    void handleRequest(const Request& request);
+
+    /**
+     * @brief Queues a report, waking the network thread while the queue is full
+     */
+    void pushResponse(uint64_t session, const OrderResult& result, MessageType type);
+
+    /**
+     * @brief Adds one to an eventfd counter
+     */
+    static void signal(int fd);
+
+    MatchingEngine& engine_;
+    GatewayOptions options_;
+    uint16_t port_ = 0;
+
+    int listenFd_ = -1;         ///< Listening socket
+    int epollFd_ = -1;          ///< epoll instance of the network thread
+    int requestEvent_ = -1;     ///< Wakes the engine thread
+    int responseEvent_ = -1;    ///< Wakes the network thread
+    std::atomic<bool> stop_;    ///< Asks run() to return
+    std::atomic<bool> engineStop_; ///< Asks the engine thread to return
+    std::thread engineThread_;
+
+    SPSCQueue<Request> requests_;    ///< Network thread to engine thread
+    SPSCQueue<Response> responses_;  ///< Engine thread to network thread
+
+    // Network thread state
+    std::unordered_map<uint64_t, Session> sessions_;
+    std::vector<uint64_t> dirty_;    ///< Sessions with output to send
+    uint64_t nextSession_ = 0;
+    bool requestsPending_ = false;   ///< Requests queued since the engine was last woken
+    GatewayStats stats_;
+
+    // Engine thread state
+    ReportRouter router_;            ///< Session of each resting order
+    Order order_;                    ///< Decoded order, reused
+};
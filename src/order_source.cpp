@@ -0,0 +1,40 @@
+/**
+ * @file order_source.cpp
+ * @brief Implementation of the helpers opening order files as sources.
+ */
+
+#include "order_source.hpp"
+#include "binary_order_file.hpp"
+#include "csv_parser.hpp"
+
+/**
+ * @brief Checks the binary magic, then opens the matching source.
+ *
+ * The sources report why a file cannot be opened on standard error.
+ */
+std::unique_ptr<OrderSource> openOrderSource(const std::string& filename) {
+    if (BinaryOrderReader::isBinaryFile(filename)) {
+        auto reader = std::make_unique<BinaryOrderReader>(filename);
+        if (!reader->isOpen()) {
+            return nullptr;
+        }
+        return reader;
+    }
+    auto stream = std::make_unique<CSVOrderStream>(filename, true);
+    if (!stream->isOpen()) {
+        return nullptr;
+    }
+    return stream;
+}
+
+bool loadOrderFile(const std::string& filename, std::vector<Order>& orders) {
+    std::unique_ptr<OrderSource> source = openOrderSource(filename);
+    if (!source) {
+        return false;
+    }
+    std::vector<Order> batch;
+    while (source->next(batch, 4096) > 0) {
+        orders.insert(orders.end(), batch.begin(), batch.end());
+    }
+    return true;
+}
@@ -0,0 +1,82 @@
+/**
+ * @file order_source.hpp
+ * @brief Defines the OrderSource interface for pull-based, batched order input.
+ *
+ * Sources hand out orders in fixed-size batches so that consumers can start matching
+ * as soon as the first batch is available and memory stays bounded by the batch size
+ * instead of growing with the input file. Batches come either as Order objects or as a
+ * columnar OrderBatch.
+ *
+ * openOrderSource() and loadOrderFile() pick the source for an order file, CSV or
+ * binary, from its content.
+ */
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include "order.hpp"
+#include "order_batch.hpp"
+
+/**
+ * @class OrderSource
+ * @brief Interface of a pull-based stream of orders
+ */
+class OrderSource {
+public:
+    virtual ~OrderSource() = default;
+
+    /**
+     * @brief Fills a batch with the next orders of the stream
+     *
+     * The batch is overwritten; its capacity is reused from call to call.
+     *
+     * @param batch The batch to fill
+     * @param maxOrders The maximum number of orders to put in the batch
+     * @return size_t The number of orders in the batch, 0 once the stream is exhausted
+     */
+    virtual size_t next(std::vector<Order>& batch, size_t maxOrders) = 0;
+
+    /**
+     * @brief Fills a columnar batch with the next orders of the stream
+     *
+     * The rows are overwritten; the symbol dictionary and the capacity are kept. The
+     * default implementation converts the orders returned by the other overload; sources
+     * that can fill the columns directly override it.
+     *
+     * @param batch The batch to fill
+     * @param maxOrders The maximum number of orders to put in the batch
+     * @return size_t The number of orders in the batch, 0 once the stream is exhausted
+     */
+    virtual size_t next(OrderBatch& batch, size_t maxOrders) {
+        std::vector<Order> orders;
+        next(orders, maxOrders);
+        batch.clear();
+        batch.reserve(orders.size());
+        for (const auto& order : orders) {
+            batch.append(order);
+        }
+        return batch.size();
+    }
+};
+
+/**
+ * @brief Opens an order file as a source, binary if it starts with the binary order magic, CSV otherwise
+ *
+ * CSV files are memory-mapped.
+ *
+ * @param filename The path to the order file
+ * @return std::unique_ptr<OrderSource> The source, nullptr if the file cannot be opened
+ */
+std::unique_ptr<OrderSource> openOrderSource(const std::string& filename);
+
+/**
+ * @brief Reads every order of an order file, CSV or binary
+ *
+ * For tools and benchmarks that need the whole input in memory, e.g. to pace or time it.
+ *
+ * @param filename The path to the order file
+ * @param orders Vector the orders are appended to
+ * @return bool False if the file cannot be opened
+ */
+bool loadOrderFile(const std::string& filename, std::vector<Order>& orders);
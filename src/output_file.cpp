@@ -0,0 +1,416 @@
+/**
+ * @file output_file.cpp
+ * @brief Implementation of the OutputFile class.
+ *
+ * The io_uring instance is driven with the raw system calls and the ring layout from
+ * <linux/io_uring.h>, so no liburing is needed.
+ */
+
+#include "output_file.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#define OUTPUT_FILE_IO_URING 1
+#endif
+
+#ifdef OUTPUT_FILE_IO_URING
+/**
+ * @struct OutputFile::Ring
+ * @brief Mappings of an io_uring submission and completion queue
+ */
+struct OutputFile::Ring {
+    int fd = -1;
+    void* sqMap = MAP_FAILED;
+    size_t sqMapSize = 0;
+    void* cqMap = MAP_FAILED;
+    size_t cqMapSize = 0;
+    io_uring_sqe* sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+    size_t sqesSize = 0;
+
+    unsigned* sqHead = nullptr;
+    unsigned* sqTail = nullptr;
+    unsigned sqMask = 0;
+    unsigned* sqArray = nullptr;
+    unsigned* cqHead = nullptr;
+    unsigned* cqTail = nullptr;
+    unsigned cqMask = 0;
+    io_uring_cqe* cqes = nullptr;
+
+    bool fixedBuffers = false;  ///< True if the staging buffers are registered
+    size_t inFlight = 0;        ///< Submitted writes not yet completed
+
+    ~Ring() {
+        if (sqes != MAP_FAILED) {
+            munmap(sqes, sqesSize);
+        }
+        if (cqMap != MAP_FAILED && cqMap != sqMap) {
+            munmap(cqMap, cqMapSize);
+        }
+        if (sqMap != MAP_FAILED) {
+            munmap(sqMap, sqMapSize);
+        }
+        if (fd >= 0) {
+            ::close(fd);
+        }
+    }
+
+    /**
+     * @brief Creates the ring and maps its queues.
+     * @return False if the kernel does not provide io_uring.
+     */
+    bool setup(unsigned entries) {
+        io_uring_params params{};
+        fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+        if (fd < 0) {
+            return false;
+        }
+
+        sqMapSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cqMapSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        bool singleMap = params.features & IORING_FEAT_SINGLE_MMAP;
+        if (singleMap) {
+            sqMapSize = cqMapSize = std::max(sqMapSize, cqMapSize);
+        }
+
+        sqMap = mmap(nullptr, sqMapSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+        if (sqMap == MAP_FAILED) {
+            return false;
+        }
+        cqMap = singleMap ? sqMap
+                          : mmap(nullptr, cqMapSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+        if (cqMap == MAP_FAILED) {
+            return false;
+        }
+        sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        sqes = static_cast<io_uring_sqe*>(mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE,
+                                                MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES));
+        if (sqes == MAP_FAILED) {
+            return false;
+        }
+
+        char* sq = static_cast<char*>(sqMap);
+        sqHead = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        sqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        sqMask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        sqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        char* cq = static_cast<char*>(cqMap);
+        cqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        cqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        cqMask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+        return true;
+    }
+
+    /**
+     * @brief Queues one write and submits it to the kernel.
+     */
+    bool submitWrite(int fileFd, const char* data, size_t length, uint64_t offset, size_t bufferIndex) {
+        unsigned tail = *sqTail;
+        unsigned index = tail & sqMask;
+        io_uring_sqe& sqe = sqes[index];
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = fixedBuffers ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE;
+        sqe.fd = fileFd;
+        sqe.addr = reinterpret_cast<uint64_t>(data);
+        sqe.len = static_cast<uint32_t>(length);
+        sqe.off = offset;
+        sqe.buf_index = fixedBuffers ? static_cast<uint16_t>(bufferIndex) : 0;
+        sqe.user_data = bufferIndex;
+        sqArray[index] = index;
+        __atomic_store_n(sqTail, tail + 1, __ATOMIC_RELEASE);
+
+        while (syscall(__NR_io_uring_enter, fd, 1, 0, 0, nullptr, 0) < 0) {
+            if (errno != EINTR) {
+                return false;
+            }
+        }
+        ++inFlight;
+        return true;
+    }
+
+    /**
+     * @brief Takes the next completion, waiting for one if requested.
+     */
+    bool nextCompletion(bool wait, uint64_t& bufferIndex, int& res) {
+        while (true) {
+            unsigned head = *cqHead;
+            if (head != __atomic_load_n(cqTail, __ATOMIC_ACQUIRE)) {
+                const io_uring_cqe& cqe = cqes[head & cqMask];
+                bufferIndex = cqe.user_data;
+                res = cqe.res;
+                __atomic_store_n(cqHead, head + 1, __ATOMIC_RELEASE);
+                --inFlight;
+                return true;
+            }
+            if (!wait) {
+                return false;
+            }
+            if (syscall(__NR_io_uring_enter, fd, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0) < 0 && errno != EINTR) {
+                return false;
+            }
+        }
+    }
+};
+#else
+struct OutputFile::Ring {};
+#endif
+
+OutputFile::OutputFile() = default;
+
+OutputFile::OutputFile(const std::string& filename, const OutputOptions& options) {
+    open(filename, options);
+}
+
+OutputFile::~OutputFile() {
+    close();
+}
+
+/**
+ * @brief Opens the file and sets up the staging buffers and the ring.
+ *
+ * O_DIRECT is dropped if the file system refuses it, and io_uring is dropped if the
+ * kernel does not provide it; buffer registration is optional as it counts against
+ * the locked memory limit.
+ */
+bool OutputFile::open(const std::string& filename, const OutputOptions& options) {
+    close();
+    filename_ = filename;
+    failed_ = false;
+    offset_ = 0;
+
+    int flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+    direct_ = false;
+#ifdef O_DIRECT
+    if (options.directIo) {
+        fd_ = ::open(filename.c_str(), flags | O_DIRECT, 0644);
+        direct_ = fd_ >= 0;
+    }
+#endif
+    if (fd_ < 0) {
+        fd_ = ::open(filename.c_str(), flags, 0644);
+    }
+    if (fd_ < 0) {
+        return false;
+    }
+
+    bufferSize_ = (std::max(options.bufferSize, ALIGNMENT) + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    buffers_.resize(std::max(1u, options.queueDepth));
+    for (auto& buffer : buffers_) {
+        buffer.data = static_cast<char*>(std::aligned_alloc(ALIGNMENT, bufferSize_));
+        if (!buffer.data) {
+            std::cerr << "Erreur : allocation des tampons de " << filename_ << " impossible" << std::endl;
+            close();
+            return false;
+        }
+    }
+
+#ifdef OUTPUT_FILE_IO_URING
+    if (options.useIoUring) {
+        auto ring = std::make_unique<Ring>();
+        if (ring->setup(static_cast<unsigned>(buffers_.size()))) {
+            if (options.registerBuffers) {
+                std::vector<iovec> iovecs;
+                for (const auto& buffer : buffers_) {
+                    iovecs.push_back({buffer.data, bufferSize_});
+                }
+                ring->fixedBuffers = syscall(__NR_io_uring_register, ring->fd, IORING_REGISTER_BUFFERS,
+                                             iovecs.data(), static_cast<unsigned>(iovecs.size())) == 0;
+            }
+            ring_ = std::move(ring);
+        }
+    }
+#endif
+    return true;
+}
+
+bool OutputFile::write(const char* data, size_t size) {
+    if (fd_ < 0 || failed_) {
+        return false;
+    }
+    while (size > 0) {
+        size_t chunk = std::min(size, bufferSize_ - used_);
+        std::memcpy(buffers_[current_].data + used_, data, chunk);
+        used_ += chunk;
+        data += chunk;
+        size -= chunk;
+        if (used_ == bufferSize_ && !submitCurrent(used_)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Submits the first bytes of the current buffer, then switches to the next one.
+ *
+ * Bytes of the current buffer past the submitted length are carried over to the start
+ * of the next buffer. The next buffer is first waited for if it is still being written.
+ */
+bool OutputFile::submitCurrent(size_t bytes) {
+    size_t next = (current_ + 1) % buffers_.size();
+    if (buffers_.size() > 1 && !waitFor(next)) {
+        return false;
+    }
+
+    Buffer& buffer = buffers_[current_];
+    buffer.offset = offset_;
+    buffer.length = bytes;
+    size_t carried = used_ - bytes;
+
+    bool ok;
+#ifdef OUTPUT_FILE_IO_URING
+    if (ring_ && buffers_.size() > 1) {
+        buffer.inFlight = true;
+        ok = ring_->submitWrite(fd_, buffer.data, bytes, buffer.offset, current_);
+        if (!ok) {
+            buffer.inFlight = false;
+        }
+    } else
+#endif
+    {
+        ok = writeAll(buffer.data, bytes, buffer.offset);
+    }
+    if (!ok) {
+        failed_ = true;
+        std::cerr << "Erreur : écriture impossible dans " << filename_ << std::endl;
+        return false;
+    }
+
+    if (carried > 0) {
+        std::memcpy(buffers_[next].data, buffer.data + bytes, carried);
+    }
+    offset_ += bytes;
+    used_ = carried;
+    current_ = next;
+    return true;
+}
+
+bool OutputFile::waitFor(size_t index) {
+    while (buffers_[index].inFlight) {
+        if (!reap(true)) {
+            return false;
+        }
+    }
+    return !failed_;
+}
+
+/**
+ * @brief Consumes one io_uring completion.
+ *
+ * Short writes are completed synchronously, which only happens on nearly full disks.
+ */
+bool OutputFile::reap(bool wait) {
+#ifdef OUTPUT_FILE_IO_URING
+    uint64_t index;
+    int res;
+    if (!ring_ || !ring_->nextCompletion(wait, index, res)) {
+        failed_ = true;
+        return false;
+    }
+    Buffer& buffer = buffers_[index];
+    buffer.inFlight = false;
+    if (res < 0) {
+        failed_ = true;
+        std::cerr << "Erreur : écriture impossible dans " << filename_ << " : " << std::strerror(-res) << std::endl;
+        return false;
+    }
+    size_t written = static_cast<size_t>(res);
+    if (written < buffer.length
+        && !writeAll(buffer.data + written, buffer.length - written, buffer.offset + written)) {
+        failed_ = true;
+        return false;
+    }
+    return true;
+#else
+    (void)wait;
+    return false;
+#endif
+}
+
+bool OutputFile::writeAll(const char* data, size_t size, uint64_t offset) {
+    while (size > 0) {
+        ssize_t n = pwrite(fd_, data, size, static_cast<off_t>(offset));
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data += n;
+        size -= static_cast<size_t>(n);
+        offset += static_cast<uint64_t>(n);
+    }
+    return true;
+}
+
+bool OutputFile::flush() {
+    if (fd_ < 0 || failed_) {
+        return false;
+    }
+    size_t bytes = direct_ ? used_ / ALIGNMENT * ALIGNMENT : used_;
+    if (bytes > 0 && !submitCurrent(bytes)) {
+        return false;
+    }
+    for (size_t i = 0; i < buffers_.size(); ++i) {
+        if (!waitFor(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Writes the remaining data and releases the file, the ring and the buffers.
+ *
+ * An unaligned tail left by O_DIRECT is written after clearing O_DIRECT on the file,
+ * followed by the optional header.
+ */
+bool OutputFile::close(const void* header, size_t headerSize) {
+    if (fd_ < 0) {
+        return false;
+    }
+
+    bool ok = flush();
+    if (ok && (used_ > 0 || headerSize > 0)) {
+#ifdef O_DIRECT
+        if (direct_) {
+            fcntl(fd_, F_SETFL, fcntl(fd_, F_GETFL) & ~O_DIRECT);
+        }
+#endif
+        ok = writeAll(buffers_[current_].data, used_, offset_);
+        offset_ += used_;
+        used_ = 0;
+        if (ok && headerSize > 0) {
+            ok = writeAll(static_cast<const char*>(header), headerSize, 0);
+        }
+    }
+    if (!ok) {
+        std::cerr << "Erreur : écriture incomplète du fichier " << filename_ << std::endl;
+    }
+
+    ring_.reset();
+    ::close(fd_);
+    fd_ = -1;
+    releaseBuffers();
+    return ok;
+}
+
+void OutputFile::releaseBuffers() {
+    for (auto& buffer : buffers_) {
+        std::free(buffer.data);
+    }
+    buffers_.clear();
+    current_ = 0;
+    used_ = 0;
+}
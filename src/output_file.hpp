@@ -0,0 +1,169 @@
+/**
+ * @file output_file.hpp
+ * @brief Defines the OutputFile class, a sequential output file backed by io_uring.
+ *
+ * Data is staged in a few page-aligned buffers. Each full buffer is submitted as one
+ * large write through io_uring, so the caller keeps filling the next buffer while the
+ * kernel writes the previous ones. The file can optionally be opened with O_DIRECT to
+ * keep multi-gigabyte outputs out of the page cache, and the staging buffers can be
+ * registered with the ring to save the per-write page mapping. When io_uring is not
+ * available (old kernel, disabled by policy, non-Linux build) every buffer is written
+ * synchronously with pwrite(2) instead.
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @struct OutputOptions
+ * @brief Tuning of an OutputFile
+ */
+struct OutputOptions {
+    bool useIoUring = true;       // Submit writes through io_uring when the kernel supports it
+    bool directIo = false;        // Open with O_DIRECT to bypass the page cache
+    bool registerBuffers = true;  // Register the staging buffers with the ring
+    size_t bufferSize = 1 << 20;  // Size of each staging buffer, rounded up to the alignment
+    unsigned queueDepth = 4;      // Number of staging buffers, i.e. writes in flight
+};
+
+/**
+ * @class OutputFile
+ * @brief Write-only file written sequentially through aligned staging buffers
+ */
+class OutputFile {
+public:
+    /**
+     * @brief Alignment of the staging buffers and of O_DIRECT writes
+     */
+    static constexpr size_t ALIGNMENT = 4096;
+
+    /**
+     * @brief Default constructor, creates a closed file
+     */
+    OutputFile();
+
+    /**
+     * @brief Creates or truncates the specified file
+     * @param filename The path to the file to write
+     * @param options Backend selection and buffer sizes
+     */
+    explicit OutputFile(const std::string& filename, const OutputOptions& options = OutputOptions());
+
+    /**
+     * @brief Destructor that writes the remaining data and closes the file
+     */
+    ~OutputFile();
+
+    OutputFile(const OutputFile&) = delete;
+    OutputFile& operator=(const OutputFile&) = delete;
+
+    /**
+     * @brief Creates or truncates the specified file, closing any previous one
+     * @param filename The path to the file to write
+     * @param options Backend selection and buffer sizes
+     * @return True if the file was opened; errors are left to the caller to report
+     */
+    bool open(const std::string& filename, const OutputOptions& options = OutputOptions());
+
+    /**
+     * @brief Appends data to the file
+     * @return False if the file is not open or a previous write failed
+     */
+    bool write(const char* data, size_t size);
+
+    /**
+     * @brief Submits the staged data and waits for every write in flight
+     *
+     * With O_DIRECT only whole aligned blocks can be written; the unaligned tail stays
+     * staged until more data arrives or the file is closed.
+     *
+     * @return False if a write failed
+     */
+    bool flush();
+
+    /**
+     * @brief Writes the remaining data and closes the file
+     *
+     * For formats whose header is only known at the end, the start of the file can be
+     * overwritten with a header once every other byte has been written.
+     *
+     * @param header Bytes to write at offset 0, or nullptr
+     * @param headerSize Number of header bytes
+     * @return False if a write failed
+     */
+    bool close(const void* header = nullptr, size_t headerSize = 0);
+
+    /**
+     * @brief Checks whether a file is open
+     */
+    bool isOpen() const { return fd_ >= 0; }
+
+    /**
+     * @brief True if writes go through io_uring rather than pwrite(2)
+     */
+    bool usesIoUring() const { return ring_ != nullptr; }
+
+    /**
+     * @brief True if the file was opened with O_DIRECT
+     */
+    bool usesDirectIo() const { return direct_; }
+
+    /**
+     * @brief Number of bytes handed to write() so far
+     */
+    uint64_t size() const { return offset_ + used_; }
+
+private:
+    struct Ring;
+
+    /**
+     * @struct Buffer
+     * @brief Aligned staging buffer and the write it is part of
+     */
+    struct Buffer {
+        char* data = nullptr;   // Page-aligned storage
+        uint64_t offset = 0;    // File offset of the write in flight
+        size_t length = 0;      // Length of the write in flight
+        bool inFlight = false;  // True until the write completes
+    };
+
+    /**
+     * @brief Writes the first bytes of the current buffer and moves to the next buffer
+     */
+    bool submitCurrent(size_t bytes);
+
+    /**
+     * @brief Waits until the specified buffer is no longer being written
+     */
+    bool waitFor(size_t index);
+
+    /**
+     * @brief Consumes one completion, waiting for it if requested
+     * @return False if no completion was available or the write failed
+     */
+    bool reap(bool wait);
+
+    /**
+     * @brief Writes a range synchronously with pwrite(2), retrying short writes
+     */
+    bool writeAll(const char* data, size_t size, uint64_t offset);
+
+    /**
+     * @brief Frees the staging buffers
+     */
+    void releaseBuffers();
+
+    int fd_ = -1;                     ///< File descriptor
+    std::string filename_;            ///< The path to the file, for error messages
+    bool direct_ = false;             ///< True if opened with O_DIRECT
+    bool failed_ = false;             ///< True once a write has failed
+    std::unique_ptr<Ring> ring_;      ///< io_uring instance, null with the pwrite backend
+    std::vector<Buffer> buffers_;     ///< Staging buffers
+    size_t bufferSize_ = 0;           ///< Size of each staging buffer
+    size_t current_ = 0;              ///< Buffer being filled
+    size_t used_ = 0;                 ///< Bytes staged in the current buffer
+    uint64_t offset_ = 0;             ///< File offset of the current buffer
+};
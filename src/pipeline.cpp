@@ -0,0 +1,187 @@
+/**
+ * @file pipeline.cpp
+ * @brief Implementation of the Pipeline class.
+ */
+
+#include "pipeline.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+#include <thread>
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief Pops from a queue, yielding while it is empty.
+ */
+template <typename T>
+static T popWait(SPSCQueue<T>& queue) {
+    T value;
+    while (!queue.tryPop(value)) {
+        std::this_thread::yield();
+    }
+    return value;
+}
+
+/**
+ * @brief Pops from a queue, yielding while it is empty, and samples its occupancy.
+ */
+template <typename T>
+static T popWait(SPSCQueue<T>& queue, QueueStats& stats) {
+    size_t occupancy = queue.size();
+    stats.samples++;
+    stats.totalOccupancy += occupancy;
+    stats.maxOccupancy = std::max(stats.maxOccupancy, occupancy);
+    return popWait(queue);
+}
+
+/**
+ * @brief Pushes to a queue, yielding while it is full.
+ */
+template <typename T>
+static void pushWait(SPSCQueue<T>& queue, const T& value) {
+    while (!queue.tryPush(value)) {
+        std::this_thread::yield();
+    }
+}
+
+/**
+ * @brief Creates the batches and fills the return queues with them.
+ *
+ * One more batch than the queue depth lets a stage work on a batch while its output
+ * queue is full.
+ */
+Pipeline::Pipeline(OrderSource& source, MatchingEngine& engine, ResultWriter& writer,
+                   size_t batchSize, size_t queueDepth)
+    : source_(source), engine_(engine), writer_(writer), batchSize_(std::max<size_t>(1, batchSize)),
+      orderBatches_(queueDepth + 1), resultBatches_(queueDepth + 1),
+      orders_(queueDepth + 2), freeOrders_(queueDepth + 2),
+      results_(queueDepth + 2), freeResults_(queueDepth + 2) {
+    for (auto& batch : orderBatches_) {
+        batch.reserve(batchSize_);
+        freeOrders_.tryPush(&batch);
+    }
+    for (auto& batch : resultBatches_) {
+        batch.reserve(batchSize_);
+        freeResults_.tryPush(&batch);
+    }
+}
+
+void Pipeline::setOrderCallback(OrderCallback callback) {
+    onOrder_ = std::move(callback);
+}
+
+const PipelineStats& Pipeline::stats() const {
+    return stats_;
+}
+
+void Pipeline::run() {
+    stats_ = PipelineStats();
+    stats_.orderQueue.capacity = orders_.capacity();
+    stats_.resultQueue.capacity = results_.capacity();
+
+    auto start = Clock::now();
+    std::thread parser(&Pipeline::parseStage, this);
+    std::thread writer(&Pipeline::writeStage, this);
+    matchStage();
+    parser.join();
+    writer.join();
+    stats_.wall = Clock::now() - start;
+}
+
+/**
+ * @brief Fills free batches from the source until it is exhausted.
+ *
+ * The empty batch read at the end of the source is passed on as the end marker, so
+ * that the matcher stays the only thread returning batches to the free queue.
+ */
+void Pipeline::parseStage() {
+    auto start = Clock::now();
+    while (true) {
+        std::vector<Order>* batch = popWait(freeOrders_);
+        auto workStart = Clock::now();
+        size_t count = source_.next(*batch, batchSize_);
+        stats_.parse.busy += Clock::now() - workStart;
+        if (count == 0) {
+            batch->clear();
+            pushWait(orders_, batch);
+            break;
+        }
+        stats_.parse.items += count;
+        pushWait(orders_, batch);
+    }
+    stats_.parse.wall = Clock::now() - start;
+}
+
+/**
+ * @brief Matches each parsed batch, in order, into a result batch.
+ */
+void Pipeline::matchStage() {
+    auto start = Clock::now();
+    while (true) {
+        std::vector<Order>* batch = popWait(orders_, stats_.orderQueue);
+        if (batch->empty()) {
+            // End of the stream: recycle the marker so the next run() has every batch
+            pushWait(freeOrders_, batch);
+            break;
+        }
+        std::vector<OrderResult>* results = popWait(freeResults_);
+
+        auto workStart = Clock::now();
+        results->clear();
+        for (const auto& order : *batch) {
+            std::vector<OrderResult> orderResults = engine_.processOrder(order);
+            results->insert(results->end(), orderResults.begin(), orderResults.end());
+            if (onOrder_) {
+                onOrder_(order, orderResults);
+            }
+        }
+        stats_.match.items += batch->size();
+        stats_.match.busy += Clock::now() - workStart;
+
+        pushWait(freeOrders_, batch);
+        pushWait(results_, results);
+    }
+    pushWait(results_, static_cast<std::vector<OrderResult>*>(nullptr));
+    stats_.match.wall = Clock::now() - start;
+}
+
+/**
+ * @brief Writes each result batch, then flushes the writer.
+ */
+void Pipeline::writeStage() {
+    auto start = Clock::now();
+    while (std::vector<OrderResult>* batch = popWait(results_, stats_.resultQueue)) {
+        auto workStart = Clock::now();
+        for (const auto& result : *batch) {
+            writer_.writeOrderResult(result);
+        }
+        stats_.write.items += batch->size();
+        stats_.write.busy += Clock::now() - workStart;
+        pushWait(freeResults_, batch);
+    }
+    auto workStart = Clock::now();
+    writer_.flush();
+    stats_.write.busy += Clock::now() - workStart;
+    stats_.write.wall = Clock::now() - start;
+}
+
+void Pipeline::printStats(std::ostream& out) const {
+    auto printStage = [&out](const char* name, const StageStats& stage, const char* unit) {
+        out << "  " << std::left << std::setw(6) << name << std::right
+            << std::setw(10) << stage.items << " " << unit
+            << ", busy " << std::setw(8) << std::chrono::duration_cast<std::chrono::microseconds>(stage.busy).count() << " us"
+            << ", utilization " << std::fixed << std::setprecision(1) << stage.utilization() * 100.0 << "%" << std::endl;
+    };
+    auto printQueue = [&out](const char* name, const QueueStats& queue) {
+        out << "  " << name << " queue: mean occupancy " << std::fixed << std::setprecision(2) << queue.meanOccupancy()
+            << ", max " << queue.maxOccupancy << " / " << queue.capacity << std::endl;
+    };
+
+    out << "Pipeline (wall " << std::chrono::duration_cast<std::chrono::microseconds>(stats_.wall).count() << " us):" << std::endl;
+    printStage("parse", stats_.parse, "orders ");
+    printStage("match", stats_.match, "orders ");
+    printStage("write", stats_.write, "results");
+    printQueue("order ", stats_.orderQueue);
+    printQueue("result", stats_.resultQueue);
+}
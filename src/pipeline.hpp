@@ -0,0 +1,130 @@
+/**
+ * @file pipeline.hpp
+ * @brief Defines the Pipeline class that runs parsing, matching and writing on three threads.
+ *
+ * The parser thread pulls order batches from an OrderSource, the matcher thread runs
+ * them through the MatchingEngine and the writer thread hands the results to a
+ * ResultWriter. Stages pass batches through bounded SPSC queues, and empty batches
+ * travel back through return queues so that no batch is allocated after start-up. Once
+ * the queues fill, the wall time is set by the slowest stage instead of the sum of all three.
+ */
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+#include "matching_engine.hpp"
+#include "order_source.hpp"
+#include "result_writer.hpp"
+#include "spsc_queue.hpp"
+
+/**
+ * @struct StageStats
+ * @brief Time spent by one pipeline stage
+ */
+struct StageStats {
+    std::chrono::nanoseconds busy{0};   // Time spent working, excluding waits on queues
+    std::chrono::nanoseconds wall{0};   // Lifetime of the stage thread
+    size_t items = 0;                   // Orders or results handled
+
+    /**
+     * @brief Fraction of the wall time spent working
+     */
+    double utilization() const {
+        return wall.count() > 0 ? static_cast<double>(busy.count()) / static_cast<double>(wall.count()) : 0.0;
+    }
+};
+
+/**
+ * @struct QueueStats
+ * @brief Occupancy of a queue, sampled by its consumer at each pop
+ */
+struct QueueStats {
+    size_t capacity = 0;       // Number of slots
+    size_t samples = 0;        // Number of pops
+    size_t totalOccupancy = 0; // Sum of the sampled occupancies
+    size_t maxOccupancy = 0;   // Largest sampled occupancy
+
+    /**
+     * @brief Mean number of batches waiting in the queue
+     */
+    double meanOccupancy() const {
+        return samples > 0 ? static_cast<double>(totalOccupancy) / static_cast<double>(samples) : 0.0;
+    }
+};
+
+/**
+ * @struct PipelineStats
+ * @brief Statistics of a pipeline run
+ */
+struct PipelineStats {
+    StageStats parse;          // Parser stage, items are orders
+    StageStats match;          // Matcher stage, items are orders
+    StageStats write;          // Writer stage, items are results
+    QueueStats orderQueue;     // Parser to matcher queue
+    QueueStats resultQueue;    // Matcher to writer queue
+    std::chrono::nanoseconds wall{0}; // End-to-end time
+};
+
+/**
+ * @class Pipeline
+ * @brief Three-thread parse, match and write pipeline
+ */
+class Pipeline {
+public:
+    /**
+     * @brief Callback invoked on the matcher thread after each order
+     */
+    using OrderCallback = std::function<void(const Order&, const std::vector<OrderResult>&)>;
+
+    /**
+     * @brief Prepares a pipeline; nothing runs until run() is called
+     * @param source The orders to process
+     * @param engine The engine, used only from the matcher thread
+     * @param writer The destination of the results, used only from the writer thread
+     * @param batchSize Maximum number of orders per batch
+     * @param queueDepth Number of batches each queue can hold
+     */
+    Pipeline(OrderSource& source, MatchingEngine& engine, ResultWriter& writer,
+             size_t batchSize = 4096, size_t queueDepth = 8);
+
+    /**
+     * @brief Sets a callback run on the matcher thread after each order is matched
+     */
+    void setOrderCallback(OrderCallback callback);
+
+    /**
+     * @brief Runs the three stages until the source is exhausted and every result is written
+     */
+    void run();
+
+    /**
+     * @brief Statistics of the last run
+     */
+    const PipelineStats& stats() const;
+
+    /**
+     * @brief Prints the stage and queue statistics
+     */
+    void printStats(std::ostream& out) const;
+
+private:
+    void parseStage();
+    void matchStage();
+    void writeStage();
+
+    OrderSource& source_;                          ///< Input of the parser stage
+    MatchingEngine& engine_;                       ///< Used by the matcher stage
+    ResultWriter& writer_;                         ///< Output of the writer stage
+    size_t batchSize_;                             ///< Orders per batch
+    OrderCallback onOrder_;                        ///< Per-order hook of the matcher stage
+
+    std::vector<std::vector<Order>> orderBatches_;         ///< Storage of the order batches
+    std::vector<std::vector<OrderResult>> resultBatches_;  ///< Storage of the result batches
+    SPSCQueue<std::vector<Order>*> orders_;                ///< Parsed batches, an empty one ends the stream
+    SPSCQueue<std::vector<Order>*> freeOrders_;            ///< Order batches returned to the parser
+    SPSCQueue<std::vector<OrderResult>*> results_;         ///< Result batches, null ends the stream
+    SPSCQueue<std::vector<OrderResult>*> freeResults_;     ///< Result batches returned to the matcher
+    PipelineStats stats_;                                  ///< Statistics of the last run
+};
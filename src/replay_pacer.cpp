@@ -0,0 +1,37 @@
+/**
+ * @file replay_pacer.cpp
+ * @brief Implementation of the replay pacer.
+ */
+
+#include "replay_pacer.hpp"
+#include <thread>
+
+/**
+ * @brief Below this distance to the send time, the pacer spins instead of sleeping
+ *
+ * The spin yields on every turn so that it does not starve an engine thread sharing the core.
+ */
+static constexpr std::chrono::microseconds SPIN_WINDOW(100);
+
+ReplayPacer::Clock::time_point ReplayPacer::due(uint64_t timestamp) const {
+    if (unpaced() || timestamp <= firstTimestamp_) {
+        return start_;
+    }
+    double offset = static_cast<double>(timestamp - firstTimestamp_) / speed_;
+    return start_ + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::nano>(offset));
+}
+
+ReplayPacer::Clock::time_point ReplayPacer::wait(uint64_t timestamp) const {
+    Clock::time_point target = due(timestamp);
+    if (unpaced()) {
+        return target;
+    }
+    Clock::time_point now = Clock::now();
+    if (target - now > SPIN_WINDOW) {
+        std::this_thread::sleep_until(target - SPIN_WINDOW);
+    }
+    while (Clock::now() < target) {
+        std::this_thread::yield();
+    }
+    return target;
+}
@@ -0,0 +1,65 @@
+/**
+ * @file replay_pacer.hpp
+ * @brief Defines ReplayPacer, which schedules recorded orders at their original pace.
+ *
+ * The pacer maps order timestamps to wall-clock send times: an order is due when the
+ * time elapsed since the start of the replay, multiplied by the speed, reaches the
+ * distance between its timestamp and the first one. Keeping the original gaps (scaled)
+ * reproduces the burst structure of the recording, such as microbursts at the open,
+ * instead of sending everything back to back.
+ */
+#pragma once
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @class ReplayPacer
+ * @brief Computes and waits for the send time of each recorded order
+ */
+class ReplayPacer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Creates a pacer
+     * @param speed Replay speed: 1 for real time, 10 for ten times faster, 0 for as fast as possible
+     */
+    explicit ReplayPacer(double speed = 1.0) : speed_(speed) {}
+
+    /**
+     * @brief Starts the replay clock
+     * @param firstTimestamp Timestamp of the first order, in nanoseconds
+     * @param now Wall-clock time at which that order is due
+     */
+    void start(uint64_t firstTimestamp, Clock::time_point now = Clock::now()) {
+        firstTimestamp_ = firstTimestamp;
+        start_ = now;
+    }
+
+    /**
+     * @brief Checks whether the pacer sends as fast as possible
+     */
+    bool unpaced() const { return speed_ <= 0.0; }
+
+    /**
+     * @brief Wall-clock time at which an order is due
+     *
+     * Timestamps before the first one are due at the start.
+     */
+    Clock::time_point due(uint64_t timestamp) const;
+
+    /**
+     * @brief Waits until an order is due
+     *
+     * Sleeps while the order is far ahead, then spins (yielding) for the last stretch so that the
+     * send time does not depend on the scheduler's wake-up granularity.
+     *
+     * @return Clock::time_point The time the order was due
+     */
+    Clock::time_point wait(uint64_t timestamp) const;
+
+private:
+    double speed_;
+    uint64_t firstTimestamp_ = 0;
+    Clock::time_point start_;
+};
@@ -0,0 +1,61 @@
+/**
+ * @file report_router.hpp
+ * @brief Defines ReportRouter, which sends the results of an order to the sessions they concern.
+ *
+ * Order-entry front ends (the TCP gateway, the shared-memory ingress) serve several
+ * sessions with one engine. The first result of an order goes back to the session that
+ * sent it as an ACK; the other results are executions of resting orders and go as FILLs
+ * to the sessions that entered those orders. The router remembers the session of each
+ * resting order until it is fully executed or canceled.
+ */
+#pragma once
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "gateway_protocol.hpp"
+#include "order.hpp"
+
+/**
+ * @class ReportRouter
+ * @brief Maps resting orders to their sessions and routes results as ACKs and FILLs
+ */
+class ReportRouter {
+public:
+    /**
+     * @brief Routes the results of an order
+     * @param session Session that sent the order
+     * @param order The order as processed by the engine
+     * @param results The results returned by the engine, the order's own first
+     * @param send Called as send(session, result, MessageType) for every report
+     */
+    template <typename Send>
+    void route(uint64_t session, const Order& order, const std::vector<OrderResult>& results, Send&& send) {
+        const OrderResult& own = results.front();
+        send(session, own, MessageType::ACK);
+        if (order.action == Action::NEW
+            && (own.status == OrderStatus::PENDING || own.status == OrderStatus::PARTIALLY_EXECUTED)) {
+            owners_[order.order_id] = session;
+        } else if (order.action == Action::CANCEL && own.status == OrderStatus::CANCELED) {
+            owners_.erase(order.order_id);
+        }
+
+        for (size_t i = 1; i < results.size(); ++i) {
+            auto it = owners_.find(results[i].order_id);
+            if (it == owners_.end()) {
+                continue;
+            }
+            send(it->second, results[i], MessageType::FILL);
+            if (results[i].status == OrderStatus::EXECUTED) {
+                owners_.erase(it);
+            }
+        }
+    }
+
+    /**
+     * @brief Number of resting orders with a known session
+     */
+    size_t size() const { return owners_.size(); }
+
+private:
+    std::unordered_map<int, uint64_t> owners_;  ///< Session of each resting order
+};
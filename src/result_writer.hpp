@@ -0,0 +1,31 @@
+/**
+ * @file result_writer.hpp
+ * @brief Defines the ResultWriter interface for order result output.
+ *
+ * The matching loop hands every OrderResult to a ResultWriter without knowing how or
+ * when it reaches its destination, so output formats and threading can be swapped
+ * without touching the loop.
+ */
+#pragma once
+#include "order.hpp"
+
+/**
+ * @class ResultWriter
+ * @brief Interface of a destination for order results
+ */
+class ResultWriter {
+public:
+    virtual ~ResultWriter() = default;
+
+    /**
+     * @brief Writes an order result
+     *
+     * @param result The OrderResult to write
+     */
+    virtual void writeOrderResult(const OrderResult& result) = 0;
+
+    /**
+     * @brief Makes every result written so far durable in the destination
+     */
+    virtual void flush() = 0;
+};
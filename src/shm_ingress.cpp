@@ -0,0 +1,163 @@
+/**
+ * @file shm_ingress.cpp
+ * @brief Implementation of the engine side of the shared-memory ingress.
+ */
+
+#include "shm_ingress.hpp"
+#include <bit>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <thread>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+ShmIngressLayout::ShmIngressLayout(uint32_t maxProducers, uint32_t requestSlots, uint32_t responseSlots) {
+    requests = sizeof(ShmIngressHeader);
+    producers = requests + size_t{requestSlots} * sizeof(ShmRequestCell);
+    responses = producers + size_t{maxProducers} * sizeof(ShmProducerSlot);
+    size = responses + size_t{maxProducers} * responseSlots * sizeof(ExecutionReport);
+}
+
+/**
+ * @brief Creates, sizes and maps the object, then initializes the request cells.
+ *
+ * ftruncate() zero-fills the object, so the producer slots start unclaimed and the
+ * response rings empty. Each request cell starts with its own position as sequence
+ * number, which marks it free for the first lap. The magic number is written last.
+ */
+ShmIngressServer::ShmIngressServer(const std::string& name, MatchingEngine& engine, const ShmIngressOptions& options)
+    : name_(name), engine_(engine), stop_(false) {
+    uint32_t maxProducers = options.maxProducers < 1 ? 1 : options.maxProducers;
+    uint32_t requestSlots = static_cast<uint32_t>(std::bit_ceil(options.requestSlots < 2 ? size_t{2} : options.requestSlots));
+    uint32_t responseSlots = static_cast<uint32_t>(std::bit_ceil(options.responseSlots < 2 ? size_t{2} : options.responseSlots));
+    ShmIngressLayout layout(maxProducers, requestSlots, responseSlots);
+
+    shm_unlink(name_.c_str());
+    int fd = shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        std::cerr << "Erreur : impossible de créer la mémoire partagée " << name_ << " : " << std::strerror(errno) << std::endl;
+        return;
+    }
+    if (ftruncate(fd, static_cast<off_t>(layout.size)) != 0) {
+        std::cerr << "Erreur : impossible de dimensionner la mémoire partagée " << name_ << std::endl;
+        ::close(fd);
+        shm_unlink(name_.c_str());
+        return;
+    }
+    void* mapping = mmap(nullptr, layout.size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        std::cerr << "Erreur : impossible de projeter la mémoire partagée " << name_ << std::endl;
+        shm_unlink(name_.c_str());
+        return;
+    }
+
+    char* base = static_cast<char*>(mapping);
+    mappedSize_ = layout.size;
+    header_ = new (base) ShmIngressHeader();
+    header_->maxProducers = maxProducers;
+    header_->requestSlots = requestSlots;
+    header_->responseSlots = responseSlots;
+    header_->requestTail.store(0, std::memory_order_relaxed);
+    requests_ = reinterpret_cast<ShmRequestCell*>(base + layout.requests);
+    for (uint32_t i = 0; i < requestSlots; ++i) {
+        requests_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    producers_ = reinterpret_cast<ShmProducerSlot*>(base + layout.producers);
+    responses_ = reinterpret_cast<ExecutionReport*>(base + layout.responses);
+    std::atomic_thread_fence(std::memory_order_release);
+    header_->magic = SHM_INGRESS_MAGIC;
+}
+
+ShmIngressServer::~ShmIngressServer() {
+    if (header_) {
+        munmap(header_, mappedSize_);
+        shm_unlink(name_.c_str());
+    }
+}
+
+/**
+ * @brief Consumes published cells in position order and processes their orders.
+ *
+ * A cell is published once its sequence number is its position + 1; after copying it,
+ * the cell is handed back to producers for the next lap by storing position + slots.
+ */
+size_t ShmIngressServer::poll(size_t maxRequests) {
+    if (!header_) {
+        return 0;
+    }
+    const uint64_t mask = header_->requestSlots - 1;
+    size_t processed = 0;
+    while (processed < maxRequests) {
+        ShmRequestCell& cell = requests_[requestHead_ & mask];
+        if (cell.sequence.load(std::memory_order_acquire) != requestHead_ + 1) {
+            break;
+        }
+        uint64_t session = (uint64_t{cell.generation} << 32) | cell.producer;
+        OrderMessage message = cell.message;
+        cell.sequence.store(requestHead_ + mask + 1, std::memory_order_release);
+        ++requestHead_;
+        ++processed;
+
+        if (!decodeOrder(message, order_)) {
+            OrderResult rejected{};
+            rejected.order_id = message.order_id;
+            rejected.timestamp = message.timestamp;
+            rejected.status = OrderStatus::REJECTED;
+            pushReport(session, rejected, MessageType::ACK);
+            continue;
+        }
+        std::vector<OrderResult> results = engine_.processOrder(order_);
+        router_.route(session, order_, results, [this](uint64_t target, const OrderResult& result, MessageType type) {
+            pushReport(target, result, type);
+        });
+    }
+    stats_.requests += processed;
+    return processed;
+}
+
+void ShmIngressServer::run() {
+    while (!stop_.load(std::memory_order_acquire)) {
+        if (poll(4096) == 0) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+/**
+ * @brief Writes a report into the producer's ring if it is still the same attachment.
+ */
+void ShmIngressServer::pushReport(uint64_t session, const OrderResult& result, MessageType type) {
+    uint32_t producer = static_cast<uint32_t>(session);
+    uint32_t generation = static_cast<uint32_t>(session >> 32);
+    if (producer >= header_->maxProducers) {
+        ++stats_.orphanReports;
+        return;
+    }
+    ShmProducerSlot& slot = producers_[producer];
+    if (slot.claimed.load(std::memory_order_acquire) == 0
+        || slot.generation.load(std::memory_order_acquire) != generation) {
+        ++stats_.orphanReports;
+        return;
+    }
+
+    uint64_t tail = slot.responseTail.load(std::memory_order_relaxed);
+    if (slot.responseGeneration.load(std::memory_order_relaxed) != generation) {
+        // The producer does not read the ring until it sees its generation here
+        slot.responseHead.store(tail, std::memory_order_relaxed);
+        slot.droppedReports.store(0, std::memory_order_relaxed);
+        slot.responseGeneration.store(generation, std::memory_order_release);
+    }
+    if (tail - slot.responseHead.load(std::memory_order_acquire) >= header_->responseSlots) {
+        slot.droppedReports.fetch_add(1, std::memory_order_relaxed);
+        ++stats_.droppedReports;
+        return;
+    }
+    ExecutionReport* ring = responses_ + size_t{producer} * header_->responseSlots;
+    encodeReport(result, type, ring[tail & (header_->responseSlots - 1)]);
+    slot.responseTail.store(tail + 1, std::memory_order_release);
+    ++stats_.reports;
+}
@@ -0,0 +1,183 @@
+/**
+ * @file shm_ingress.hpp
+ * @brief Defines the shared-memory order ingress: its layout and the engine-side server.
+ *
+ * Processes on the same host submit orders to a running engine through one POSIX
+ * shared-memory object, without sockets or syscalls on the data path:
+ * - a multi-producer single-consumer request ring. Producers claim a cell with a
+ *   compare-and-swap on the shared tail, fill it and publish it through the cell's
+ *   sequence number (the bounded MPMC design of D. Vyukov, with one consumer);
+ * - one single-producer single-consumer response ring per producer slot, carrying the
+ *   ACKs and FILLs of that producer's orders.
+ *
+ * Requests and reports use the fixed-size messages of the TCP gateway (OrderMessage and
+ * ExecutionReport), so both front ends speak the same format.
+ *
+ * A producer attaches by claiming a free slot; each claim bumps the slot's generation,
+ * and reports are only delivered to the generation that entered the order. The engine
+ * thread alone resynchronizes a response ring for a new generation, so a report checked
+ * against the previous generation can never land after the new producer's first report.
+ * The engine never waits for a producer: a report that does not fit in a full response
+ * ring is dropped and counted. A producer that dies while holding a claimed request cell
+ * stalls the ring, as with any lock-free MPSC ring.
+ */
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "gateway_protocol.hpp"
+#include "matching_engine.hpp"
+#include "report_router.hpp"
+
+/**
+ * @brief Identifies a shared-memory object created by ShmIngressServer
+ */
+constexpr uint64_t SHM_INGRESS_MAGIC = 0x3153534552474E49ULL;  // "INGRESS1"
+
+/**
+ * @struct ShmIngressHeader
+ * @brief Header at the start of the shared-memory object
+ */
+struct ShmIngressHeader {
+    uint64_t magic;                              // SHM_INGRESS_MAGIC
+    uint32_t maxProducers;                       // Number of producer slots
+    uint32_t requestSlots;                       // Cells of the request ring, a power of two
+    uint32_t responseSlots;                      // Cells of each response ring, a power of two
+    uint32_t reserved;
+    alignas(64) std::atomic<uint64_t> requestTail;  // Next request position claimed by a producer
+};
+
+/**
+ * @struct ShmRequestCell
+ * @brief One request of the MPSC ring, on its own cache line
+ */
+struct alignas(64) ShmRequestCell {
+    std::atomic<uint64_t> sequence;  // Position + 1 once written, position + slots once consumed
+    uint32_t producer;               // Slot of the producer
+    uint32_t generation;             // Generation of the slot when the request was written
+    OrderMessage message;            // The order
+};
+
+/**
+ * @struct ShmProducerSlot
+ * @brief State of one producer and the indices of its response ring
+ */
+struct ShmProducerSlot {
+    alignas(64) std::atomic<uint32_t> claimed;       // 1 while a producer is attached
+    std::atomic<uint32_t> generation;                // Bumped by each claim
+    std::atomic<uint64_t> droppedReports;            // Reports lost to a full response ring
+    alignas(64) std::atomic<uint64_t> responseTail;  // Written by the engine
+    std::atomic<uint32_t> responseGeneration;        // Generation the ring was last reset for, written by the engine
+    alignas(64) std::atomic<uint64_t> responseHead;  // Written by the producer
+};
+
+static_assert(sizeof(ShmRequestCell) == 64, "A request cell should fill exactly one cache line");
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Shared-memory atomics must be lock-free");
+
+/**
+ * @brief Byte offsets of the parts of an ingress object
+ */
+struct ShmIngressLayout {
+    size_t requests;    // First ShmRequestCell
+    size_t producers;   // First ShmProducerSlot
+    size_t responses;   // First ExecutionReport of producer 0's ring
+    size_t size;        // Total size of the object
+
+    ShmIngressLayout(uint32_t maxProducers, uint32_t requestSlots, uint32_t responseSlots);
+};
+
+/**
+ * @struct ShmIngressOptions
+ * @brief Sizes of the shared-memory ingress
+ */
+struct ShmIngressOptions {
+    uint32_t maxProducers = 16;     // Producer slots
+    size_t requestSlots = 65536;    // Cells of the request ring
+    size_t responseSlots = 65536;   // Cells of each response ring
+};
+
+/**
+ * @struct ShmIngressStats
+ * @brief Counters of the engine side
+ */
+struct ShmIngressStats {
+    uint64_t requests = 0;        // Requests processed
+    uint64_t reports = 0;         // Reports delivered
+    uint64_t droppedReports = 0;  // Reports lost to a full response ring
+    uint64_t orphanReports = 0;   // Reports for a producer that has detached since
+};
+
+/**
+ * @class ShmIngressServer
+ * @brief Creates the ingress object and feeds its requests to a MatchingEngine
+ */
+class ShmIngressServer {
+public:
+    /**
+     * @brief Creates (or recreates) the shared-memory object
+     * @param name Name of the object, e.g. "/engine_in"
+     * @param engine The engine to feed, used only by the thread calling poll() or run()
+     * @param options Ring sizes and number of producer slots
+     */
+    ShmIngressServer(const std::string& name, MatchingEngine& engine,
+                     const ShmIngressOptions& options = ShmIngressOptions());
+
+    /**
+     * @brief Destructor that unmaps and unlinks the object
+     */
+    ~ShmIngressServer();
+
+    ShmIngressServer(const ShmIngressServer&) = delete;
+    ShmIngressServer& operator=(const ShmIngressServer&) = delete;
+
+    /**
+     * @brief Checks whether the object was created
+     */
+    bool isOpen() const { return header_ != nullptr; }
+
+    /**
+     * @brief Processes the queued requests
+     * @param maxRequests Maximum number of requests to process
+     * @return size_t Number of requests processed
+     */
+    size_t poll(size_t maxRequests = SIZE_MAX);
+
+    /**
+     * @brief Polls until stop() is called, yielding the CPU while the ring is empty
+     */
+    void run();
+
+    /**
+     * @brief Asks run() to return; safe from any thread and from a signal handler
+     */
+    void stop() { stop_.store(true, std::memory_order_release); }
+
+    /**
+     * @brief Engine-side counters
+     */
+    const ShmIngressStats& stats() const { return stats_; }
+
+private:
+    /**
+     * @brief Appends a report to the response ring of a producer, dropping it if full
+     *
+     * The first report for a new generation of the slot first skips the reports left in
+     * the ring and resets the drop counter, then publishes the generation.
+     */
+    void pushReport(uint64_t session, const OrderResult& result, MessageType type);
+
+    std::string name_;
+    MatchingEngine& engine_;
+    ShmIngressHeader* header_ = nullptr;
+    ShmRequestCell* requests_ = nullptr;
+    ShmProducerSlot* producers_ = nullptr;
+    ExecutionReport* responses_ = nullptr;
+    size_t mappedSize_ = 0;
+    uint64_t requestHead_ = 0;       ///< Next request position to consume
+    std::atomic<bool> stop_;
+
+    ReportRouter router_;
+    Order order_;                    ///< Decoded order, reused
+    ShmIngressStats stats_;
+};
@@ -0,0 +1,163 @@
+/**
+ * @file shm_ingress_client.cpp
+ * @brief Implementation of the producer side of the shared-memory ingress.
+ */
+
+#include "shm_ingress_client.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief Maps the object and claims the first free slot.
+ *
+ * The claim bumps the slot's generation, so reports for orders of a previous client of
+ * the slot are no longer delivered to it. The client leaves the response ring alone:
+ * the engine skips the reports already in it before its first report to the new
+ * generation, and receive() reads nothing until then.
+ */
+ShmIngressClient::ShmIngressClient(const std::string& name) {
+    int fd = shm_open(name.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        std::cerr << "Erreur : impossible d'ouvrir la mémoire partagée " << name << " : " << std::strerror(errno) << std::endl;
+        return;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(ShmIngressHeader)) {
+        std::cerr << "Erreur : mémoire partagée " << name << " invalide" << std::endl;
+        ::close(fd);
+        return;
+    }
+    size_t size = static_cast<size_t>(st.st_size);
+    void* mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        std::cerr << "Erreur : impossible de projeter la mémoire partagée " << name << std::endl;
+        return;
+    }
+
+    char* base = static_cast<char*>(mapping);
+    auto* header = reinterpret_cast<ShmIngressHeader*>(base);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (header->magic != SHM_INGRESS_MAGIC
+        || size < ShmIngressLayout(header->maxProducers, header->requestSlots, header->responseSlots).size) {
+        std::cerr << "Erreur : " << name << " n'est pas une file d'ordres partagée" << std::endl;
+        munmap(mapping, size);
+        return;
+    }
+    header_ = header;
+    mappedSize_ = size;
+    ShmIngressLayout layout(header->maxProducers, header->requestSlots, header->responseSlots);
+    requests_ = reinterpret_cast<ShmRequestCell*>(base + layout.requests);
+    auto* producers = reinterpret_cast<ShmProducerSlot*>(base + layout.producers);
+
+    for (uint32_t i = 0; i < header->maxProducers; ++i) {
+        uint32_t expected = 0;
+        if (producers[i].claimed.compare_exchange_strong(expected, 1, std::memory_order_acq_rel)) {
+            producer_ = static_cast<int>(i);
+            slot_ = &producers[i];
+            break;
+        }
+    }
+    if (!slot_) {
+        std::cerr << "Erreur : aucun emplacement de producteur libre dans " << name << std::endl;
+        return;
+    }
+    generation_ = slot_->generation.fetch_add(1, std::memory_order_acq_rel) + 1;
+    responses_ = reinterpret_cast<const ExecutionReport*>(base + layout.responses)
+                 + size_t{static_cast<uint32_t>(producer_)} * header->responseSlots;
+}
+
+ShmIngressClient::~ShmIngressClient() {
+    if (slot_) {
+        slot_->claimed.store(0, std::memory_order_release);
+    }
+    if (header_) {
+        munmap(header_, mappedSize_);
+    }
+}
+
+/**
+ * @brief Claims the cell at the shared tail with a CAS, fills it and publishes it.
+ *
+ * A cell whose sequence number is behind the claimed position has not been consumed
+ * since the previous lap, which means the ring is full.
+ */
+bool ShmIngressClient::trySubmit(const Order& order) {
+    if (!slot_) {
+        return false;
+    }
+    if (!encodeOrder(order, message_)) {
+        std::cerr << "Erreur : symbole trop long pour l'ordre " << order.order_id << std::endl;
+        return false;
+    }
+    const uint64_t mask = header_->requestSlots - 1;
+    uint64_t position = header_->requestTail.load(std::memory_order_relaxed);
+    ShmRequestCell* cell;
+    while (true) {
+        cell = &requests_[position & mask];
+        uint64_t sequence = cell->sequence.load(std::memory_order_acquire);
+        int64_t difference = static_cast<int64_t>(sequence - position);
+        if (difference == 0) {
+            if (header_->requestTail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            return false;
+        } else {
+            position = header_->requestTail.load(std::memory_order_relaxed);
+        }
+    }
+    cell->producer = static_cast<uint32_t>(producer_);
+    cell->generation = generation_;
+    cell->message = message_;
+    cell->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+/**
+ * @brief Retries until the engine frees a cell; orders that cannot be encoded fail at once.
+ */
+bool ShmIngressClient::submit(const Order& order) {
+    if (order.instrument.size() > BINARY_SYMBOL_SIZE || !slot_) {
+        return trySubmit(order);
+    }
+    while (!trySubmit(order)) {
+        std::this_thread::yield();
+    }
+    return true;
+}
+
+/**
+ * @brief Reads the reports of this client's generation.
+ *
+ * Until the engine has reset the ring for this generation, the ring still holds the
+ * previous owner's reports and the engine has sent none to this client.
+ */
+size_t ShmIngressClient::receive(std::vector<ExecutionReport>& reports, size_t maxReports) {
+    if (!slot_ || slot_->responseGeneration.load(std::memory_order_acquire) != generation_) {
+        return 0;
+    }
+    uint64_t head = slot_->responseHead.load(std::memory_order_relaxed);
+    uint64_t tail = slot_->responseTail.load(std::memory_order_acquire);
+    size_t count = static_cast<size_t>(std::min<uint64_t>(tail - head, maxReports));
+    const uint64_t mask = header_->responseSlots - 1;
+    for (size_t i = 0; i < count; ++i) {
+        reports.push_back(responses_[(head + i) & mask]);
+    }
+    slot_->responseHead.store(head + count, std::memory_order_release);
+    return count;
+}
+
+uint64_t ShmIngressClient::droppedReports() const {
+    if (!slot_ || slot_->responseGeneration.load(std::memory_order_acquire) != generation_) {
+        return 0;
+    }
+    return slot_->droppedReports.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,79 @@
+/**
+ * @file shm_ingress_client.hpp
+ * @brief Defines ShmIngressClient, the producer side of the shared-memory ingress.
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "shm_ingress.hpp"
+
+/**
+ * @class ShmIngressClient
+ * @brief Submits orders to an engine through its ingress object and reads the reports
+ *
+ * A client attaches to one producer slot for its lifetime. A client object is meant to
+ * be used by one thread; several threads or processes each use their own client.
+ */
+class ShmIngressClient {
+public:
+    /**
+     * @brief Opens the ingress object and claims a free producer slot
+     * @param name Name of the object created by ShmIngressServer
+     */
+    explicit ShmIngressClient(const std::string& name);
+
+    /**
+     * @brief Destructor that releases the producer slot and unmaps the object
+     */
+    ~ShmIngressClient();
+
+    ShmIngressClient(const ShmIngressClient&) = delete;
+    ShmIngressClient& operator=(const ShmIngressClient&) = delete;
+
+    /**
+     * @brief Checks whether the client is attached to a producer slot
+     */
+    bool isOpen() const { return producer_ >= 0; }
+
+    /**
+     * @brief Queues an order without waiting
+     * @return bool False if the request ring is full or the order cannot be encoded
+     */
+    bool trySubmit(const Order& order);
+
+    /**
+     * @brief Queues an order, yielding the CPU while the request ring is full
+     * @return bool False if the order cannot be encoded
+     */
+    bool submit(const Order& order);
+
+    /**
+     * @brief Appends the reports delivered so far, without waiting
+     * @param reports Vector the reports are appended to
+     * @param maxReports Maximum number of reports to append
+     * @return size_t Number of reports appended
+     */
+    size_t receive(std::vector<ExecutionReport>& reports, size_t maxReports = SIZE_MAX);
+
+    /**
+     * @brief Producer slot of this client, -1 if not attached
+     */
+    int producer() const { return producer_; }
+
+    /**
+     * @brief Reports the engine dropped because this client's response ring was full
+     */
+    uint64_t droppedReports() const;
+
+private:
+    ShmIngressHeader* header_ = nullptr;
+    ShmRequestCell* requests_ = nullptr;
+    ShmProducerSlot* slot_ = nullptr;
+    const ExecutionReport* responses_ = nullptr;  ///< This client's response ring
+    size_t mappedSize_ = 0;
+    int producer_ = -1;
+    uint32_t generation_ = 0;
+    OrderMessage message_;                        ///< Encoding buffer, reused
+};
@@ -0,0 +1,240 @@
+/**
+ * @file snapshot.cpp
+ * @brief Implementation of the SnapshotManager class for copy-on-write order book snapshots.
+ */
+
+#include "snapshot.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstdio>
+#include <iostream>
+#include <string_view>
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+/**
+ * @brief Formats the snapshot into a fixed buffer and drains it with write().
+ *
+ * Neither allocates nor takes a lock, so that the forked child never waits on a lock
+ * that another thread of the parent held at the time of the fork.
+ */
+class SnapshotOutput {
+public:
+    SnapshotOutput(int fd, char* buffer, size_t size) : fd_(fd), buffer_(buffer), size_(size) {}
+
+    void append(std::string_view text) {
+        while (!text.empty()) {
+            if (used_ == size_ && !flush()) {
+                return;
+            }
+            size_t n = std::min(text.size(), size_ - used_);
+            std::copy(text.data(), text.data() + n, buffer_ + used_);
+            used_ += n;
+            text.remove_prefix(n);
+        }
+    }
+
+    template <typename T>
+    void appendNumber(T value) {
+        char digits[32];
+        auto [end, error] = std::to_chars(digits, digits + sizeof(digits), value);
+        append(std::string_view(digits, static_cast<size_t>(end - digits)));
+    }
+
+    /**
+     * @brief Writes the buffered bytes, retrying partial and interrupted writes.
+     * @return false once a write has failed.
+     */
+    bool flush() {
+        size_t written = 0;
+        while (ok_ && written < used_) {
+            ssize_t n = ::write(fd_, buffer_ + written, used_ - written);
+            if (n < 0 && errno != EINTR) {
+                ok_ = false;
+            } else if (n > 0) {
+                written += static_cast<size_t>(n);
+            }
+        }
+        used_ = 0;
+        return ok_;
+    }
+
+private:
+    int fd_;
+    char* buffer_;
+    size_t size_;
+    size_t used_ = 0;
+    bool ok_ = true;
+};
+
+}  // namespace
+
+/**
+ * @brief Writes one price level to the snapshot file in input CSV format.
+ *
+ * Prices are written in the shortest form that reads back to the same float, so the
+ * snapshot rebuilds the exact book.
+ */
+template <typename Levels>
+static void writeLevels(SnapshotOutput& output, const Levels& levels) {
+    for (const auto& [level, orders] : levels) {
+        for (const Order& order : orders) {
+            output.appendNumber(order.timestamp);
+            output.append(",");
+            output.appendNumber(order.order_id);
+            output.append(",");
+            output.append(order.instrument);
+            output.append(",");
+            output.append(sideName(order.side));
+            output.append(",");
+            output.append(typeName(order.type));
+            output.append(",");
+            output.appendNumber(order.quantity);
+            output.append(",");
+            output.appendNumber(order.price);
+            output.append(",");
+            output.append(actionName(Action::NEW));
+            output.append("\n");
+        }
+    }
+}
+
+/**
+ * @brief Writes all order books to a file using only open(), write() and close().
+ *
+ * @param engine The engine to capture.
+ * @param path The file the snapshot is written to.
+ * @param buffer Formatting buffer, allocated by the caller.
+ * @param size Size of the buffer.
+ * @return true if the file was written successfully.
+ */
+static bool writeBooks(const MatchingEngine& engine, const char* path, char* buffer, size_t size) {
+    int fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return false;
+    }
+
+    SnapshotOutput output(fd, buffer, size);
+    output.append("timestamp,order_id,instrument,side,type,quantity,price,action\n");
+    for (const auto& [instrument, book] : engine.getOrderBooks()) {
+        writeLevels(output, book.getBuySide());
+        writeLevels(output, book.getSellSide());
+    }
+
+    bool ok = output.flush();
+    return ::close(fd) == 0 && ok;
+}
+
+SnapshotManager::SnapshotManager()
+    : inProgress_(false), lastSucceeded_(false), completed_(0),
+      lastPause_(0), maxPause_(0) {}
+
+SnapshotManager::~SnapshotManager() {
+    wait();
+}
+
+/**
+ * @brief Starts a snapshot of all order books without blocking matching.
+ *
+ * Forks the process: the child sees a frozen copy-on-write image of the books, writes it
+ * to a temporary file and renames it into place, then exits. A background thread in the
+ * parent waits for the child and records the result. The time spent in this method is
+ * the pause seen by the matching thread.
+ *
+ * The parent runs other threads (result writer, logger), which may hold the allocator
+ * or a stream lock at the time of the fork. The child therefore only formats into a
+ * buffer and a path prepared before the fork and calls open(), write(), rename() and
+ * _exit(); it never allocates.
+ *
+ * @param engine The engine to capture.
+ * @param path The file the snapshot is written to.
+ * @return true if the snapshot was started, false otherwise.
+ */
+bool SnapshotManager::begin(const MatchingEngine& engine, const std::string& path) {
+    if (inProgress_) {
+        return false;
+    }
+    if (waiter_.joinable()) {
+        waiter_.join();
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    // Everything the child needs is allocated before the fork
+    std::string tmpPath = path + ".tmp";
+    buffer_.resize(BUFFER_SIZE);
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        std::cerr << "Erreur : impossible de créer le processus de snapshot" << std::endl;
+        return false;
+    }
+
+    if (pid == 0) {
+        // Child: the books are frozen at the moment of the fork
+        bool ok = writeBooks(engine, tmpPath.c_str(), buffer_.data(), buffer_.size())
+                  && std::rename(tmpPath.c_str(), path.c_str()) == 0;
+        _exit(ok ? 0 : 1);
+    }
+
+    inProgress_ = true;
+    waiter_ = std::thread([this, pid]() {
+        int status = 0;
+        bool ok = waitpid(pid, &status, 0) == pid && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+        lastSucceeded_ = ok;
+        if (ok) {
+            ++completed_;
+        }
+        inProgress_ = false;
+    });
+
+    lastPause_ = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start);
+    if (lastPause_ > maxPause_) {
+        maxPause_ = lastPause_;
+    }
+    return true;
+}
+
+/**
+ * @brief Waits for the in-flight snapshot, if any, to be written.
+ * @return true if the last snapshot was written successfully.
+ */
+bool SnapshotManager::wait() {
+    if (waiter_.joinable()) {
+        waiter_.join();
+    }
+    return lastSucceeded_;
+}
+
+bool SnapshotManager::inProgress() const {
+    return inProgress_;
+}
+
+std::chrono::nanoseconds SnapshotManager::lastPause() const {
+    return lastPause_;
+}
+
+std::chrono::nanoseconds SnapshotManager::maxPause() const {
+    return maxPause_;
+}
+
+size_t SnapshotManager::completedCount() const {
+    return completed_;
+}
+
+/**
+ * @brief Writes all order books of an engine to a file in input CSV format.
+ *
+ * @param engine The engine to capture.
+ * @param path The file the snapshot is written to.
+ * @return true if the file was written successfully.
+ */
+bool SnapshotManager::writeSnapshot(const MatchingEngine& engine, const std::string& path) {
+    std::vector<char> buffer(BUFFER_SIZE);
+    return writeBooks(engine, path.c_str(), buffer.data(), buffer.size());
+}
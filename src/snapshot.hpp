@@ -0,0 +1,106 @@
+/**
+ * @file snapshot.hpp
+ * @brief Defines the SnapshotManager class that captures point-in-time views of all order books.
+ *
+ * Snapshots are taken with fork(): the child process inherits a copy-on-write image of the
+ * engine's memory and serializes it to disk while the parent keeps matching. The only pause
+ * incurred by the matching thread is the fork() call plus the start of a background thread
+ * that reaps the child and records the outcome.
+ *
+ * fork() only copies the calling thread, so the child must not touch a lock that another
+ * thread of the engine (result writer, logger) might have held at that moment. The child
+ * never allocates: it formats into a buffer allocated before the fork and writes it with
+ * write(2).
+ */
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+#include "matching_engine.hpp"
+
+/**
+ * @class SnapshotManager
+ * @brief Takes non-blocking copy-on-write snapshots of a MatchingEngine.
+ *
+ * A snapshot file uses the input CSV format (every resting order is written as a NEW order),
+ * so it can be reloaded with CSVParser to rebuild the books. Buy levels are written best
+ * price first, then sell levels, each level in time priority. Only one snapshot can be in
+ * flight at a time.
+ */
+class SnapshotManager {
+public:
+    /**
+     * @brief Default constructor
+     */
+    SnapshotManager();
+
+    /**
+     * @brief Destructor that waits for any in-flight snapshot
+     */
+    ~SnapshotManager();
+
+    SnapshotManager(const SnapshotManager&) = delete;
+    SnapshotManager& operator=(const SnapshotManager&) = delete;
+
+    /**
+     * @brief Start a snapshot of all order books without blocking matching
+     *
+     * @param engine The engine to capture
+     * @param path The file the snapshot is written to
+     * @return bool True if the snapshot was started, false if one is already in flight
+     *         or the process could not be forked
+     */
+    bool begin(const MatchingEngine& engine, const std::string& path);
+
+    /**
+     * @brief Wait for the in-flight snapshot, if any, to be written
+     *
+     * @return bool True if the last snapshot was written successfully
+     */
+    bool wait();
+
+    /**
+     * @brief Check whether a snapshot is still being written
+     */
+    bool inProgress() const;
+
+    /**
+     * @brief Pause incurred by the caller of the last begin()
+     */
+    std::chrono::nanoseconds lastPause() const;
+
+    /**
+     * @brief Longest pause incurred by begin() so far
+     */
+    std::chrono::nanoseconds maxPause() const;
+
+    /**
+     * @brief Number of snapshots written successfully
+     */
+    size_t completedCount() const;
+
+    /**
+     * @brief Synchronously write all order books of an engine to a file
+     *
+     * This is what the forked child runs; it can also be used directly when pausing is acceptable.
+     *
+     * @param engine The engine to capture
+     * @param path The file the snapshot is written to
+     * @return bool True if the file was written successfully
+     */
+    static bool writeSnapshot(const MatchingEngine& engine, const std::string& path);
+
+private:
+    static constexpr size_t BUFFER_SIZE = 64 * 1024;  ///< Formatting buffer of a snapshot
+
+    std::thread waiter_;                          ///< Reaps the child and records its outcome
+    std::atomic<bool> inProgress_;                ///< True while a child is writing
+    std::atomic<bool> lastSucceeded_;             ///< Outcome of the last snapshot
+    std::atomic<size_t> completed_;               ///< Number of successful snapshots
+    std::chrono::nanoseconds lastPause_;          ///< Pause of the last begin()
+    std::chrono::nanoseconds maxPause_;           ///< Longest pause of begin()
+    std::vector<char> buffer_;                    ///< Formatting buffer handed to the child
+};
@@ -0,0 +1,93 @@
+/**
+ * @file spsc_queue.hpp
+ * @brief Defines SPSCQueue, a bounded lock-free single-producer single-consumer queue.
+ *
+ * The producer only writes the tail index and the consumer only writes the head index,
+ * so neither side ever takes a lock. Each side keeps a cached copy of the other side's
+ * index and only reloads it when the queue looks full (or empty), which keeps the two
+ * cache lines from bouncing between cores on every operation.
+ */
+#pragma once
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <new>
+#include <vector>
+
+/**
+ * @class SPSCQueue
+ * @brief Bounded lock-free queue between exactly one producer and one consumer thread
+ *
+ * @tparam T Element type, typically a pointer or a small value
+ */
+template <typename T>
+class SPSCQueue {
+public:
+    /**
+     * @brief Creates a queue holding at least the specified number of elements
+     * @param capacity Requested capacity, rounded up to a power of two
+     */
+    explicit SPSCQueue(size_t capacity)
+        : slots_(std::bit_ceil(capacity < 2 ? size_t{2} : capacity)), mask_(slots_.size() - 1) {}
+
+    SPSCQueue(const SPSCQueue&) = delete;
+    SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+    /**
+     * @brief Appends an element; producer thread only
+     * @return False if the queue is full
+     */
+    bool tryPush(const T& value) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - cachedHead_ > mask_) {
+            cachedHead_ = head_.load(std::memory_order_acquire);
+            if (tail - cachedHead_ > mask_) {
+                return false;
+            }
+        }
+        slots_[tail & mask_] = value;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Removes the oldest element; consumer thread only
+     * @return False if the queue is empty
+     */
+    bool tryPop(T& value) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head == cachedTail_) {
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+            if (head == cachedTail_) {
+                return false;
+            }
+        }
+        value = slots_[head & mask_];
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Approximate number of elements, from any thread
+     */
+    size_t size() const {
+        size_t tail = tail_.load(std::memory_order_acquire);
+        size_t head = head_.load(std::memory_order_acquire);
+        return tail - head;
+    }
+
+    /**
+     * @brief Maximum number of elements
+     */
+    size_t capacity() const { return slots_.size(); }
+
+private:
+    static constexpr size_t CACHE_LINE = 64;
+
+    std::vector<T> slots_;                              ///< Ring storage
+    size_t mask_;                                       ///< Capacity - 1
+    alignas(CACHE_LINE) std::atomic<size_t> head_{0};   ///< Next slot to pop, written by the consumer
+    size_t cachedTail_ = 0;                             ///< Consumer's copy of tail_
+    alignas(CACHE_LINE) std::atomic<size_t> tail_{0};   ///< Next slot to push, written by the producer
+    size_t cachedHead_ = 0;                             ///< Producer's copy of head_
+};
@@ -0,0 +1,279 @@
+/**
+ * @file workload_generator.cpp
+ * @brief Implementation of the workload generator and of scenario files.
+ */
+
+#include "workload_generator.hpp"
+#include "binary_order_file.hpp"
+#include <charconv>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+/**
+ * @brief Loads a scenario file over the given options.
+ *
+ * Skips the header row and assigns the value of each parameter,value row to the field
+ * of the same name. Unknown parameters and values that cannot be converted are reported
+ * on standard error and skipped.
+ */
+bool WorkloadOptions::load(const std::string& filename, WorkloadOptions& options) {
+    std::ifstream file(filename);
+    std::string line;
+
+    if (!file.is_open()) {
+        std::cerr << "Erreur : impossible d'ouvrir le fichier de scénario " << filename << std::endl;
+        return false;
+    }
+
+    // Skip the header line
+    std::getline(file, line);
+    size_t lineNumber = 1;
+
+    while (std::getline(file, line)) {
+        ++lineNumber;
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::stringstream ss(line);
+        std::string name;
+        std::string value;
+        std::getline(ss, name, ',');
+        std::getline(ss, value, ',');
+
+        try {
+            if (name == "seed") options.seed = static_cast<uint32_t>(std::stoul(value));
+            else if (name == "orders") options.orders = std::stoull(value);
+            else if (name == "instruments") options.instruments = std::stoull(value);
+            else if (name == "zipf_exponent") options.zipf_exponent = std::stod(value);
+            else if (name == "new_weight") options.new_weight = std::stod(value);
+            else if (name == "market_weight") options.market_weight = std::stod(value);
+            else if (name == "cancel_weight") options.cancel_weight = std::stod(value);
+            else if (name == "modify_weight") options.modify_weight = std::stod(value);
+            else if (name == "start_price") options.start_price = std::stod(value);
+            else if (name == "tick_size") options.tick_size = std::stod(value);
+            else if (name == "mid_drift") options.mid_drift = std::stod(value);
+            else if (name == "depth_ticks") options.depth_ticks = std::stod(value);
+            else if (name == "aggressive_fraction") options.aggressive_fraction = std::stod(value);
+            else if (name == "lot_size") options.lot_size = std::stoi(value);
+            else if (name == "mean_lots") options.mean_lots = std::stod(value);
+            else if (name == "start_timestamp") options.start_timestamp = std::stoull(value);
+            else if (name == "mean_gap_ns") options.mean_gap_ns = std::stod(value);
+            else if (name == "burst_probability") options.burst_probability = std::stod(value);
+            else if (name == "burst_length") options.burst_length = std::stod(value);
+            else if (name == "burst_gap_ns") options.burst_gap_ns = std::stod(value);
+            else {
+                std::cerr << "Erreur : paramètre inconnu " << name << " à la ligne " << lineNumber
+                          << " de " << filename << std::endl;
+            }
+        } catch (const std::exception&) {
+            std::cerr << "Erreur : ligne " << lineNumber << " invalide dans " << filename << std::endl;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Weight of each instrument rank under Zipf's law: 1 / rank^exponent.
+ */
+static std::vector<double> zipfWeights(size_t count, double exponent) {
+    std::vector<double> weights(count);
+    for (size_t i = 0; i < count; ++i) {
+        weights[i] = 1.0 / std::pow(static_cast<double>(i + 1), exponent);
+    }
+    return weights;
+}
+
+/**
+ * @brief Draws from a geometric distribution on {0, 1, ...} with the given mean.
+ */
+template <typename Random>
+static int64_t geometric(Random& random, double mean) {
+    if (mean <= 0.0) {
+        return 0;
+    }
+    return std::geometric_distribution<int64_t>(1.0 / (mean + 1.0))(random);
+}
+
+WorkloadGenerator::WorkloadGenerator(const WorkloadOptions& options)
+    : options_(options), random_(options.seed), timestamp_(options.start_timestamp) {
+    if (options_.instruments < 1) {
+        options_.instruments = 1;
+    }
+    if (options_.tick_size <= 0.0) {
+        options_.tick_size = 0.01;
+    }
+    if (options_.lot_size < 1) {
+        options_.lot_size = 1;
+    }
+    std::vector<double> weights = zipfWeights(options_.instruments, options_.zipf_exponent);
+    instrument_ = std::discrete_distribution<size_t>(weights.begin(), weights.end());
+    kind_ = std::discrete_distribution<int>({options_.new_weight, options_.market_weight,
+                                             options_.cancel_weight, options_.modify_weight});
+
+    int64_t mid = std::llround(options_.start_price / options_.tick_size);
+    states_.resize(options_.instruments);
+    for (size_t i = 0; i < states_.size(); ++i) {
+        states_[i].name = "INSTR" + std::to_string(i);
+        states_[i].mid = mid;
+    }
+}
+
+/**
+ * @brief Draws the gap to the next order from the calm or the burst rate.
+ *
+ * Outside a burst, each order starts one with probability burst_probability; its length
+ * is drawn from a geometric distribution with mean burst_length.
+ */
+void WorkloadGenerator::advanceClock() {
+    double mean = options_.mean_gap_ns;
+    if (burstRemaining_ > 0) {
+        --burstRemaining_;
+        mean = options_.burst_gap_ns;
+    } else if (std::bernoulli_distribution(options_.burst_probability)(random_)) {
+        burstRemaining_ = static_cast<uint64_t>(geometric(random_, options_.burst_length - 1.0));
+        ++stats_.bursts;
+        mean = options_.burst_gap_ns;
+    }
+    if (mean > 0.0) {
+        timestamp_ += static_cast<uint64_t>(std::exponential_distribution<double>(1.0 / mean)(random_));
+    }
+}
+
+/**
+ * @brief Prices a passive order behind the best price of its side, or an aggressive
+ * order a tick or two through the mid.
+ */
+int64_t WorkloadGenerator::limitPrice(const InstrumentState& state, Side side, bool aggressive) {
+    int64_t offset = aggressive ? -1 - geometric(random_, 0.5) : 1 + geometric(random_, options_.depth_ticks);
+    int64_t price = side == Side::BUY ? state.mid - offset : state.mid + offset;
+    return std::max<int64_t>(price, 1);
+}
+
+int WorkloadGenerator::drawQuantity() {
+    return static_cast<int>(1 + geometric(random_, options_.mean_lots - 1.0)) * options_.lot_size;
+}
+
+/**
+ * @brief Picks the instrument, moves its mid, then draws the kind of order.
+ *
+ * A CANCEL or MODIFY drawn for an instrument with no live order becomes a NEW limit
+ * order. Cancels remove the order from the live set with a swap; modifies re-price it
+ * around the current mid on the same side.
+ */
+Order WorkloadGenerator::next() {
+    advanceClock();
+    InstrumentState& state = states_[instrument_(random_)];
+    if (std::bernoulli_distribution(options_.mid_drift)(random_)) {
+        state.mid = std::max<int64_t>(state.mid + (std::bernoulli_distribution(0.5)(random_) ? 1 : -1), 2);
+    }
+
+    Order order;
+    order.timestamp = timestamp_;
+    order.instrument = state.name;
+    order.type = Type::LIMIT;
+    order.action = Action::NEW;
+
+    int kind = kind_(random_);
+    if ((kind == 2 || kind == 3) && state.live.empty()) {
+        kind = 0;
+    }
+    switch (kind) {
+        case 1: {
+            order.order_id = nextId_++;
+            order.side = std::bernoulli_distribution(0.5)(random_) ? Side::BUY : Side::SELL;
+            order.type = Type::MARKET;
+            order.quantity = drawQuantity();
+            order.price = 0.0f;
+            ++stats_.markets;
+            break;
+        }
+        case 2: {
+            size_t index = std::uniform_int_distribution<size_t>(0, state.live.size() - 1)(random_);
+            LiveOrder live = state.live[index];
+            state.live[index] = state.live.back();
+            state.live.pop_back();
+            order.order_id = live.order_id;
+            order.side = live.side;
+            order.quantity = 0;
+            order.price = 0.0f;
+            order.action = Action::CANCEL;
+            ++stats_.cancels;
+            break;
+        }
+        case 3: {
+            size_t index = std::uniform_int_distribution<size_t>(0, state.live.size() - 1)(random_);
+            LiveOrder& live = state.live[index];
+            live.quantity = drawQuantity();
+            order.order_id = live.order_id;
+            order.side = live.side;
+            order.quantity = live.quantity;
+            order.price = static_cast<float>(static_cast<double>(limitPrice(state, live.side, false)) * options_.tick_size);
+            order.action = Action::MODIFY;
+            ++stats_.modifies;
+            break;
+        }
+        default: {
+            bool aggressive = std::bernoulli_distribution(options_.aggressive_fraction)(random_);
+            order.order_id = nextId_++;
+            order.side = std::bernoulli_distribution(0.5)(random_) ? Side::BUY : Side::SELL;
+            order.quantity = drawQuantity();
+            order.price = static_cast<float>(static_cast<double>(limitPrice(state, order.side, aggressive)) * options_.tick_size);
+            if (aggressive) {
+                ++stats_.aggressive;
+            } else {
+                state.live.push_back({order.order_id, order.side, order.quantity});
+            }
+            ++stats_.limits;
+            break;
+        }
+    }
+    return order;
+}
+
+void WorkloadGenerator::generate(size_t count, std::vector<Order>& orders) {
+    orders.reserve(orders.size() + count);
+    for (size_t i = 0; i < count; ++i) {
+        orders.push_back(next());
+    }
+}
+
+/**
+ * @brief Writes the orders in the binary format or in the input CSV layout.
+ *
+ * Prices are written in the shortest form that reads back to the same float.
+ */
+bool writeOrderFile(const std::string& filename, const std::vector<Order>& orders) {
+    if (filename.size() >= 4 && filename.compare(filename.size() - 4, 4, ".bin") == 0) {
+        BinaryOrderWriter writer(filename);
+        if (!writer.isOpen()) {
+            return false;
+        }
+        for (const auto& order : orders) {
+            if (!writer.writeOrder(order)) {
+                return false;
+            }
+        }
+        return writer.close();
+    }
+
+    std::ofstream file(filename);
+    if (!file) {
+        std::cerr << "Erreur : impossible de créer le fichier " << filename << std::endl;
+        return false;
+    }
+    file << "timestamp,order_id,instrument,side,type,quantity,price,action\n";
+    char price[32];
+    for (const auto& order : orders) {
+        auto [end, error] = std::to_chars(price, price + sizeof(price), order.price);
+        file << order.timestamp << ',' << order.order_id << ',' << order.instrument << ','
+             << sideName(order.side) << ',' << typeName(order.type) << ',' << order.quantity << ','
+             << std::string_view(price, static_cast<size_t>(end - price)) << ','
+             << actionName(order.action) << '\n';
+    }
+    return static_cast<bool>(file);
+}
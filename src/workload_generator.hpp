@@ -0,0 +1,174 @@
+/**
+ * @file workload_generator.hpp
+ * @brief Defines WorkloadGenerator, a seeded generator of realistic order flow.
+ *
+ * Uniformly random orders rarely cross and cancel ids that do not exist, so they mostly
+ * measure the insertion path. The generator models the features of real flow that decide
+ * which engine paths run:
+ * - prices in ticks around a mid that drifts as a random walk, most of them a few ticks
+ *   from the mid, with a configurable fraction of marketable limit orders;
+ * - cancels and modifies of live orders, picked among the resting orders the generator
+ *   entered and has not canceled yet;
+ * - a configurable mix of NEW limit, MARKET, CANCEL and MODIFY orders;
+ * - Zipfian instrument popularity, so that a few books take most of the flow;
+ * - bursts: runs of orders with much shorter gaps than the calm flow.
+ *
+ * The generator does not run a matching engine, so it does not know which resting orders
+ * were executed; some cancels and modifies therefore target filled orders, as late
+ * cancels do in real markets. The same options and seed always give the same orders.
+ *
+ * The options are read from scenario files, CSV files of parameter,value rows named after
+ * the fields of WorkloadOptions, e.g.:
+ *
+ *     parameter,value
+ *     orders,1000000
+ *     cancel_weight,0.6
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include "order.hpp"
+
+/**
+ * @struct WorkloadOptions
+ * @brief Parameters of a generated workload
+ */
+struct WorkloadOptions {
+    uint32_t seed = 42;                 // Seed of the random generator
+    size_t orders = 100000;             // Number of orders to generate
+    size_t instruments = 10;            // Instruments, named INSTR0, INSTR1, ...
+    double zipf_exponent = 1.0;         // Skew of instrument popularity, 0 for uniform
+
+    // Mix of order kinds, as relative weights
+    double new_weight = 0.50;           // NEW limit orders
+    double market_weight = 0.05;        // NEW market orders
+    double cancel_weight = 0.35;        // CANCEL of a live order
+    double modify_weight = 0.10;        // MODIFY of a live order
+
+    // Prices
+    double start_price = 100.0;         // Initial mid of every instrument
+    double tick_size = 0.01;            // Price increment
+    double mid_drift = 0.05;            // Probability that an order moves its instrument's mid by one tick
+    double depth_ticks = 4.0;           // Mean distance of passive orders behind the best price, in ticks
+    double aggressive_fraction = 0.10;  // Fraction of NEW limit orders priced through the mid
+
+    // Quantities
+    int lot_size = 100;                 // Quantities are whole lots
+    double mean_lots = 3.0;             // Mean number of lots per order
+
+    // Arrival times
+    uint64_t start_timestamp = 1617278400000000000ULL;  // Timestamp of the first order, in nanoseconds
+    double mean_gap_ns = 100000.0;      // Mean gap between orders outside bursts
+    double burst_probability = 0.001;   // Probability that an order starts a burst
+    double burst_length = 500.0;        // Mean number of orders in a burst
+    double burst_gap_ns = 500.0;        // Mean gap between orders inside a burst
+
+    /**
+     * @brief Load a scenario file over the default options
+     *
+     * Unknown parameters and malformed rows are reported on standard error and skipped.
+     *
+     * @param filename The path to the scenario file
+     * @param options Receives the loaded options; parameters not in the file keep their value
+     * @return bool False if the file cannot be opened
+     */
+    static bool load(const std::string& filename, WorkloadOptions& options);
+};
+
+/**
+ * @struct WorkloadStats
+ * @brief Number of orders of each kind generated so far
+ */
+struct WorkloadStats {
+    uint64_t limits = 0;      // NEW limit orders
+    uint64_t aggressive = 0;  // NEW limit orders priced through the mid
+    uint64_t markets = 0;     // NEW market orders
+    uint64_t cancels = 0;     // CANCEL orders
+    uint64_t modifies = 0;    // MODIFY orders
+    uint64_t bursts = 0;      // Bursts started
+};
+
+/**
+ * @class WorkloadGenerator
+ * @brief Generates a reproducible stream of orders from WorkloadOptions
+ */
+class WorkloadGenerator {
+public:
+    /**
+     * @brief Creates a generator
+     * @param options Parameters of the workload
+     */
+    explicit WorkloadGenerator(const WorkloadOptions& options);
+
+    /**
+     * @brief Generates the next order
+     */
+    Order next();
+
+    /**
+     * @brief Appends orders to a vector
+     * @param count Number of orders to generate
+     * @param orders Vector the orders are appended to
+     */
+    void generate(size_t count, std::vector<Order>& orders);
+
+    /**
+     * @brief Orders of each kind generated so far
+     */
+    const WorkloadStats& stats() const { return stats_; }
+
+private:
+    /**
+     * @brief A resting order the generator may cancel or modify
+     */
+    struct LiveOrder {
+        int order_id;
+        Side side;
+        int quantity;
+    };
+
+    /**
+     * @brief Simulated state of one instrument
+     */
+    struct InstrumentState {
+        std::string name;
+        int64_t mid;                    // Mid price, in ticks
+        std::vector<LiveOrder> live;    // Resting orders not canceled yet
+    };
+
+    /**
+     * @brief Advances the clock by the gap to the next order
+     */
+    void advanceClock();
+
+    /**
+     * @brief Price of a passive or aggressive order of a side, in ticks
+     */
+    int64_t limitPrice(const InstrumentState& state, Side side, bool aggressive);
+
+    int drawQuantity();
+
+    WorkloadOptions options_;
+    std::mt19937_64 random_;
+    std::discrete_distribution<size_t> instrument_;  ///< Zipfian instrument popularity
+    std::discrete_distribution<int> kind_;           ///< NEW limit, MARKET, CANCEL, MODIFY
+    std::vector<InstrumentState> states_;
+    uint64_t timestamp_;
+    int nextId_ = 1;
+    uint64_t burstRemaining_ = 0;    ///< Orders left in the current burst
+    WorkloadStats stats_;
+};
+
+/**
+ * @brief Writes orders to a file that the engine and the benchmarks can replay
+ *
+ * Files ending in ".bin" use the binary order format; other files use the input CSV layout.
+ *
+ * @param filename The path to the output file
+ * @param orders The orders to write
+ * @return bool False if the file cannot be written
+ */
+bool writeOrderFile(const std::string& filename, const std::vector<Order>& orders);
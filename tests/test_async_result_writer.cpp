@@ -0,0 +1,127 @@
+#include "../src/async_result_writer.hpp"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Simple test harness function
+#define TEST(name) void test_##name()
+
+// Assertion with message
+#define ASSERT_TRUE(condition, message) \
+    if (!(condition)) { \
+        std::cerr << "Assertion failed: " << message << std::endl; \
+        exit(1); \
+    }
+
+// Sink recording the results it receives, optionally slowly
+class RecordingWriter : public ResultWriter {
+public:
+    explicit RecordingWriter(std::chrono::microseconds delay = std::chrono::microseconds(0)) : delay_(delay) {}
+
+    void writeOrderResult(const OrderResult& result) override {
+        if (delay_.count() > 0) {
+            std::this_thread::sleep_for(delay_);
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        ids.push_back(result.order_id);
+        writerThread = std::this_thread::get_id();
+    }
+
+    void flush() override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++flushes;
+        flushThread = std::this_thread::get_id();
+    }
+
+    std::vector<int> ids;
+    std::thread::id writerThread;
+    std::thread::id flushThread;
+    int flushes = 0;
+
+private:
+    std::chrono::microseconds delay_;
+    std::mutex mutex_;
+};
+
+OrderResult makeResult(int id) {
+    OrderResult result{};
+    result.timestamp = 1000 + id;
+    result.order_id = id;
+    result.instrument = "AAPL";
+    result.status = OrderStatus::PENDING;
+    return result;
+}
+
+// Test that every result reaches the sink in order, on the writer thread
+TEST(async_writer_order) {
+    RecordingWriter sink;
+    {
+        AsyncResultWriter writer(sink, 16);
+        for (int i = 0; i < 1000; ++i) {
+            writer.writeOrderResult(makeResult(i));
+        }
+        writer.flush();
+        ASSERT_TRUE(sink.ids.size() == 1000, "flush() should write every queued result");
+        ASSERT_TRUE(sink.flushes == 1, "flush() should flush the sink");
+        ASSERT_TRUE(writer.writtenCount() == 1000, "Written count should be 1000");
+
+        writer.writeOrderResult(makeResult(1000));
+    } // The destructor drains the last result
+
+    ASSERT_TRUE(sink.ids.size() == 1001, "Shutdown should drain the buffers");
+    for (int i = 0; i < 1001; ++i) {
+        ASSERT_TRUE(sink.ids[i] == i, "Results should keep their order");
+    }
+    ASSERT_TRUE(sink.writerThread != std::this_thread::get_id(), "Results should be written on the writer thread");
+    ASSERT_TRUE(sink.flushThread == sink.writerThread, "The sink should be flushed on the writer thread");
+
+    std::cout << "All async_writer_order tests passed!" << std::endl;
+}
+
+// Test that the block policy never loses results behind a slow sink
+TEST(async_writer_block) {
+    RecordingWriter sink(std::chrono::microseconds(50));
+    AsyncResultWriter writer(sink, 4, Backpressure::BLOCK);
+    for (int i = 0; i < 100; ++i) {
+        writer.writeOrderResult(makeResult(i));
+    }
+    writer.close();
+
+    ASSERT_TRUE(sink.ids.size() == 100, "No result should be lost with the block policy");
+    ASSERT_TRUE(writer.droppedCount() == 0, "Nothing should be dropped with the block policy");
+
+    std::cout << "All async_writer_block tests passed!" << std::endl;
+}
+
+// Test that the drop policy discards and counts results behind a slow sink
+TEST(async_writer_drop) {
+    RecordingWriter sink(std::chrono::milliseconds(2));
+    AsyncResultWriter writer(sink, 4, Backpressure::DROP);
+    for (int i = 0; i < 100; ++i) {
+        writer.writeOrderResult(makeResult(i));
+    }
+    writer.close();
+
+    ASSERT_TRUE(writer.droppedCount() > 0, "Results should be dropped behind a slow sink");
+    ASSERT_TRUE(sink.ids.size() + writer.droppedCount() == 100, "Every result should be written or dropped");
+    ASSERT_TRUE(writer.writtenCount() == sink.ids.size(), "Written count should match the sink");
+    for (size_t i = 1; i < sink.ids.size(); ++i) {
+        ASSERT_TRUE(sink.ids[i - 1] < sink.ids[i], "Written results should keep their order");
+    }
+
+    std::cout << "All async_writer_drop tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running AsyncResultWriter tests..." << std::endl;
+
+    test_async_writer_order();
+    test_async_writer_block();
+    test_async_writer_drop();
+
+    std::cout << "All AsyncResultWriter tests passed successfully!" << std::endl;
+    return 0;
+}
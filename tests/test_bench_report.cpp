@@ -0,0 +1,147 @@
+#include "../src/bench_report.hpp"
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+// Simple test harness function
+#define TEST(name) void test_##name()
+
+// Assertion with message
+#define ASSERT_TRUE(condition, message) \
+    if (!(condition)) { \
+        std::cerr << "Assertion failed: " << message << std::endl; \
+        exit(1); \
+    }
+
+// Builds a report with metadata that needs escaping and a few metrics
+static BenchReport sampleReport() {
+    BenchReport report;
+    report.setMetadata("git_revision", "abc123-dirty");
+    report.setMetadata("flags", "-O2 -DNAME=\"x\"");
+    report.setMetadata("seed", "42");
+    report.setMetadata("seed", "7");
+    report.add("engine/1000", "throughput", "orders/s", true, 2500000.5);
+    report.add("engine/1000", "throughput", "orders/s", true, 2400000.25);
+    report.add("engine/1000", "p99", "ns", false, 812.0);
+    report.add("engine/1000", "p99", "ns", false, 790.0);
+    report.add("process", "peak_rss", "KiB", false, 10240.0);
+    return report;
+}
+
+// Checks that a report read back matches sampleReport()
+static bool matchesSample(const BenchReport& report) {
+    const BenchMetric* throughput = report.find("engine/1000", "throughput");
+    const BenchMetric* p99 = report.find("engine/1000", "p99");
+    const BenchMetric* rss = report.find("process", "peak_rss");
+    return report.metadata("git_revision") == "abc123-dirty" && report.metadata("flags") == "-O2 -DNAME=\"x\""
+           && report.metadata("seed") == "7" && report.metadataEntries().size() == 3
+           && report.metrics().size() == 3 && throughput != nullptr && throughput->higherIsBetter
+           && throughput->unit == "orders/s" && throughput->samples.size() == 2
+           && throughput->samples[0] == 2500000.5 && throughput->samples[1] == 2400000.25
+           && p99 != nullptr && !p99->higherIsBetter && p99->samples.size() == 2 && p99->samples[1] == 790.0
+           && rss != nullptr && rss->samples.size() == 1 && rss->samples[0] == 10240.0;
+}
+
+// Test that reports round-trip through both formats
+TEST(round_trip) {
+    BenchReport report = sampleReport();
+    ASSERT_TRUE(matchesSample(report), "Report should hold what was added");
+    ASSERT_TRUE(report.find("engine/1000", "p50") == nullptr, "Unknown metric should not be found");
+
+    for (const char* filename : {"test_report.json", "test_report.csv"}) {
+        ASSERT_TRUE(report.write(filename), "Report should be written");
+        BenchReport parsed;
+        ASSERT_TRUE(BenchReport::read(filename, parsed), "Report should be read back");
+        ASSERT_TRUE(matchesSample(parsed), "Report read back should match the written one");
+        std::remove(filename);
+    }
+
+    BenchReport missing;
+    ASSERT_TRUE(!BenchReport::read("missing_report.json", missing), "Missing report should fail");
+    {
+        std::ofstream file("test_report_bad.json");
+        file << "{\"metadata\": {\"seed\": 1}, \"results\": [";
+    }
+    ASSERT_TRUE(!BenchReport::read("test_report_bad.json", missing), "Malformed report should fail");
+    std::remove("test_report_bad.json");
+
+    std::cout << "Round trip tests passed!" << std::endl;
+}
+
+// Test the p-values of Welch's t-test
+TEST(welch_t_test) {
+    std::vector<double> a = {10.0, 10.2, 9.9, 10.1, 9.8};
+    WelchTest same = welchTTest(a, a);
+    ASSERT_TRUE(std::fabs(same.pValue - 1.0) < 1e-9, "Identical samples should give p = 1");
+
+    std::vector<double> b = {12.0, 12.1, 11.9, 12.2, 11.8};
+    WelchTest different = welchTTest(a, b);
+    ASSERT_TRUE(different.pValue < 1e-6, "Clearly different samples should give a small p-value");
+    ASSERT_TRUE(different.t < 0.0, "t should be negative when the first mean is lower");
+
+    // Reference values: t = -1.5, df = 8 gives a two-sided p of about 0.172
+    std::vector<double> c = {1.0, 2.0, 3.0, 4.0, 5.0};
+    std::vector<double> d = {2.5, 3.5, 4.5, 5.5, 6.5};
+    WelchTest reference = welchTTest(c, d);
+    ASSERT_TRUE(std::fabs(reference.t + 1.5) < 1e-9 && std::fabs(reference.df - 8.0) < 1e-9,
+                "t and degrees of freedom should match the reference");
+    ASSERT_TRUE(std::fabs(reference.pValue - 0.1720) < 1e-3, "p-value should match the reference");
+
+    ASSERT_TRUE(welchTTest({1.0}, b).pValue == 1.0, "A single sample should give p = 1");
+    ASSERT_TRUE(welchTTest({5.0, 5.0}, {6.0, 6.0}).pValue == 0.0, "Different constants should give p = 0");
+
+    std::cout << "Welch t-test tests passed!" << std::endl;
+}
+
+// Test the verdicts of a comparison
+TEST(compare_reports) {
+    BenchReport base;
+    BenchReport current;
+    for (double noise : {-1.0, 0.0, 1.0, 0.5, -0.5}) {
+        base.add("engine/1000", "throughput", "orders/s", true, 1000.0 + noise);
+        current.add("engine/1000", "throughput", "orders/s", true, 900.0 + noise);
+        base.add("engine/1000", "p99", "ns", false, 500.0 + noise);
+        current.add("engine/1000", "p99", "ns", false, 400.0 + noise);
+        base.add("engine/1000", "p50", "ns", false, 100.0 + noise);
+        current.add("engine/1000", "p50", "ns", false, 100.5 + noise);
+        base.add("engine/1000", "allocations", "allocs/order", false, 2.0 + noise * 0.001);
+        current.add("engine/1000", "allocations", "allocs/order", false, 2.01 + noise * 0.001);
+    }
+    base.add("process", "peak_rss", "KiB", false, 1000.0);
+    current.add("process", "peak_rss", "KiB", false, 2000.0);
+    current.add("books/1000", "throughput", "orders/s", true, 5000.0);
+
+    std::vector<BenchComparison> comparisons = compareReports(base, current);
+    ASSERT_TRUE(comparisons.size() == 5, "Only metrics present in both reports should be compared");
+    ASSERT_TRUE(comparisons[0].metric == "throughput" && comparisons[0].verdict == BenchVerdict::REGRESSED,
+                "Lower throughput should be a regression");
+    ASSERT_TRUE(std::fabs(comparisons[0].change + 0.1) < 1e-9, "Change should be relative to the base");
+    ASSERT_TRUE(comparisons[1].metric == "p99" && comparisons[1].verdict == BenchVerdict::IMPROVED,
+                "Lower latency should be an improvement");
+    ASSERT_TRUE(comparisons[2].metric == "p50" && comparisons[2].verdict == BenchVerdict::UNCHANGED,
+                "Noise should not be flagged");
+    ASSERT_TRUE(comparisons[3].metric == "allocations" && comparisons[3].verdict == BenchVerdict::UNCHANGED,
+                "A significant change below the minimum should not be flagged");
+    ASSERT_TRUE(comparisons[3].pValue < 0.05, "The small allocation change should still be significant");
+    ASSERT_TRUE(comparisons[4].metric == "peak_rss" && comparisons[4].verdict == BenchVerdict::UNTESTED,
+                "Single samples should not be tested");
+    ASSERT_TRUE(std::string(verdictName(BenchVerdict::REGRESSED)) == "REGRESSED", "Verdict names should match");
+
+    std::vector<BenchComparison> strict = compareReports(base, current, 0.05, 0.0);
+    ASSERT_TRUE(strict[3].verdict == BenchVerdict::REGRESSED, "Without a minimum change any significant change counts");
+
+    std::cout << "Comparison tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running BenchReport tests..." << std::endl;
+
+    test_round_trip();
+    test_welch_t_test();
+    test_compare_reports();
+
+    std::cout << "All BenchReport tests passed successfully!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,214 @@
+#include "../src/binary_order_file.hpp"
+#include "../src/csv_parser.hpp"
+#include <iostream>
+#include <cassert>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+// Simple test harness function
+#define TEST(name) void test_##name()
+
+// Assertion with message
+#define ASSERT_TRUE(condition, message) \
+    if (!(condition)) { \
+        std::cerr << "Assertion failed: " << message << std::endl; \
+        exit(1); \
+    }
+
+// Test that orders written to a binary file are read back unchanged
+TEST(binary_roundtrip) {
+    std::vector<Order> orders = {
+        {1617278400000000000, 1, "AAPL", Side::BUY, Type::LIMIT, 100, 150.25f, Action::NEW},
+        {1617278400000000100, 2, "MSFT", Side::SELL, Type::MARKET, 50, 0.0f, Action::NEW},
+        {1617278400000000200, 1, "AAPL", Side::BUY, Type::LIMIT, 80, 150.5f, Action::MODIFY},
+        {1617278400000000300, 1, "AAPL", Side::BUY, Type::LIMIT, 0, 0.0f, Action::CANCEL}
+    };
+
+    std::string filename = "test_orders.bin";
+    {
+        BinaryOrderWriter writer(filename);
+        ASSERT_TRUE(writer.isOpen(), "Binary file should be created");
+        for (const auto& order : orders) {
+            ASSERT_TRUE(writer.writeOrder(order), "Order should be written");
+        }
+        ASSERT_TRUE(writer.close(), "Binary file should be finalized");
+        ASSERT_TRUE(writer.recordCount() == 4, "Writer should count 4 records");
+    }
+
+    BinaryOrderReader reader(filename);
+    ASSERT_TRUE(reader.isOpen(), "Binary file should be valid");
+    ASSERT_TRUE(reader.recordCount() == 4, "Reader should see 4 records");
+    ASSERT_TRUE(reader.symbols().size() == 2, "Dictionary should hold 2 symbols");
+    ASSERT_TRUE(reader.symbols()[0] == "AAPL" && reader.symbols()[1] == "MSFT", "Symbols should be in order of appearance");
+    ASSERT_TRUE(reader.records()[2].instrument_id == 0, "Record should refer to AAPL by id");
+
+    // Read in batches smaller than the file
+    std::vector<Order> read;
+    std::vector<Order> batch;
+    while (reader.next(batch, 3) > 0) {
+        read.insert(read.end(), batch.begin(), batch.end());
+    }
+    ASSERT_TRUE(read.size() == orders.size(), "All orders should be read back");
+    for (size_t i = 0; i < orders.size(); ++i) {
+        ASSERT_TRUE(read[i].timestamp == orders[i].timestamp, "Timestamp should match");
+        ASSERT_TRUE(read[i].order_id == orders[i].order_id, "Order ID should match");
+        ASSERT_TRUE(read[i].instrument == orders[i].instrument, "Instrument should match");
+        ASSERT_TRUE(read[i].side == orders[i].side, "Side should match");
+        ASSERT_TRUE(read[i].type == orders[i].type, "Type should match");
+        ASSERT_TRUE(read[i].quantity == orders[i].quantity, "Quantity should match");
+        ASSERT_TRUE(read[i].price == orders[i].price, "Price should match");
+        ASSERT_TRUE(read[i].action == orders[i].action, "Action should match");
+    }
+
+    std::remove(filename.c_str());
+
+    std::cout << "All binary_roundtrip tests passed!" << std::endl;
+}
+
+// Test that converting a CSV file yields the same orders as parsing it
+TEST(binary_from_csv) {
+    std::string csvFile = "test_binary_input.csv";
+    std::ofstream file(csvFile);
+    file << "timestamp,order_id,instrument,side,type,quantity,price,action\n";
+    file << "1617278400000000000,1,AAPL,BUY,LIMIT,100,150.25,NEW\n";
+    file << "1617278400000000001,2,GOOGL,SELL,LIMIT,20,2800.5,NEW\n";
+    file << "1617278400000000002,3,AAPL,SELL,MARKET,40,0,NEW\n";
+    file.close();
+
+    CSVParser parser(csvFile);
+    std::vector<Order> expected = parser.parse();
+
+    std::string binFile = "test_binary_input.bin";
+    BinaryOrderWriter writer(binFile);
+    for (const auto& order : expected) {
+        writer.writeOrder(order);
+    }
+    writer.close();
+
+    BinaryOrderReader reader(binFile);
+    std::vector<Order> batch;
+    ASSERT_TRUE(reader.next(batch, 100) == expected.size(), "All orders should be read in one batch");
+    ASSERT_TRUE(reader.next(batch, 100) == 0, "Reader should be exhausted");
+    ASSERT_TRUE(batch.empty(), "Exhausted reader should clear the batch");
+
+    reader = BinaryOrderReader(binFile);
+    reader.next(batch, 100);
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_TRUE(batch[i].order_id == expected[i].order_id, "Order ID should match the CSV");
+        ASSERT_TRUE(batch[i].instrument == expected[i].instrument, "Instrument should match the CSV");
+        ASSERT_TRUE(batch[i].price == expected[i].price, "Price should match the CSV");
+    }
+
+    std::remove(csvFile.c_str());
+    std::remove(binFile.c_str());
+
+    std::cout << "All binary_from_csv tests passed!" << std::endl;
+}
+
+// Test that invalid files are rejected
+TEST(binary_invalid) {
+    BinaryOrderReader missing("non_existent_file.bin");
+    ASSERT_TRUE(!missing.isOpen(), "Missing file should not be opened");
+
+    std::string filename = "test_invalid.bin";
+    std::ofstream file(filename, std::ios::binary);
+    file << "timestamp,order_id,instrument,side,type,quantity,price,action\n";
+    file.close();
+    BinaryOrderReader text(filename);
+    ASSERT_TRUE(!text.isOpen(), "CSV file should not be accepted as binary");
+
+    // Truncate a valid file in the middle of its records
+    {
+        BinaryOrderWriter writer(filename);
+        for (int i = 0; i < 10; ++i) {
+            writer.writeOrder({1000, i, "AAPL", Side::BUY, Type::LIMIT, 10, 100.0f, Action::NEW});
+        }
+    }
+    std::ifstream in(filename, std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+    out.write(content.data(), static_cast<std::streamsize>(content.size() / 2));
+    out.close();
+    BinaryOrderReader truncated(filename);
+    ASSERT_TRUE(!truncated.isOpen(), "Truncated file should be rejected");
+
+    std::vector<Order> batch;
+    ASSERT_TRUE(truncated.next(batch, 10) == 0, "Invalid reader should return no orders");
+
+    // A dictionary offset so large that its end wraps around to 0
+    {
+        BinaryOrderWriter writer(filename);
+        writer.writeOrder({1000, 1, "AAPL", Side::BUY, Type::LIMIT, 10, 100.0f, Action::NEW});
+    }
+    {
+        std::fstream corrupt(filename, std::ios::binary | std::ios::in | std::ios::out);
+        BinaryFileHeader header;
+        corrupt.read(reinterpret_cast<char*>(&header), sizeof(header));
+        header.symbol_count = 1;
+        header.symbols_offset = ~uint64_t{0} - sizeof(BinarySymbol) + 1;
+        corrupt.seekp(0);
+        corrupt.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    }
+    BinaryOrderReader wrapped(filename);
+    ASSERT_TRUE(!wrapped.isOpen(), "A dictionary offset past the end of the file should be rejected");
+
+    // Corrupt the side, type and action bytes of three records out of five
+    {
+        BinaryOrderWriter writer(filename);
+        for (int i = 0; i < 5; ++i) {
+            writer.writeOrder({1000, i, "AAPL", Side::BUY, Type::LIMIT, 10, 100.0f, Action::NEW});
+        }
+    }
+    {
+        std::fstream corrupt(filename, std::ios::binary | std::ios::in | std::ios::out);
+        const size_t fields[] = {offsetof(BinaryOrderRecord, side), offsetof(BinaryOrderRecord, type),
+                                 offsetof(BinaryOrderRecord, action)};
+        for (size_t i = 0; i < 3; ++i) {
+            corrupt.seekp(static_cast<std::streamoff>(sizeof(BinaryFileHeader) + (i + 1) * sizeof(BinaryOrderRecord) + fields[i]));
+            corrupt.put(static_cast<char>(7));
+        }
+    }
+    BinaryOrderReader corrupted(filename);
+    ASSERT_TRUE(corrupted.isOpen(), "Corrupt enum bytes should not invalidate the file");
+    std::vector<Order> valid;
+    while (corrupted.next(batch, 2) > 0) {
+        valid.insert(valid.end(), batch.begin(), batch.end());
+    }
+    ASSERT_TRUE(valid.size() == 2 && valid[0].order_id == 0 && valid[1].order_id == 4,
+                "Records with out-of-range enum bytes should be skipped");
+    ASSERT_TRUE(corrupted.rejectedCount() == 3, "Skipped records should be counted");
+
+    BinaryOrderReader columnar(filename);
+    OrderBatch orderBatch;
+    std::vector<int> ids;
+    while (columnar.next(orderBatch, 2) > 0) {
+        for (size_t i = 0; i < orderBatch.size(); ++i) {
+            ids.push_back(orderBatch.orderIds()[i]);
+        }
+    }
+    ASSERT_TRUE(ids == std::vector<int>({0, 4}), "Columnar batches should skip the same records");
+    ASSERT_TRUE(columnar.rejectedCount() == 3, "Records skipped from columnar batches should be counted");
+
+    BinaryOrderWriter writer(filename);
+    ASSERT_TRUE(!writer.writeOrder({1000, 1, "A_VERY_LONG_SYMBOL", Side::BUY, Type::LIMIT, 10, 1.0f, Action::NEW}),
+                "Symbols longer than the dictionary entry should be refused");
+    writer.close();
+
+    std::remove(filename.c_str());
+
+    std::cout << "All binary_invalid tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running Binary Order File tests..." << std::endl;
+
+    test_binary_roundtrip();
+    test_binary_from_csv();
+    test_binary_invalid();
+
+    std::cout << "All Binary Order File tests passed successfully!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,168 @@
+#include "../src/binary_result_file.hpp"
+#include "../src/binary_order_file.hpp"
+#include "../src/csv_writer.hpp"
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+// Simple test harness function
+#define TEST(name) void test_##name()
+
+// Assertion with message
+#define ASSERT_TRUE(condition, message) \
+    if (!(condition)) { \
+        std::cerr << "Assertion failed: " << message << std::endl; \
+        exit(1); \
+    }
+
+std::vector<OrderResult> sampleResults() {
+    std::vector<OrderResult> results(3);
+    results[0] = {1617278400000000000, 1, "AAPL", Side::BUY, Type::LIMIT, 100, 150.25f, Action::NEW,
+                  OrderStatus::PENDING, 0, 0.0f, 0};
+    results[1] = {1617278400000000100, 2, "MSFT", Side::SELL, Type::MARKET, 50, 0.0f, Action::NEW,
+                  OrderStatus::PARTIALLY_EXECUTED, 20, 261.125f, 7};
+    results[2] = {1617278400000000200, 1, "AAPL", Side::BUY, Type::LIMIT, 100, 150.25f, Action::CANCEL,
+                  OrderStatus::CANCELED, 0, 0.0f, 0};
+    return results;
+}
+
+std::string readFile(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+// Test that results written to a binary file are read back unchanged
+TEST(binary_result_roundtrip) {
+    std::vector<OrderResult> results = sampleResults();
+    std::string filename = "test_results.bin";
+    {
+        BinaryResultWriter writer(filename);
+        ASSERT_TRUE(writer.isOpen(), "Binary file should be created");
+        for (const auto& result : results) {
+            writer.writeOrderResult(result);
+        }
+        ASSERT_TRUE(writer.close(), "Binary file should be finalized");
+        ASSERT_TRUE(writer.recordCount() == 3, "Writer should count 3 records");
+    }
+
+    ASSERT_TRUE(BinaryResultReader::isBinaryFile(filename), "Result magic should be detected");
+    ASSERT_TRUE(!BinaryOrderReader::isBinaryFile(filename), "Result file should not look like an order file");
+
+    BinaryResultReader reader(filename);
+    ASSERT_TRUE(reader.isOpen(), "Binary file should be valid");
+    ASSERT_TRUE(reader.recordCount() == 3, "Reader should see 3 records");
+    ASSERT_TRUE(reader.symbols().size() == 2, "Dictionary should hold 2 symbols");
+
+    OrderResult read;
+    for (size_t i = 0; i < results.size(); ++i) {
+        reader.toResult(reader.records()[i], read);
+        ASSERT_TRUE(read.timestamp == results[i].timestamp, "Timestamp should match");
+        ASSERT_TRUE(read.order_id == results[i].order_id, "Order ID should match");
+        ASSERT_TRUE(read.instrument == results[i].instrument, "Instrument should match");
+        ASSERT_TRUE(read.side == results[i].side, "Side should match");
+        ASSERT_TRUE(read.type == results[i].type, "Type should match");
+        ASSERT_TRUE(read.quantity == results[i].quantity, "Quantity should match");
+        ASSERT_TRUE(read.price == results[i].price, "Price should match");
+        ASSERT_TRUE(read.action == results[i].action, "Action should match");
+        ASSERT_TRUE(read.status == results[i].status, "Status should match");
+        ASSERT_TRUE(read.executed_quantity == results[i].executed_quantity, "Executed quantity should match");
+        ASSERT_TRUE(read.execution_price == results[i].execution_price, "Execution price should match");
+        ASSERT_TRUE(read.counterparty_id == results[i].counterparty_id, "Counterparty should match");
+    }
+
+    std::remove(filename.c_str());
+
+    std::cout << "All binary_result_roundtrip tests passed!" << std::endl;
+}
+
+// Test that results whose symbol does not fit in the dictionary are skipped, not truncated
+TEST(binary_result_long_symbol) {
+    std::vector<OrderResult> results = sampleResults();
+    results[1].instrument = "SIXTEEN_CHARS_XX";
+    std::string filename = "test_results_long.bin";
+    {
+        BinaryResultWriter writer(filename);
+        for (const auto& result : results) {
+            writer.writeOrderResult(result);
+        }
+        ASSERT_TRUE(writer.close(), "Binary file should be finalized");
+        ASSERT_TRUE(writer.recordCount() == 2, "Writer should count only the 2 valid records");
+        ASSERT_TRUE(writer.rejectedCount() == 1, "Writer should reject the long symbol");
+    }
+
+    BinaryResultReader reader(filename);
+    ASSERT_TRUE(reader.isOpen(), "Binary file should be valid");
+    ASSERT_TRUE(reader.recordCount() == 2, "Reader should see 2 records");
+    ASSERT_TRUE(reader.symbols().size() == 1 && reader.symbols()[0] == "AAPL", "Dictionary should hold only AAPL");
+
+    std::remove(filename.c_str());
+
+    std::cout << "All binary_result_long_symbol tests passed!" << std::endl;
+}
+
+// Test that converting a binary file to CSV gives the same bytes as writing CSV directly
+TEST(binary_result_to_csv) {
+    std::vector<OrderResult> results = sampleResults();
+    std::string direct = "test_results_direct.csv";
+    std::string binary = "test_results.bin";
+    std::string converted = "test_results_converted.csv";
+    {
+        CSVWriter csv(direct);
+        BinaryResultWriter bin(binary);
+        csv.writeHeader();
+        for (const auto& result : results) {
+            csv.writeOrderResult(result);
+            bin.writeOrderResult(result);
+        }
+    }
+    {
+        BinaryResultReader reader(binary);
+        CSVWriter csv(converted);
+        csv.writeHeader();
+        OrderResult result;
+        for (uint64_t i = 0; i < reader.recordCount(); ++i) {
+            reader.toResult(reader.records()[i], result);
+            csv.writeOrderResult(result);
+        }
+    }
+
+    ASSERT_TRUE(readFile(direct) == readFile(converted), "Converted CSV should match the direct CSV");
+
+    std::remove(direct.c_str());
+    std::remove(binary.c_str());
+    std::remove(converted.c_str());
+
+    std::cout << "All binary_result_to_csv tests passed!" << std::endl;
+}
+
+// Test that other files are not accepted as result files
+TEST(binary_result_invalid) {
+    std::string filename = "test_orders.bin";
+    {
+        BinaryOrderWriter writer(filename);
+        writer.writeOrder({1000, 1, "AAPL", Side::BUY, Type::LIMIT, 10, 100.0f, Action::NEW});
+    }
+    BinaryResultReader reader(filename);
+    ASSERT_TRUE(!reader.isOpen(), "Order file should not be accepted as a result file");
+
+    std::remove(filename.c_str());
+
+    std::cout << "All binary_result_invalid tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running Binary Result File tests..." << std::endl;
+
+    test_binary_result_roundtrip();
+    test_binary_result_long_symbol();
+    test_binary_result_to_csv();
+    test_binary_result_invalid();
+
+    std::cout << "All Binary Result File tests passed successfully!" << std::endl;
+    return 0;
+}
@@ -84,9 +84,235 @@ TEST(csv_parser_file_error) {
     std::cout << "All csv_parser_file_error tests passed!" << std::endl;
 }
 
+// Test that the memory-mapped parser produces the same orders as parse()
+TEST(csv_parser_mapped) {
+    std::string filename = createTempCSVFile();
+    CSVParser parser(filename);
+    
+    std::vector<Order> expected = parser.parse();
+    std::vector<Order> orders = parser.parseMapped();
+    
+    ASSERT_TRUE(orders.size() == expected.size(), "Mapped parser should parse the same number of orders");
+    for (size_t i = 0; i < orders.size(); ++i) {
+        ASSERT_TRUE(orders[i].timestamp == expected[i].timestamp, "Mapped timestamp mismatch");
+        ASSERT_TRUE(orders[i].order_id == expected[i].order_id, "Mapped order ID mismatch");
+        ASSERT_TRUE(orders[i].instrument == expected[i].instrument, "Mapped instrument mismatch");
+        ASSERT_TRUE(orders[i].side == expected[i].side, "Mapped side mismatch");
+        ASSERT_TRUE(orders[i].type == expected[i].type, "Mapped type mismatch");
+        ASSERT_TRUE(orders[i].quantity == expected[i].quantity, "Mapped quantity mismatch");
+        ASSERT_TRUE(orders[i].price == expected[i].price, "Mapped price mismatch");
+        ASSERT_TRUE(orders[i].action == expected[i].action, "Mapped action mismatch");
+    }
+    
+    std::remove(filename.c_str());
+    
+    // Missing files yield an empty vector
+    CSVParser missing("non_existent_file.csv");
+    ASSERT_TRUE(missing.parseMapped().empty(), "Should return empty vector for non-existent file");
+    
+    std::cout << "All csv_parser_mapped tests passed!" << std::endl;
+}
+
+// Test single-row parsing, including CRLF endings and malformed rows
+TEST(csv_parser_row) {
+    Order order;
+    ASSERT_TRUE(CSVParser::parseRow("1617278400000000300,4,MSFT, SELL ,LIMIT,200,260.50,CANCEL\r", order),
+                "Row with CRLF ending and padded side should parse");
+    ASSERT_TRUE(order.timestamp == 1617278400000000300, "Row timestamp incorrect");
+    ASSERT_TRUE(order.instrument == "MSFT", "Row instrument incorrect");
+    ASSERT_TRUE(order.side == Side::SELL, "Row side incorrect");
+    ASSERT_TRUE(order.price == 260.5f, "Row price incorrect");
+    ASSERT_TRUE(order.action == Action::CANCEL, "Row action incorrect");
+    
+    ASSERT_TRUE(!CSVParser::parseRow("abc,4,MSFT,SELL,LIMIT,200,260.50,NEW", order), "Bad timestamp should fail");
+    ASSERT_TRUE(!CSVParser::parseRow("1,4,MSFT,HOLD,LIMIT,200,260.50,NEW", order), "Unknown side should fail");
+    ASSERT_TRUE(!CSVParser::parseRow("1,4,MSFT,SELL,LIMIT,200", order), "Truncated row should fail");
+    
+    std::cout << "All csv_parser_row tests passed!" << std::endl;
+}
+
+// Test streaming in small batches through a small buffer and through a mapping
+TEST(csv_parser_stream) {
+    std::string filename = createTempCSVFile();
+    std::vector<Order> expected = CSVParser(filename).parse();
+    
+    for (bool useMmap : {false, true}) {
+        CSVOrderStream stream(filename, useMmap, 16);
+        ASSERT_TRUE(stream.isOpen(), "Stream should open the file");
+        
+        std::vector<Order> batch;
+        std::vector<Order> orders;
+        size_t batches = 0;
+        while (stream.next(batch, 2) > 0) {
+            ASSERT_TRUE(batch.size() <= 2, "Batch should not exceed the requested size");
+            orders.insert(orders.end(), batch.begin(), batch.end());
+            ++batches;
+        }
+        ASSERT_TRUE(batches == 2, "3 orders in batches of 2 should take 2 batches");
+        ASSERT_TRUE(orders.size() == expected.size(), "Stream should yield every order");
+        for (size_t i = 0; i < orders.size(); ++i) {
+            ASSERT_TRUE(orders[i].order_id == expected[i].order_id, "Streamed order ID mismatch");
+            ASSERT_TRUE(orders[i].instrument == expected[i].instrument, "Streamed instrument mismatch");
+            ASSERT_TRUE(orders[i].price == expected[i].price, "Streamed price mismatch");
+        }
+        ASSERT_TRUE(stream.next(batch, 2) == 0, "Exhausted stream should stay exhausted");
+    }
+    
+    // Last row without a trailing newline
+    {
+        std::ofstream file(filename);
+        file << "timestamp,order_id,instrument,side,type,quantity,price,action\n";
+        file << "1,7,AAPL,BUY,LIMIT,10,100.5,NEW";
+    }
+    CSVOrderStream stream(filename);
+    std::vector<Order> batch;
+    ASSERT_TRUE(stream.next(batch, 10) == 1, "Row without trailing newline should be read");
+    ASSERT_TRUE(batch[0].order_id == 7, "Row without trailing newline incorrect");
+    
+    std::remove(filename.c_str());
+    
+    CSVOrderStream missing("non_existent_file.csv");
+    ASSERT_TRUE(!missing.isOpen(), "Missing file should not open");
+    ASSERT_TRUE(missing.next(batch, 10) == 0, "Missing file should yield no orders");
+    
+    std::cout << "All csv_parser_stream tests passed!" << std::endl;
+}
+
+// Test that chunked parallel parsing yields every row once, in file order
+TEST(csv_parser_parallel) {
+    std::string filename = "test_data_parallel.csv";
+    {
+        std::ofstream file(filename);
+        file << "timestamp,order_id,instrument,side,type,quantity,price,action\n";
+        for (int i = 1; i <= 1000; ++i) {
+            file << 1617278400000000000ULL + i << "," << i << "," << (i % 2 ? "AAPL" : "MSFT") << ","
+                 << (i % 3 ? "BUY" : "SELL") << ",LIMIT," << i << "," << 100 + i % 50 << ".25,NEW\n";
+        }
+    }
+    
+    CSVParser parser(filename);
+    std::vector<Order> expected = parser.parse();
+    
+    for (unsigned threads : {1u, 3u, 8u}) {
+        std::vector<std::vector<Order>> chunks = parser.parseParallel(threads, 1);
+        ASSERT_TRUE(chunks.size() == threads, "Should produce one chunk per thread");
+        
+        std::vector<Order> orders;
+        for (const auto& chunk : chunks) {
+            orders.insert(orders.end(), chunk.begin(), chunk.end());
+        }
+        ASSERT_TRUE(orders.size() == expected.size(), "Parallel parse should yield every order");
+        for (size_t i = 0; i < orders.size(); ++i) {
+            ASSERT_TRUE(orders[i].order_id == expected[i].order_id, "Parallel parse should keep file order");
+            ASSERT_TRUE(orders[i].price == expected[i].price, "Parallel price mismatch");
+        }
+    }
+    
+    // Small files are not split below the minimum chunk size
+    ASSERT_TRUE(parser.parseParallel(8).size() == 1, "Small file should be parsed as a single chunk");
+    
+    // Streaming: small chunks handed over in file order, whatever the threads and in-flight bound
+    for (unsigned threads : {1u, 3u, 8u}) {
+        for (size_t maxInFlight : {size_t(1), size_t(2), size_t(0)}) {
+            std::vector<Order> orders;
+            size_t calls = 0;
+            size_t chunks = parser.parseParallel(threads, [&](std::vector<Order>& chunk) {
+                ++calls;
+                orders.insert(orders.end(), chunk.begin(), chunk.end());
+            }, 512, maxInFlight);
+            ASSERT_TRUE(chunks == calls && chunks > 50, "Streaming parse should hand over every small chunk, got " << chunks);
+            ASSERT_TRUE(orders.size() == expected.size(), "Streaming parse should yield every order");
+            for (size_t i = 0; i < orders.size(); ++i) {
+                ASSERT_TRUE(orders[i].order_id == expected[i].order_id, "Streaming parse should keep file order");
+            }
+        }
+    }
+    
+    std::remove(filename.c_str());
+    
+    std::cout << "All csv_parser_parallel tests passed!" << std::endl;
+}
+
+// Test that malformed rows are reported with their position and never abort the parse
+TEST(csv_parser_rejects) {
+    std::string filename = "test_data_rejects.csv";
+    {
+        std::ofstream file(filename);
+        file << "timestamp,order_id,instrument,side,type,quantity,price,action\n";
+        file << "1617278400000000000,1,AAPL,BUY,LIMIT,100,150.25,NEW\n";        // line 2: valid
+        file << "16172784000000x0000,2,AAPL,BUY,LIMIT,100,150.25,NEW\n";        // line 3: bad timestamp
+        file << "1617278400000000200,3,AAPL,HOLD,LIMIT,100,150.25,NEW\n";       // line 4: unknown side
+        file << "\n";                                                            // line 5: empty, ignored
+        file << "1617278400000000300,4,AAPL,SELL,LIMIT,-5,150.25,NEW\n";        // line 6: negative quantity
+        file << "1617278400000000400,5,AAPL,SELL,LIMIT,10,abc,NEW\n";           // line 7: bad price
+        file << "1617278400000000500,6,AAPL,SELL,LIMIT,10,150.25,REPLACE\n";    // line 8: unknown action
+        file << "1617278400000000600,7,AAPL,SELL,LIMIT,10,150.25,NEW,extra\n";  // line 9: extra column
+        file << "1617278400000000700,8,MSFT,SELL,MARKET,10,0,NEW\n";            // line 10: valid
+    }
+    
+    const std::vector<std::pair<size_t, int>> expected = {{3, 1}, {4, 4}, {6, 6}, {7, 7}, {8, 8}, {9, 9}};
+    
+    auto check = [&](const std::vector<ParseReject>& rejects, size_t orders, const std::string& mode) {
+        ASSERT_TRUE(orders == 2, mode + ": should keep the 2 valid rows");
+        ASSERT_TRUE(rejects.size() == expected.size(), mode + ": should report 6 rejected rows");
+        for (size_t i = 0; i < rejects.size(); ++i) {
+            ASSERT_TRUE(rejects[i].line == expected[i].first, mode + ": reject line incorrect");
+            ASSERT_TRUE(rejects[i].column == expected[i].second, mode + ": reject column incorrect");
+            ASSERT_TRUE(std::string(rejects[i].reason).size() > 0, mode + ": reject reason missing");
+        }
+        ASSERT_TRUE(rejects[0].row.rfind("16172784000000x0000", 0) == 0, mode + ": reject should carry the raw row");
+    };
+    
+    {
+        std::vector<ParseReject> rejects;
+        CSVParser parser(filename);
+        parser.setRejectSink([&](const ParseReject& reject) { rejects.push_back(reject); });
+        check(rejects, parser.parse().size(), "parse");
+        ASSERT_TRUE(parser.rejectedCount() == 6, "parse: rejected count incorrect");
+        
+        rejects.clear();
+        check(rejects, parser.parseMapped().size(), "parseMapped");
+        
+        rejects.clear();
+        size_t orders = 0;
+        for (const auto& chunk : parser.parseParallel(3, 1)) {
+            orders += chunk.size();
+        }
+        check(rejects, orders, "parseParallel");
+        
+        rejects.clear();
+        orders = 0;
+        parser.parseParallel(3, [&](std::vector<Order>& chunk) { orders += chunk.size(); }, 1, 2);
+        check(rejects, orders, "parseParallel streaming");
+        ASSERT_TRUE(parser.rejectedCount() == 6, "parseParallel streaming: rejected count incorrect");
+    }
+    
+    for (bool useMmap : {false, true}) {
+        std::vector<ParseReject> rejects;
+        CSVOrderStream stream(filename, useMmap, 32);
+        stream.setRejectSink([&](const ParseReject& reject) { rejects.push_back(reject); });
+        std::vector<Order> batch;
+        size_t orders = 0;
+        while (stream.next(batch, 1) > 0) {
+            orders += batch.size();
+        }
+        check(rejects, orders, "stream");
+        ASSERT_TRUE(stream.rejectedCount() == 6, "stream: rejected count incorrect");
+    }
+    
+    std::remove(filename.c_str());
+    
+    std::cout << "All csv_parser_rejects tests passed!" << std::endl;
+}
+
 int main() {
     test_csv_parser_basic();
     test_csv_parser_file_error();
+    test_csv_parser_mapped();
+    test_csv_parser_row();
+    test_csv_parser_stream();
+    test_csv_parser_parallel();
+    test_csv_parser_rejects();
     
     std::cout << "All CSVParser tests passed successfully!" << std::endl;
     return 0;
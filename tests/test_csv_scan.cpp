@@ -0,0 +1,96 @@
+#include "../src/csv_scan.hpp"
+#include <iostream>
+#include <cassert>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+// Simple test harness function
+#define TEST(name) void test_##name()
+
+// Assertion with message
+#define ASSERT_TRUE(condition, message) \
+    if (!(condition)) { \
+        std::cerr << "Assertion failed: " << message << std::endl; \
+        exit(1); \
+    }
+
+// Test that every kernel finds the same delimiter as memchr for all offsets and lengths
+TEST(csv_scan_find_char) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<> byte_dist(0, 9);
+    const char alphabet[] = "0123,\n.AB";
+    
+    std::vector<char> buffer(300);
+    for (int round = 0; round < 50; ++round) {
+        for (auto& c : buffer) {
+            // Mostly digits, with sparse delimiters
+            int pick = byte_dist(gen);
+            c = pick < 8 ? alphabet[pick % 4] : alphabet[4 + round % 5];
+        }
+        for (size_t offset = 0; offset < 40; ++offset) {
+            for (size_t length : {0ul, 1ul, 15ul, 16ul, 17ul, 31ul, 32ul, 33ul, 100ul, 250ul}) {
+                const char* begin = buffer.data() + offset;
+                const char* end = begin + length;
+                for (char needle : {',', '\n', 'Z'}) {
+                    const char* found = static_cast<const char*>(std::memchr(begin, needle, length));
+                    const char* expected = found ? found : end;
+                    for (ScanKernel kernel : {ScanKernel::SCALAR, ScanKernel::SSE2, ScanKernel::AVX2}) {
+                        ASSERT_TRUE(findChar(kernel, begin, end, needle) == expected,
+                                    std::string("Kernel ") + scanKernelName(kernel) + " found the wrong position");
+                    }
+                    ASSERT_TRUE(findChar(begin, end, needle) == expected, "Dispatched kernel found the wrong position");
+                }
+            }
+        }
+    }
+    
+    std::cout << "Active scan kernel: " << scanKernelName(activeScanKernel()) << std::endl;
+    std::cout << "All csv_scan_find_char tests passed!" << std::endl;
+}
+
+// Test eight-digit SWAR conversion
+TEST(csv_scan_eight_digits) {
+    uint64_t value = 0;
+    ASSERT_TRUE(parseEightDigits("12345678", value) && value == 12345678, "12345678 conversion incorrect");
+    ASSERT_TRUE(parseEightDigits("00000000", value) && value == 0, "00000000 conversion incorrect");
+    ASSERT_TRUE(parseEightDigits("99999999", value) && value == 99999999, "99999999 conversion incorrect");
+    ASSERT_TRUE(parseEightDigits("00000042", value) && value == 42, "00000042 conversion incorrect");
+    
+    ASSERT_TRUE(!parseEightDigits("1234567,", value), "Comma should be rejected");
+    ASSERT_TRUE(!parseEightDigits("12a45678", value), "Letter should be rejected");
+    ASSERT_TRUE(!parseEightDigits("1234/678", value), "Slash should be rejected");
+    ASSERT_TRUE(!parseEightDigits("1234:678", value), "Colon should be rejected");
+    ASSERT_TRUE(!parseEightDigits("\xb1" "2345678", value), "Non-ASCII byte should be rejected");
+    
+    std::cout << "All csv_scan_eight_digits tests passed!" << std::endl;
+}
+
+// Test unsigned field conversion against std::stoull
+TEST(csv_scan_unsigned) {
+    uint64_t value = 0;
+    for (const std::string field : {"0", "7", "42", "12345678", "123456789", "1617278400000000000",
+                                    "18446744073709551615", "9999999999999999999"}) {
+        ASSERT_TRUE(parseUnsigned(field, value), "Field " + field + " should convert");
+        ASSERT_TRUE(value == std::stoull(field), "Field " + field + " converted incorrectly");
+    }
+    
+    ASSERT_TRUE(!parseUnsigned("", value), "Empty field should be rejected");
+    ASSERT_TRUE(!parseUnsigned("-1", value), "Negative field should be rejected");
+    ASSERT_TRUE(!parseUnsigned("16172784000000000x0", value), "Trailing garbage should be rejected");
+    ASSERT_TRUE(!parseUnsigned("18446744073709551616", value), "Overflow should be rejected");
+    
+    std::cout << "All csv_scan_unsigned tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running CSV scan tests..." << std::endl;
+    
+    test_csv_scan_find_char();
+    test_csv_scan_eight_digits();
+    test_csv_scan_unsigned();
+    
+    std::cout << "All CSV scan tests passed successfully!" << std::endl;
+    return 0;
+}
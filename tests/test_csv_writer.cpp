@@ -155,10 +155,61 @@ TEST(csv_writer_conversions) {
     std::cout << "All csv_writer_conversions tests passed!" << std::endl;
 }
 
+// Test that rows are formatted exactly like the stream-based writer, across buffer flushes
+TEST(csv_writer_buffered) {
+    std::string filename = "test_output_buffered.csv";
+    
+    OrderResult result;
+    result.timestamp = 1617278400000000200;
+    result.order_id = 3;
+    result.instrument = "AAPL";
+    result.side = Side::SELL;
+    result.type = Type::MARKET;
+    result.quantity = 50;
+    result.price = 150.25f;
+    result.action = Action::MODIFY;
+    result.status = OrderStatus::PARTIALLY_EXECUTED;
+    result.executed_quantity = 25;
+    result.execution_price = 1234567.0f;
+    result.counterparty_id = 1;
+    
+    // A buffer smaller than a row forces a flush on every row
+    {
+        CSVWriter writer(filename, 16);
+        writer.writeHeader();
+        for (int i = 0; i < 100; ++i) {
+            result.order_id = i;
+            writer.writeOrderResult(result);
+        }
+        writer.flush();
+        
+        std::ifstream partial(filename);
+        int count = 0;
+        std::string line;
+        while (std::getline(partial, line)) {
+            ++count;
+        }
+        ASSERT_TRUE(count == 101, "flush() should write all buffered rows");
+    }
+    
+    std::ifstream file(filename);
+    std::string line;
+    std::getline(file, line);
+    std::getline(file, line);
+    ASSERT_TRUE(line == "1617278400000000200,0,AAPL,SELL,MARKET,50,150.25,MODIFY,PARTIALLY_EXECUTED,25,1.23457e+06,1",
+                "Row should match the std::ostream format, got " << line);
+    file.close();
+    
+    std::remove(filename.c_str());
+    
+    std::cout << "All csv_writer_buffered tests passed!" << std::endl;
+}
+
 int main() {
     test_csv_writer_basic();
     test_csv_writer_error();
     test_csv_writer_conversions();
+    test_csv_writer_buffered();
     
     std::cout << "All CSVWriter tests passed successfully!" << std::endl;
     return 0;
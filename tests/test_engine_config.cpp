@@ -0,0 +1,176 @@
+#include "../src/engine_config.hpp"
+#include "../src/matching_engine.hpp"
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <memory_resource>
+#include <string>
+
+// Simple test harness function
+#define TEST(name) void test_##name()
+
+// Assertion with message
+#define ASSERT_TRUE(condition, message) \
+    if (!(condition)) { \
+        std::cerr << "Assertion failed: " << message << std::endl; \
+        exit(1); \
+    }
+
+// Memory resource that counts the allocations routed through it
+class CountingResource : public std::pmr::memory_resource {
+public:
+    size_t allocations = 0;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+// Create a temporary configuration file for testing
+std::string createTempConfigFile() {
+    std::string filename = "test_engine_config.csv";
+    std::ofstream file(filename);
+    
+    file << "instrument,expected_orders,min_price,max_price,tick_size\n";
+    file << "AAPL,1000,100.00,200.00,0.25\n";
+    file << "MSFT,500,250.00,270.00,0.01\n";
+    file << "BROKEN,abc,1,2,0.01\n";
+    file << "SHORT,1000\n";
+    file << "LONG,1000,1,2,0.01,extra\n";
+    
+    file.close();
+    return filename;
+}
+
+// Test loading a configuration profile
+TEST(engine_config_load) {
+    std::string filename = createTempConfigFile();
+    EngineConfig config = EngineConfig::load(filename);
+    
+    ASSERT_TRUE(config.instruments.size() == 2, "Should load 2 instruments and skip the malformed rows");
+    
+    const InstrumentConfig* aapl = config.find("AAPL");
+    ASSERT_TRUE(aapl != nullptr, "AAPL should be configured");
+    ASSERT_TRUE(aapl->expected_orders == 1000, "AAPL expected orders incorrect");
+    ASSERT_TRUE(aapl->tick_size == 0.25, "AAPL tick size incorrect");
+    ASSERT_TRUE(aapl->expectedLevels() == 401, "AAPL should span 401 levels");
+    
+    const InstrumentConfig* msft = config.find("MSFT");
+    ASSERT_TRUE(msft != nullptr, "MSFT should be configured");
+    ASSERT_TRUE(msft->expectedLevels() == 500, "MSFT levels should be bounded by expected orders");
+    
+    ASSERT_TRUE(config.find("GOOG") == nullptr, "GOOG should not be configured");
+    ASSERT_TRUE(config.find("SHORT") == nullptr, "A row with missing fields should be skipped");
+    ASSERT_TRUE(config.find("LONG") == nullptr, "A row with extra fields should be skipped");
+    
+    std::remove(filename.c_str());
+    
+    // A missing file yields an empty profile
+    EngineConfig missing = EngineConfig::load("non_existent_config.csv");
+    ASSERT_TRUE(missing.instruments.empty(), "Missing file should yield an empty profile");
+    
+    std::cout << "All engine_config_load tests passed!" << std::endl;
+}
+
+// Test that the engine pre-creates and pre-sizes the configured books
+TEST(engine_config_presize) {
+    EngineConfig config;
+    config.instruments.push_back({"AAPL", 1000, 100.0, 200.0, 0.25});
+    
+    CountingResource upstream;
+    MatchingEngine engine(config, &upstream);
+    
+    OrderBook* book = engine.getOrderBook("AAPL");
+    ASSERT_TRUE(book != nullptr, "AAPL book should be pre-created");
+    ASSERT_TRUE(book->getTickSize() == 0.25, "AAPL tick size should be set");
+    
+    // The whole opening flow fits in the storage reserved at startup
+    size_t before = upstream.allocations;
+    for (int i = 1; i <= 1000; ++i) {
+        Order order = {
+            .timestamp = static_cast<uint64_t>(i),
+            .order_id = i,
+            .instrument = "AAPL",
+            .side = Side::BUY,
+            .type = Type::LIMIT,
+            .quantity = 10,
+            .price = 100.0f + 0.25f * (i % 200),
+            .action = Action::NEW
+        };
+        engine.processOrder(order);
+    }
+    ASSERT_TRUE(upstream.allocations == before, "Configured capacity should not hit the upstream resource");
+    
+    std::cout << "All engine_config_presize tests passed!" << std::endl;
+}
+
+// Test that limit orders off the tick grid are rejected
+TEST(engine_config_tick_size) {
+    EngineConfig config;
+    config.instruments.push_back({"AAPL", 100, 100.0, 200.0, 0.25});
+    MatchingEngine engine(config);
+    
+    Order onTick = {1, 1, "AAPL", Side::BUY, Type::LIMIT, 10, 150.25f, Action::NEW};
+    Order offTick = {2, 2, "AAPL", Side::BUY, Type::LIMIT, 10, 150.10f, Action::NEW};
+    Order market = {3, 3, "AAPL", Side::SELL, Type::MARKET, 5, 0.0f, Action::NEW};
+    
+    ASSERT_TRUE(engine.processOrder(onTick)[0].status == OrderStatus::PENDING, "On-tick order should rest");
+    ASSERT_TRUE(engine.processOrder(offTick)[0].status == OrderStatus::REJECTED, "Off-tick order should be rejected");
+    ASSERT_TRUE(engine.processOrder(market)[0].status == OrderStatus::EXECUTED, "Market orders ignore the tick size");
+    
+    Order modifyOffTick = {4, 1, "AAPL", Side::BUY, Type::LIMIT, 10, 150.30f, Action::MODIFY};
+    ASSERT_TRUE(engine.processOrder(modifyOffTick)[0].status == OrderStatus::REJECTED, "Off-tick modify should be rejected");
+    
+    // Unconfigured instruments accept any price
+    Order other = {5, 5, "MSFT", Side::BUY, Type::LIMIT, 10, 260.123f, Action::NEW};
+    ASSERT_TRUE(engine.processOrder(other)[0].status == OrderStatus::PENDING, "Unconfigured instrument should accept any price");
+    
+    std::cout << "All engine_config_tick_size tests passed!" << std::endl;
+}
+
+// Test that every float cent price is on a 0.01 tick grid
+TEST(engine_config_cent_tick_size) {
+    OrderBook book;
+    book.setTickSize(0.01);
+    
+    int rejected = 0;
+    for (int cents = 10000; cents < 30000; ++cents) {
+        float price = static_cast<float>(cents) / 100.0f;
+        if (!book.isValidPrice(price)) {
+            ++rejected;
+        }
+    }
+    ASSERT_TRUE(rejected == 0, "Cent prices should be on a 0.01 tick grid, " << rejected << " rejected");
+    ASSERT_TRUE(book.isValidPrice(100.01f) && book.isValidPrice(299.99f), "100.01 and 299.99 should be valid");
+    ASSERT_TRUE(!book.isValidPrice(100.015f), "Half-cent price should be rejected");
+    ASSERT_TRUE(!book.isValidPrice(100.003f), "Price off the cent grid should be rejected");
+    
+    EngineConfig config;
+    config.instruments.push_back({"MSFT", 100, 100.0, 300.0, 0.01});
+    MatchingEngine engine(config);
+    Order order = {1, 1, "MSFT", Side::BUY, Type::LIMIT, 10, 100.03f, Action::NEW};
+    ASSERT_TRUE(engine.processOrder(order)[0].status == OrderStatus::PENDING, "Cent-priced order should rest");
+    
+    std::cout << "All engine_config_cent_tick_size tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running EngineConfig tests..." << std::endl;
+    
+    test_engine_config_load();
+    test_engine_config_presize();
+    test_engine_config_tick_size();
+    test_engine_config_cent_tick_size();
+    
+    std::cout << "All EngineConfig tests passed successfully!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,161 @@
+#include "../src/logger.hpp"
+#include <iostream>
+#include <cassert>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Simple test harness function
+#define TEST(name) void test_##name()
+
+// Assertion with message
+#define ASSERT_TRUE(condition, message) \
+    if (!(condition)) { \
+        std::cerr << "Assertion failed: " << message << std::endl; \
+        exit(1); \
+    }
+
+// Count the lines of a text
+static size_t countLines(const std::string& text) {
+    size_t lines = 0;
+    for (char c : text) {
+        lines += c == '\n';
+    }
+    return lines;
+}
+
+// Test argument formatting
+TEST(logger_format) {
+    std::ostringstream out;
+    Logger& logger = Logger::instance();
+    logger.setOutput(out);
+    logger.setLevel(LogLevel::TRACE);
+
+    std::string instrument = "AAPL";
+    ENGINE_LOG_INFO("Order #{} - {} {} {} @ {:.2f}", 42, std::string_view("BUY"), 100u, instrument, 150.256);
+    ENGINE_LOG_INFO("ratio {} price {:.1f} flag {}", 0.125, 2.0, true);
+    ENGINE_LOG_INFO("no arguments");
+    ENGINE_LOG_INFO("negative {}", -7L);
+    logger.flush();
+
+    std::string expected =
+        "Order #42 - BUY 100 AAPL @ 150.26\n"
+        "ratio 0.125 price 2.0 flag 1\n"
+        "no arguments\n"
+        "negative -7\n";
+    ASSERT_TRUE(out.str() == expected, "Unexpected formatted output: " << out.str());
+
+    logger.setOutput(std::cout);
+    std::cout << "All logger_format tests passed!" << std::endl;
+}
+
+// Test level filtering and lazy argument evaluation
+TEST(logger_levels) {
+    std::ostringstream out;
+    Logger& logger = Logger::instance();
+    logger.setOutput(out);
+    logger.setLevel(LogLevel::WARN);
+
+    int evaluated = 0;
+    auto argument = [&evaluated] { return ++evaluated; };
+    ENGINE_LOG_DEBUG("debug {}", argument());
+    ENGINE_LOG_INFO("info {}", argument());
+    ENGINE_LOG_WARN("warn {}", argument());
+    ENGINE_LOG_ERROR("error {}", argument());
+    logger.flush();
+
+    ASSERT_TRUE(out.str() == "warn 1\nerror 2\n", "Only warnings and errors should be written");
+    ASSERT_TRUE(evaluated == 2, "Arguments of disabled levels should not be evaluated");
+
+    LogLevel level = LogLevel::TRACE;
+    ASSERT_TRUE(parseLogLevel("off", level) && level == LogLevel::OFF, "off should parse");
+    ASSERT_TRUE(parseLogLevel("debug", level) && level == LogLevel::DEBUG, "debug should parse");
+    ASSERT_TRUE(!parseLogLevel("verbose", level), "Unknown levels should be rejected");
+
+    logger.setLevel(LogLevel::OFF);
+    ENGINE_LOG_ERROR("error {}", argument());
+    logger.flush();
+    ASSERT_TRUE(evaluated == 2, "Nothing should be evaluated when logging is off");
+
+    logger.setOutput(std::cout);
+    std::cout << "All logger_levels tests passed!" << std::endl;
+}
+
+// Test that records from several threads are all written, in order within each thread
+TEST(logger_threads) {
+    std::ostringstream out;
+    Logger& logger = Logger::instance();
+    logger.setOutput(out);
+    logger.setLevel(LogLevel::INFO);
+    logger.setBlockWhenFull(true);
+
+    const int threadCount = 4;
+    const int recordsPerThread = 20000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([t] {
+            for (int i = 0; i < recordsPerThread; ++i) {
+                ENGINE_LOG_INFO("{} {}", t, i);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    logger.flush();
+
+    std::vector<int> next(threadCount, 0);
+    std::istringstream in(out.str());
+    int t = 0;
+    int i = 0;
+    bool ordered = true;
+    while (in >> t >> i) {
+        ordered = ordered && t >= 0 && t < threadCount && next[t] == i;
+        if (t >= 0 && t < threadCount) {
+            next[t] = i + 1;
+        }
+    }
+    ASSERT_TRUE(ordered, "Records of a thread should be written in order");
+    for (int n : next) {
+        ASSERT_TRUE(n == recordsPerThread, "Every record should be written when blocking");
+    }
+    ASSERT_TRUE(logger.droppedCount() == 0, "Nothing should be dropped when blocking");
+
+    logger.setOutput(std::cout);
+    std::cout << "All logger_threads tests passed!" << std::endl;
+}
+
+// Test that records are dropped and counted, rather than lost, when rings overflow
+TEST(logger_drop) {
+    std::ostringstream out;
+    Logger& logger = Logger::instance();
+    logger.setOutput(out);
+    logger.setLevel(LogLevel::INFO);
+    logger.setBlockWhenFull(false);
+
+    const size_t records = 100000;
+    uint64_t droppedBefore = logger.droppedCount();
+    for (size_t i = 0; i < records; ++i) {
+        ENGINE_LOG_INFO("record {}", i);
+    }
+    logger.flush();
+
+    uint64_t dropped = logger.droppedCount() - droppedBefore;
+    ASSERT_TRUE(countLines(out.str()) + dropped == records, "Every record should be written or counted as dropped");
+
+    logger.setOutput(std::cout);
+    std::cout << "All logger_drop tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running Logger tests..." << std::endl;
+
+    test_logger_format();
+    test_logger_levels();
+    test_logger_threads();
+    test_logger_drop();
+
+    std::cout << "All Logger tests passed successfully!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,201 @@
+#include "../src/market_data_publisher.hpp"
+#include "../src/matching_engine.hpp"
+#include <iostream>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// Simple test harness function
+#define TEST(name) void test_##name()
+
+// Assertion with message
+#define ASSERT_TRUE(condition, message) \
+    if (!(condition)) { \
+        std::cerr << "Assertion failed: " << message << std::endl; \
+        exit(1); \
+    }
+
+std::string ringName(const char* suffix) {
+    return "/test_md_" + std::to_string(getpid()) + "_" + suffix;
+}
+
+MarketDataMessage levelMessage(uint64_t sequence, int32_t quantity) {
+    MarketDataMessage message;
+    std::memset(&message, 0, sizeof(message));
+    message.header.length = sizeof(LevelUpdateMessage);
+    message.header.type = static_cast<uint8_t>(MarketDataType::LEVEL_UPDATE);
+    message.header.sequence = sequence;
+    message.level.quantity = quantity;
+    return message;
+}
+
+Order limitOrder(int id, Side side, int quantity, float price, Action action = Action::NEW) {
+    return Order{1000 + static_cast<uint64_t>(id), id, "AAPL", side, Type::LIMIT, quantity, price, action};
+}
+
+// Test that readers get published batches in order and detect overruns
+TEST(ring) {
+    std::string name = ringName("ring");
+    MarketDataRingWriter writer(name, 4);
+    ASSERT_TRUE(writer.isOpen(), "Writer should create the ring");
+    MarketDataRingReader reader(name);
+    ASSERT_TRUE(reader.isOpen(), "Reader should open the ring");
+
+    std::vector<MarketDataMessage> messages;
+    ASSERT_TRUE(reader.poll(messages) == 0, "Empty ring should have no messages");
+
+    std::vector<MarketDataMessage> batch = {levelMessage(1, 10), levelMessage(2, 20), levelMessage(3, 30)};
+    writer.publish(batch);
+    ASSERT_TRUE(reader.poll(messages, 2) == 2, "Poll should respect the maximum");
+    ASSERT_TRUE(reader.poll(messages) == 1, "Poll should return the rest");
+    ASSERT_TRUE(messages[0].level.quantity == 10 && messages[2].header.sequence == 3, "Messages should be in order");
+
+    // Six more messages on a four-slot ring: the reader loses two
+    batch.clear();
+    for (uint64_t sequence = 4; sequence <= 9; ++sequence) {
+        batch.push_back(levelMessage(sequence, static_cast<int32_t>(sequence * 10)));
+    }
+    writer.publish(batch);
+    messages.clear();
+    ASSERT_TRUE(reader.poll(messages) == 4, "Reader should get the messages still held");
+    ASSERT_TRUE(reader.lost() == 2, "Reader should count the overwritten messages");
+    ASSERT_TRUE(messages.front().header.sequence == 6 && messages.back().header.sequence == 9,
+                "Reader should resume at the oldest message");
+
+    // A late reader starts at the oldest message held
+    MarketDataRingReader lateReader(name);
+    ASSERT_TRUE(lateReader.nextSequence() == 6, "Late reader should start at the oldest message");
+
+    MarketDataRingReader missing(ringName("missing"));
+    ASSERT_TRUE(!missing.isOpen(), "Opening a missing ring should fail");
+
+    std::cout << "All ring tests passed!" << std::endl;
+}
+
+// Test the messages the engine publishes for adds, executions, replaces and deletes
+TEST(publisher) {
+    int receiver = socket(AF_INET, SOCK_DGRAM, 0);
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ASSERT_TRUE(bind(receiver, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0, "Receiver should bind");
+    socklen_t length = sizeof(address);
+    getsockname(receiver, reinterpret_cast<sockaddr*>(&address), &length);
+
+    MarketDataOptions options;
+    options.ringName = ringName("publisher");
+    options.udpAddress = "127.0.0.1";
+    options.udpPort = ntohs(address.sin_port);
+    MarketDataPublisher publisher(options);
+    ASSERT_TRUE(publisher.isOpen(), "Publisher should open");
+    MarketDataRingReader reader(options.ringName);
+
+    MatchingEngine engine;
+    engine.setMarketDataPublisher(&publisher);
+    engine.processOrder(limitOrder(1, Side::SELL, 10, 100.0f));
+    engine.processOrder(limitOrder(2, Side::BUY, 4, 101.0f));
+    engine.processOrder(limitOrder(1, Side::SELL, 12, 100.5f, Action::MODIFY));
+    engine.processOrder(limitOrder(1, Side::SELL, 0, 0.0f, Action::CANCEL));
+    engine.processOrder(limitOrder(3, Side::SELL, 0, 0.0f, Action::CANCEL));
+
+    std::vector<MarketDataMessage> messages;
+    reader.poll(messages);
+    ASSERT_TRUE(messages.size() == 9, "Nine messages should be published");
+    for (size_t i = 0; i < messages.size(); ++i) {
+        ASSERT_TRUE(messages[i].header.sequence == i + 1, "Sequence numbers should be contiguous");
+        ASSERT_TRUE(messages[i].header.locate == 1, "All messages should use the AAPL locate code");
+    }
+    auto type = [&](size_t i) { return static_cast<MarketDataType>(messages[i].header.type); };
+
+    ASSERT_TRUE(type(0) == MarketDataType::INSTRUMENT_DIRECTORY
+                && std::string(messages[0].directory.symbol) == "AAPL", "Directory should come first");
+    ASSERT_TRUE(type(1) == MarketDataType::ADD_ORDER && messages[1].add.order_id == 1
+                && messages[1].add.quantity == 10, "Resting sell should be added");
+    ASSERT_TRUE(type(2) == MarketDataType::LEVEL_UPDATE && messages[2].level.quantity == 10
+                && messages[2].level.count == 1, "Level 100 should hold the sell");
+
+    ASSERT_TRUE(type(3) == MarketDataType::ORDER_EXECUTED && messages[3].executed.order_id == 1
+                && messages[3].executed.executed_quantity == 4 && messages[3].executed.counterparty_id == 2
+                && messages[3].executed.match_number == 1, "Crossing buy should execute order 1");
+    ASSERT_TRUE(messages[3].header.timestamp == 1002, "Messages should carry the input timestamp");
+
+    ASSERT_TRUE(type(4) == MarketDataType::REPLACE_ORDER && messages[4].add.price == 100.5f, "Modify should replace");
+    ASSERT_TRUE(type(5) == MarketDataType::LEVEL_UPDATE && messages[5].level.price == 100.0f
+                && messages[5].level.quantity == 0, "Old level should be emptied");
+    ASSERT_TRUE(type(6) == MarketDataType::LEVEL_UPDATE && messages[6].level.price == 100.5f
+                && messages[6].level.quantity == 12, "New level should hold the order");
+
+    ASSERT_TRUE(type(7) == MarketDataType::DELETE_ORDER && messages[7].remove.order_id == 1
+                && messages[7].remove.price == 100.5f, "Cancel should delete the order");
+    ASSERT_TRUE(type(8) == MarketDataType::LEVEL_UPDATE && messages[8].level.count == 0, "Level should be emptied");
+
+    ASSERT_TRUE(publisher.stats().messages == 9 && publisher.stats().batches == 4,
+                "A rejected cancel should publish nothing");
+
+    // The same messages arrive over UDP, one datagram per input
+    char datagram[MARKET_DATA_DATAGRAM_SIZE];
+    uint64_t expected = 1;
+    for (int i = 0; i < 4; ++i) {
+        ssize_t got = recv(receiver, datagram, sizeof(datagram), MSG_DONTWAIT);
+        ASSERT_TRUE(got >= static_cast<ssize_t>(sizeof(MarketDataPacketHeader)), "A datagram should arrive per batch");
+        MarketDataPacketHeader header;
+        std::memcpy(&header, datagram, sizeof(header));
+        ASSERT_TRUE(header.sequence == expected, "Datagrams should continue the sequence");
+        expected += header.count;
+    }
+    ASSERT_TRUE(expected == 10, "Datagrams should carry every message");
+    close(receiver);
+
+    std::cout << "All publisher tests passed!" << std::endl;
+}
+
+// Test that a large batch is split into datagrams that fit
+TEST(publisher_split_datagrams) {
+    int receiver = socket(AF_INET, SOCK_DGRAM, 0);
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    bind(receiver, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+    socklen_t length = sizeof(address);
+    getsockname(receiver, reinterpret_cast<sockaddr*>(&address), &length);
+
+    MarketDataOptions options;
+    options.udpAddress = "127.0.0.1";
+    options.udpPort = ntohs(address.sin_port);
+    MarketDataPublisher publisher(options);
+
+    MatchingEngine engine;
+    engine.setMarketDataPublisher(&publisher);
+    for (int id = 1; id <= 60; ++id) {
+        engine.processOrder(limitOrder(id, Side::SELL, 1, 100.0f));
+    }
+    uint64_t before = publisher.stats().datagrams;
+    engine.processOrder(Order{2000, 100, "AAPL", Side::BUY, Type::MARKET, 60, 0.0f, Action::NEW});
+    ASSERT_TRUE(publisher.stats().datagrams - before == 2, "Sixty executions should need two datagrams");
+
+    char datagram[2 * MARKET_DATA_DATAGRAM_SIZE];
+    ssize_t largest = 0;
+    ssize_t got;
+    while ((got = recv(receiver, datagram, sizeof(datagram), MSG_DONTWAIT)) > 0) {
+        largest = std::max(largest, got);
+    }
+    ASSERT_TRUE(largest <= static_cast<ssize_t>(MARKET_DATA_DATAGRAM_SIZE), "Datagrams should fit the size limit");
+    close(receiver);
+
+    std::cout << "All publisher_split_datagrams tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running MarketData tests..." << std::endl;
+
+    test_ring();
+    test_publisher();
+    test_publisher_split_datagrams();
+
+    std::cout << "All MarketData tests passed successfully!" << std::endl;
+    return 0;
+}
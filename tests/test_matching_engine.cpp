@@ -1,6 +1,7 @@
 #include "../src/matching_engine.hpp"
 #include <iostream>
 #include <cassert>
+#include <memory_resource>
 #include <vector>
 
 // Simple test harness function
@@ -331,12 +332,70 @@ TEST(matching_engine_cancel_modify) {
     std::cout << "All matching_engine_cancel_modify tests passed!" << std::endl;
 }
 
+// Test that books created by the engine use the engine's memory resource
+TEST(matching_engine_memory_resource) {
+    std::pmr::unsynchronized_pool_resource pool;
+    MatchingEngine engine(&pool);
+    
+    Order buy_order = {
+        .timestamp = 1617278400000000000,
+        .order_id = 1,
+        .instrument = "AAPL",
+        .side = Side::BUY,
+        .type = Type::LIMIT,
+        .quantity = 100,
+        .price = 150.25,
+        .action = Action::NEW
+    };
+    engine.processOrder(buy_order);
+    
+    OrderBook* book = engine.getOrderBook("AAPL");
+    ASSERT_TRUE(book != nullptr, "Order book should be created");
+    ASSERT_TRUE(book->getMemoryResource() == &pool, "Order book should use the engine's resource");
+    ASSERT_TRUE(engine.getOrderBooks().get_allocator().resource() == &pool, "Book map should use the engine's resource");
+    ASSERT_TRUE(book->getBuySide().at(150.25).size() == 1, "Order should rest in the book");
+    
+    std::cout << "All matching_engine_memory_resource tests passed!" << std::endl;
+}
+
+// Test that a batch produces the same results as processing orders one by one
+TEST(matching_engine_batch) {
+    std::vector<Order> batch = {
+        {1, 1, "AAPL", Side::BUY, Type::LIMIT, 100, 150.0f, Action::NEW},
+        {2, 2, "AAPL", Side::SELL, Type::LIMIT, 40, 150.0f, Action::NEW},
+        {3, 1, "AAPL", Side::BUY, Type::LIMIT, 0, 0.0f, Action::CANCEL}
+    };
+    
+    MatchingEngine reference;
+    std::vector<OrderResult> expected;
+    for (const auto& order : batch) {
+        auto results = reference.processOrder(order);
+        expected.insert(expected.end(), results.begin(), results.end());
+    }
+    
+    MatchingEngine engine;
+    std::vector<OrderResult> results;
+    size_t appended = engine.processBatch(batch, results);
+    
+    ASSERT_TRUE(appended == expected.size(), "Batch should append one entry per result");
+    ASSERT_TRUE(results.size() == 4, "Batch should produce 4 results");
+    for (size_t i = 0; i < results.size(); ++i) {
+        ASSERT_TRUE(results[i].order_id == expected[i].order_id, "Batch result order mismatch");
+        ASSERT_TRUE(results[i].status == expected[i].status, "Batch result status mismatch");
+    }
+    ASSERT_TRUE(results[3].status == OrderStatus::CANCELED, "Last result should be the cancel");
+    
+    std::cout << "All matching_engine_batch tests passed!" << std::endl;
+}
+
 int main() {
     std::cout << "Running MatchingEngine tests..." << std::endl;
     test_matching_engine_basic();
     test_matching_engine_priority();
     test_matching_engine_market_orders();
     test_matching_engine_cancel_modify();
+    test_matching_engine_memory_resource();
+    test_matching_engine_batch();
     std::cout << "All MatchingEngine tests passed!" << std::endl;
     return 0;
 }
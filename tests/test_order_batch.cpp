@@ -0,0 +1,226 @@
+#include "../src/order_batch.hpp"
+#include "../src/binary_order_file.hpp"
+#include "../src/csv_parser.hpp"
+#include "../src/matching_engine.hpp"
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <vector>
+
+// Simple test harness function
+#define TEST(name) void test_##name()
+
+// Assertion with message
+#define ASSERT_TRUE(condition, message) \
+    if (!(condition)) { \
+        std::cerr << "Assertion failed: " << message << std::endl; \
+        exit(1); \
+    }
+
+// Orders shared by the tests
+static std::vector<Order> sampleOrders() {
+    return {
+        {1, 1, "AAPL", Side::BUY, Type::LIMIT, 100, 150.0f, Action::NEW},
+        {2, 2, "MSFT", Side::SELL, Type::LIMIT, 50, 300.0f, Action::NEW},
+        {3, 3, "AAPL", Side::SELL, Type::LIMIT, 40, 150.0f, Action::NEW},
+        {4, 4, "MSFT", Side::BUY, Type::MARKET, 20, 0.0f, Action::NEW},
+        {5, 1, "AAPL", Side::BUY, Type::LIMIT, 0, 0.0f, Action::CANCEL}
+    };
+}
+
+// Write a CSV file holding the given orders
+static void writeCsv(const std::string& filename, const std::vector<Order>& orders) {
+    std::ofstream file(filename);
+    file << "timestamp,order_id,instrument,side,type,quantity,price,action\n";
+    for (const auto& order : orders) {
+        file << order.timestamp << "," << order.order_id << "," << order.instrument << ","
+             << sideToString(order.side) << "," << typeToString(order.type) << "," << order.quantity << ","
+             << order.price << "," << actionToString(order.action) << "\n";
+    }
+}
+
+// Check that a batch holds the given orders, in order
+static bool sameOrders(const OrderBatch& batch, const std::vector<Order>& orders) {
+    if (batch.size() != orders.size()) {
+        return false;
+    }
+    Order order;
+    for (size_t i = 0; i < orders.size(); ++i) {
+        batch.toOrder(i, order);
+        if (order.timestamp != orders[i].timestamp || order.order_id != orders[i].order_id
+            || order.instrument != orders[i].instrument || order.side != orders[i].side
+            || order.type != orders[i].type || order.quantity != orders[i].quantity
+            || order.price != orders[i].price || order.action != orders[i].action) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Test appending, interning and converting rows
+TEST(order_batch_columns) {
+    std::vector<Order> orders = sampleOrders();
+    OrderBatch batch;
+    for (const auto& order : orders) {
+        batch.append(order);
+    }
+
+    ASSERT_TRUE(batch.size() == orders.size(), "Batch should hold every order");
+    ASSERT_TRUE(batch.symbols().size() == 2, "Symbols should be interned once");
+    ASSERT_TRUE(batch.instrumentIds()[0] == batch.instrumentIds()[2], "Same symbol should get the same id");
+    ASSERT_TRUE(sameOrders(batch, orders), "Rows should convert back to the original orders");
+
+    auto aligned = [](const void* p) { return reinterpret_cast<uintptr_t>(p) % OrderBatch::ALIGNMENT == 0; };
+    ASSERT_TRUE(aligned(batch.timestamps()) && aligned(batch.prices()) && aligned(batch.sides()),
+                "Columns should be cache-line aligned");
+
+    batch.clear();
+    ASSERT_TRUE(batch.empty(), "Clear should remove every row");
+    ASSERT_TRUE(batch.internSymbol("MSFT") == 1, "Clear should keep the symbol dictionary");
+
+    std::cout << "All order_batch_columns tests passed!" << std::endl;
+}
+
+// Test whole-batch validation and grouping by instrument
+TEST(order_batch_validate_group) {
+    OrderBatch batch;
+    uint32_t aapl = batch.internSymbol("AAPL");
+    uint32_t msft = batch.internSymbol("MSFT");
+    batch.append(1, 1, aapl, Side::BUY, Type::LIMIT, 10, 1.0f, Action::NEW);
+    batch.append(2, 2, msft, Side::BUY, Type::LIMIT, -1, 1.0f, Action::NEW);
+    batch.append(3, 3, aapl, Side::BUY, Type::LIMIT, 10, std::numeric_limits<float>::quiet_NaN(), Action::NEW);
+    batch.append(4, 4, msft, static_cast<Side>(7), Type::LIMIT, 10, 1.0f, Action::NEW);
+    batch.append(5, 5, 9, Side::SELL, Type::LIMIT, 10, 1.0f, Action::NEW);
+    batch.append(6, 6, msft, Side::SELL, Type::MARKET, 10, 0.0f, Action::CANCEL);
+    batch.append(7, 7, aapl, Side::SELL, Type::LIMIT, 10, 2.0f, static_cast<Action>(3));
+
+    OrderBatch::Column<uint8_t> valid;
+    ASSERT_TRUE(batch.validate(valid) == 2, "Two rows should be valid");
+    std::vector<uint8_t> expected = {1, 0, 0, 0, 0, 1, 0};
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_TRUE(valid[i] == expected[i], "Unexpected validation of row " << i);
+    }
+
+    std::vector<uint32_t> offsets;
+    std::vector<uint32_t> indices;
+    batch.groupByInstrument(offsets, indices);
+    ASSERT_TRUE(offsets.size() == 3, "One offset per symbol plus the end");
+    ASSERT_TRUE(indices.size() == 6, "Rows with an unknown instrument should be left out");
+    std::vector<uint32_t> aaplRows(indices.begin() + offsets[aapl], indices.begin() + offsets[aapl + 1]);
+    std::vector<uint32_t> msftRows(indices.begin() + offsets[msft], indices.begin() + offsets[msft + 1]);
+    ASSERT_TRUE((aaplRows == std::vector<uint32_t>{0, 2, 6}), "AAPL rows should keep batch order");
+    ASSERT_TRUE((msftRows == std::vector<uint32_t>{1, 3, 5}), "MSFT rows should keep batch order");
+
+    std::cout << "All order_batch_validate_group tests passed!" << std::endl;
+}
+
+// Test that the CSV parser, CSV stream and binary reader fill the columns directly
+TEST(order_batch_sources) {
+    std::vector<Order> orders = sampleOrders();
+    std::string csvFile = "test_order_batch.csv";
+    writeCsv(csvFile, orders);
+
+    CSVParser parser(csvFile);
+    OrderBatch parsed = parser.parseBatch();
+    ASSERT_TRUE(sameOrders(parsed, orders), "parseBatch should read every order");
+
+    OrderBatch rejected;
+    ParseReject reject;
+    ASSERT_TRUE(!CSVParser::parseRow("1,1,AAPL,HOLD,LIMIT,1,1,NEW", rejected, &reject), "Bad side should be rejected");
+    ASSERT_TRUE(reject.column == 4 && rejected.empty(), "Rejected rows should not be appended");
+
+    for (bool useMmap : {false, true}) {
+        CSVOrderStream stream(csvFile, useMmap);
+        OrderBatch batch;
+        std::vector<Order> streamed;
+        Order order;
+        while (stream.next(batch, 2) > 0) {
+            ASSERT_TRUE(batch.size() <= 2, "Batches should not exceed the requested size");
+            for (size_t i = 0; i < batch.size(); ++i) {
+                batch.toOrder(i, order);
+                streamed.push_back(order);
+            }
+        }
+        OrderBatch all;
+        for (const auto& o : streamed) {
+            all.append(o);
+        }
+        ASSERT_TRUE(sameOrders(all, orders), "Streamed batches should hold every order");
+    }
+
+    std::string binFile = "test_order_batch.bin";
+    BinaryOrderWriter writer(binFile);
+    for (const auto& order : orders) {
+        writer.writeOrder(order);
+    }
+    writer.close();
+
+    BinaryOrderReader reader(binFile);
+    OrderBatch batch;
+    batch.internSymbol("GOOGL"); // Batch ids need not match the file ids
+    ASSERT_TRUE(reader.next(batch, 100) == orders.size(), "All orders should be read in one batch");
+    ASSERT_TRUE(sameOrders(batch, orders), "Binary batch should hold every order");
+    ASSERT_TRUE(reader.next(batch, 100) == 0 && batch.empty(), "Exhausted reader should clear the batch");
+
+    std::remove(csvFile.c_str());
+    std::remove(binFile.c_str());
+
+    std::cout << "All order_batch_sources tests passed!" << std::endl;
+}
+
+// Test that the engine gives the same results for a columnar batch as order by order
+TEST(order_batch_engine) {
+    std::vector<Order> orders = sampleOrders();
+
+    MatchingEngine reference;
+    std::vector<OrderResult> expected;
+    std::vector<size_t> expectedEnds;
+    for (const auto& order : orders) {
+        auto results = reference.processOrder(order);
+        expected.insert(expected.end(), results.begin(), results.end());
+        expectedEnds.push_back(expected.size());
+    }
+
+    OrderBatch batch;
+    for (const auto& order : orders) {
+        batch.append(order);
+    }
+    uint32_t aapl = batch.internSymbol("AAPL");
+    batch.append(6, 6, aapl, Side::BUY, Type::LIMIT, -5, 1.0f, Action::NEW);
+
+    MatchingEngine engine;
+    std::vector<OrderResult> results;
+    std::vector<size_t> resultEnds;
+    size_t appended = engine.processBatch(batch, results, &resultEnds);
+
+    ASSERT_TRUE(appended == expected.size() + 1, "Batch should append one entry per result");
+    ASSERT_TRUE(resultEnds.size() == batch.size(), "One result end per order");
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_TRUE(results[i].order_id == expected[i].order_id, "Batch result order mismatch");
+        ASSERT_TRUE(results[i].status == expected[i].status, "Batch result status mismatch");
+        ASSERT_TRUE(results[i].instrument == expected[i].instrument, "Batch result instrument mismatch");
+        ASSERT_TRUE(results[i].executed_quantity == expected[i].executed_quantity, "Batch execution mismatch");
+    }
+    for (size_t i = 0; i < expectedEnds.size(); ++i) {
+        ASSERT_TRUE(resultEnds[i] == expectedEnds[i], "Result ends should delimit each order's results");
+    }
+    ASSERT_TRUE(results.back().order_id == 6 && results.back().status == OrderStatus::REJECTED,
+                "Invalid rows should be rejected");
+    ASSERT_TRUE(engine.getOrderBook("MSFT") != nullptr, "Books should be created for new instruments");
+
+    std::cout << "All order_batch_engine tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running OrderBatch tests..." << std::endl;
+
+    test_order_batch_columns();
+    test_order_batch_validate_group();
+    test_order_batch_sources();
+    test_order_batch_engine();
+
+    std::cout << "All OrderBatch tests passed successfully!" << std::endl;
+    return 0;
+}
@@ -1,6 +1,8 @@
 #include "../src/order_book.hpp"
 #include <iostream>
 #include <cassert>
+#include <memory_resource>
+#include <vector>
 
 // Simple test harness function
 #define TEST(name) void test_##name()
@@ -188,11 +190,127 @@ TEST(order_book_advanced) {
     std::cout << "All order_book_advanced tests passed!" << std::endl;
 }
 
+// Memory resource that counts the allocations routed through it
+class CountingResource : public std::pmr::memory_resource {
+public:
+    size_t allocations = 0;
+    size_t live_bytes = 0;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        ++allocations;
+        live_bytes += bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        live_bytes -= bytes;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+TEST(order_book_memory_resource) {
+    CountingResource resource;
+    {
+        OrderBook book("AAPL", &resource);
+        ASSERT_TRUE(book.getMemoryResource() == &resource, "Book should report its memory resource");
+        
+        for (int i = 1; i <= 10; ++i) {
+            Order order = {
+                .timestamp = static_cast<uint64_t>(i),
+                .order_id = i,
+                .instrument = "AAPL",
+                .side = i % 2 ? Side::BUY : Side::SELL,
+                .type = Type::LIMIT,
+                .quantity = 10,
+                .price = static_cast<float>(i % 2 ? 100 - i : 100 + i),
+                .action = Action::NEW
+            };
+            book.addOrder(order);
+        }
+        ASSERT_TRUE(resource.allocations > 0, "Book containers should allocate from the given resource");
+        ASSERT_TRUE(book.getBuySide().size() == 5, "Should have 5 buy levels");
+        
+        size_t before = resource.allocations;
+        book.cancelOrder(1);
+        ASSERT_TRUE(book.getBuySide().size() == 4, "Should have 4 buy levels after cancel");
+        ASSERT_TRUE(resource.allocations == before, "Cancel should not allocate");
+    }
+    ASSERT_TRUE(resource.live_bytes == 0, "All memory should be returned to the resource");
+    
+    // A monotonic arena can back a whole book and be released in one shot
+    std::pmr::monotonic_buffer_resource arena(64 * 1024);
+    OrderBook arenaBook("MSFT", &arena);
+    Order order = {
+        .timestamp = 1,
+        .order_id = 1,
+        .instrument = "MSFT",
+        .side = Side::BUY,
+        .type = Type::LIMIT,
+        .quantity = 10,
+        .price = 260.0,
+        .action = Action::NEW
+    };
+    arenaBook.addOrder(order);
+    ASSERT_TRUE(arenaBook.getBuySide().at(260.0).front().order_id == 1, "Arena book should hold the order");
+    
+    std::cout << "All order_book_memory_resource tests passed!" << std::endl;
+}
+
+TEST(order_book_level_deltas) {
+    OrderBook book("AAPL");
+    auto makeOrder = [](int id, Side side, int quantity, float price) {
+        return Order{static_cast<uint64_t>(id), id, "AAPL", side, Type::LIMIT, quantity, price, Action::NEW};
+    };
+    
+    // Nothing is recorded until tracking is enabled
+    book.addOrder(makeOrder(1, Side::BUY, 10, 100.0f));
+    std::vector<LevelDelta> deltas;
+    ASSERT_TRUE(book.levelDeltas(deltas) == 0, "No level should be recorded without tracking");
+    
+    book.setLevelTracking(true);
+    book.addOrder(makeOrder(2, Side::BUY, 5, 100.0f));
+    book.addOrder(makeOrder(3, Side::SELL, 7, 101.0f));
+    book.addOrder(makeOrder(4, Side::BUY, 3, 100.0f));
+    ASSERT_TRUE(book.levelDeltas(deltas) == 2, "Each changed level should be listed once");
+    ASSERT_TRUE(deltas[0].side == Side::BUY && deltas[0].price == 100.0, "First change should be the bid level");
+    ASSERT_TRUE(deltas[0].quantity == 18 && deltas[0].count == 3, "Bid level should aggregate all its orders");
+    ASSERT_TRUE(deltas[1].side == Side::SELL && deltas[1].quantity == 7 && deltas[1].count == 1,
+                "Ask level should hold one order");
+    
+    // A modify changes both the old and the new level; a removed level reports zeros
+    book.clearLevelChanges();
+    deltas.clear();
+    Order moved = makeOrder(3, Side::SELL, 7, 102.0f);
+    moved.action = Action::MODIFY;
+    ASSERT_TRUE(book.modifyOrder(moved), "Modify should succeed");
+    book.levelDeltas(deltas);
+    ASSERT_TRUE(deltas.size() == 2, "Modify should change two levels");
+    ASSERT_TRUE(deltas[0].price == 101.0 && deltas[0].quantity == 0 && deltas[0].count == 0,
+                "Old level should be reported empty");
+    ASSERT_TRUE(deltas[1].price == 102.0 && deltas[1].quantity == 7, "New level should hold the order");
+    
+    // Failed operations and disabling record nothing
+    book.clearLevelChanges();
+    deltas.clear();
+    ASSERT_TRUE(!book.cancelOrder(99), "Unknown order should not cancel");
+    ASSERT_TRUE(book.levelDeltas(deltas) == 0, "Failed cancel should change no level");
+    book.cancelOrder(2);
+    book.setLevelTracking(false);
+    ASSERT_TRUE(book.levelDeltas(deltas) == 0, "Disabling should clear the recorded levels");
+    
+    std::cout << "All order_book_level_deltas tests passed!" << std::endl;
+}
+
 // Main function that runs all tests
 int main() {
     std::cout << "Running OrderBook tests..." << std::endl;
     test_order_book_basic();
     test_order_book_advanced();
+    test_order_book_memory_resource();
+    test_order_book_level_deltas();
     std::cout << "All tests passed!" << std::endl;
     return 0;
 }
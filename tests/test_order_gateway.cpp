@@ -0,0 +1,153 @@
+#include "../src/order_gateway.hpp"
+#include "../src/gateway_client.hpp"
+#include <iostream>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+// Simple test harness function
+#define TEST(name) void test_##name()
+
+// Assertion with message
+#define ASSERT_TRUE(condition, message) \
+    if (!(condition)) { \
+        std::cerr << "Assertion failed: " << message << std::endl; \
+        exit(1); \
+    }
+
+// Receive until at least count reports have arrived or the connection is closed
+std::vector<ExecutionReport> receiveReports(GatewayClient& client, size_t count) {
+    std::vector<ExecutionReport> reports;
+    while (reports.size() < count && client.receive(reports) > 0) {
+    }
+    return reports;
+}
+
+Order limitOrder(int id, Side side, int quantity, float price, Action action = Action::NEW) {
+    return Order{1000 + static_cast<uint64_t>(id), id, "AAPL", side, Type::LIMIT, quantity, price, action};
+}
+
+// Test the encoding and decoding of messages
+TEST(protocol) {
+    Order order = limitOrder(7, Side::SELL, 15, 101.5f);
+    OrderMessage message;
+    ASSERT_TRUE(encodeOrder(order, message), "Order should encode");
+    ASSERT_TRUE(message.header.length == sizeof(OrderMessage), "Length should cover the whole message");
+    ASSERT_TRUE(message.header.type == static_cast<uint8_t>(MessageType::ORDER), "Type should be ORDER");
+
+    Order decoded;
+    ASSERT_TRUE(decodeOrder(message, decoded), "Message should decode");
+    ASSERT_TRUE(decoded.order_id == 7 && decoded.instrument == "AAPL" && decoded.side == Side::SELL,
+                "Decoded order should match");
+    ASSERT_TRUE(decoded.quantity == 15 && decoded.price == 101.5f && decoded.timestamp == 1007,
+                "Decoded quantities should match");
+
+    message.side = 9;
+    ASSERT_TRUE(!decodeOrder(message, decoded), "Unknown side should be refused");
+
+    Order longSymbol = order;
+    longSymbol.instrument = "AN_INSTRUMENT_NAME_TOO_LONG";
+    ASSERT_TRUE(!encodeOrder(longSymbol, message), "Long symbols should be refused");
+
+    std::cout << "All protocol tests passed!" << std::endl;
+}
+
+// Test ACKs to the sender and FILLs to the owner of the resting order
+TEST(gateway_round_trip) {
+    MatchingEngine engine;
+    GatewayOptions options;
+    options.port = 0;
+    OrderGateway gateway(engine, options);
+    ASSERT_TRUE(gateway.start(), "Gateway should start");
+    ASSERT_TRUE(gateway.port() != 0, "Kernel should pick a port");
+    std::thread network([&]() { gateway.run(); });
+
+    GatewayClient seller;
+    GatewayClient buyer;
+    ASSERT_TRUE(seller.connect(gateway.port()), "Seller should connect");
+    ASSERT_TRUE(buyer.connect(gateway.port()), "Buyer should connect");
+
+    ASSERT_TRUE(seller.sendOrders({limitOrder(1, Side::SELL, 10, 100.0f), limitOrder(2, Side::SELL, 5, 102.0f)}),
+                "Seller should send");
+    std::vector<ExecutionReport> reports = receiveReports(seller, 2);
+    ASSERT_TRUE(reports.size() == 2, "Seller should get two ACKs");
+    ASSERT_TRUE(reports[0].header.type == static_cast<uint8_t>(MessageType::ACK) && reports[0].order_id == 1,
+                "First ACK should be for order 1");
+    ASSERT_TRUE(reports[0].status == static_cast<uint8_t>(OrderStatus::PENDING), "Order 1 should rest");
+    ASSERT_TRUE(reports[1].order_id == 2, "ACKs should come back in order");
+
+    ASSERT_TRUE(buyer.sendOrders({limitOrder(3, Side::BUY, 10, 101.0f)}), "Buyer should send");
+    reports = receiveReports(buyer, 1);
+    ASSERT_TRUE(reports.size() == 1, "Buyer should get one ACK");
+    ASSERT_TRUE(reports[0].header.type == static_cast<uint8_t>(MessageType::ACK), "Buyer report should be an ACK");
+    ASSERT_TRUE(reports[0].status == static_cast<uint8_t>(OrderStatus::EXECUTED), "Buy should execute");
+    ASSERT_TRUE(reports[0].executed_quantity == 10 && reports[0].counterparty_id == 1, "Buy should fill against order 1");
+
+    reports = receiveReports(seller, 1);
+    ASSERT_TRUE(reports.size() == 1, "Seller should get one FILL");
+    ASSERT_TRUE(reports[0].header.type == static_cast<uint8_t>(MessageType::FILL), "Seller report should be a FILL");
+    ASSERT_TRUE(reports[0].order_id == 1 && reports[0].executed_quantity == 10, "FILL should be for order 1");
+    ASSERT_TRUE(reports[0].status == static_cast<uint8_t>(OrderStatus::EXECUTED), "Order 1 should be executed");
+
+    ASSERT_TRUE(seller.sendOrders({limitOrder(2, Side::SELL, 5, 102.0f, Action::CANCEL)}), "Cancel should send");
+    reports = receiveReports(seller, 1);
+    ASSERT_TRUE(reports.size() == 1 && reports[0].status == static_cast<uint8_t>(OrderStatus::CANCELED),
+                "Cancel should be acknowledged");
+
+    gateway.stop();
+    network.join();
+    const GatewayStats& stats = gateway.stats();
+    ASSERT_TRUE(stats.sessions == 2, "Two sessions should be accepted");
+    ASSERT_TRUE(stats.messages == 4, "Four orders should be received");
+    ASSERT_TRUE(stats.reports == 5, "Five reports should be queued");
+    ASSERT_TRUE(stats.protocolErrors == 0, "No protocol error should occur");
+
+    std::cout << "All gateway_round_trip tests passed!" << std::endl;
+}
+
+// Test that a malformed message closes only the offending session
+TEST(gateway_malformed_message) {
+    MatchingEngine engine;
+    GatewayOptions options;
+    options.port = 0;
+    OrderGateway gateway(engine, options);
+    ASSERT_TRUE(gateway.start(), "Gateway should start");
+    std::thread network([&]() { gateway.run(); });
+
+    GatewayClient bad;
+    GatewayClient good;
+    ASSERT_TRUE(bad.connect(gateway.port()), "Client should connect");
+    ASSERT_TRUE(good.connect(gateway.port()), "Client should connect");
+
+    MessageHeader header{1000, static_cast<uint8_t>(MessageType::ORDER), 0};
+    ASSERT_TRUE(bad.sendRaw(&header, sizeof(header)), "Raw bytes should send");
+    std::vector<ExecutionReport> reports = receiveReports(bad, 1);
+    ASSERT_TRUE(reports.empty() && !bad.isOpen(), "Gateway should close the session");
+
+    // Messages split across writes are reassembled
+    OrderMessage message;
+    encodeOrder(limitOrder(1, Side::BUY, 3, 99.0f), message);
+    const char* bytes = reinterpret_cast<const char*>(&message);
+    ASSERT_TRUE(good.sendRaw(bytes, 10), "First part should send");
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    ASSERT_TRUE(good.sendRaw(bytes + 10, sizeof(message) - 10), "Second part should send");
+    reports = receiveReports(good, 1);
+    ASSERT_TRUE(reports.size() == 1 && reports[0].order_id == 1, "Split message should be acknowledged");
+
+    gateway.stop();
+    network.join();
+    ASSERT_TRUE(gateway.stats().protocolErrors == 1, "One protocol error should be counted");
+
+    std::cout << "All gateway_malformed_message tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running OrderGateway tests..." << std::endl;
+
+    test_protocol();
+    test_gateway_round_trip();
+    test_gateway_malformed_message();
+
+    std::cout << "All OrderGateway tests passed successfully!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,126 @@
+#include "../src/output_file.hpp"
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+
+// Simple test harness function
+#define TEST(name) void test_##name()
+
+// Assertion with message
+#define ASSERT_TRUE(condition, message) \
+    if (!(condition)) { \
+        std::cerr << "Assertion failed: " << message << std::endl; \
+        exit(1); \
+    }
+
+std::string readFile(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+// Write pieces of random sizes and check that the file holds exactly the same bytes
+void writeAndCompare(const OutputOptions& options, const std::string& label) {
+    std::string filename = "test_output_file.bin";
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> size_dist(1, 9000);
+    std::uniform_int_distribution<int> byte_dist('a', 'z');
+
+    std::string expected;
+    {
+        OutputFile file(filename, options);
+        ASSERT_TRUE(file.isOpen(), label << ": file should be opened");
+        for (int i = 0; i < 200; ++i) {
+            std::string piece(size_dist(gen), static_cast<char>(byte_dist(gen)));
+            ASSERT_TRUE(file.write(piece.data(), piece.size()), label << ": write should succeed");
+            expected += piece;
+            if (i == 100) {
+                ASSERT_TRUE(file.flush(), label << ": flush should succeed");
+                if (!file.usesDirectIo()) {
+                    ASSERT_TRUE(readFile(filename) == expected, label << ": flush should write everything");
+                }
+            }
+        }
+        ASSERT_TRUE(file.size() == expected.size(), label << ": size should count every byte");
+        std::string header = "HEADER";
+        expected.replace(0, header.size(), header);
+        ASSERT_TRUE(file.close(header.data(), header.size()), label << ": close should succeed");
+    }
+    ASSERT_TRUE(readFile(filename) == expected, label << ": file content should match");
+    std::remove(filename.c_str());
+}
+
+// Test the io_uring backend, with and without registered buffers
+TEST(output_file_io_uring) {
+    OutputOptions options;
+    options.bufferSize = 16384;
+    writeAndCompare(options, "io_uring");
+
+    options.registerBuffers = false;
+    writeAndCompare(options, "io_uring without registered buffers");
+
+    OutputFile probe("test_output_probe.bin", options);
+    std::cout << "io_uring " << (probe.usesIoUring() ? "available" : "unavailable, pwrite fallback tested") << std::endl;
+    probe.close();
+    std::remove("test_output_probe.bin");
+
+    std::cout << "All output_file_io_uring tests passed!" << std::endl;
+}
+
+// Test the pwrite fallback
+TEST(output_file_pwrite) {
+    OutputOptions options;
+    options.useIoUring = false;
+    options.bufferSize = 16384;
+    writeAndCompare(options, "pwrite");
+
+    options.queueDepth = 1;
+    writeAndCompare(options, "pwrite with a single buffer");
+
+    OutputFile file("test_output_probe.bin", options);
+    ASSERT_TRUE(!file.usesIoUring(), "io_uring should not be used when disabled");
+    file.close();
+    std::remove("test_output_probe.bin");
+
+    std::cout << "All output_file_pwrite tests passed!" << std::endl;
+}
+
+// Test O_DIRECT output, including the unaligned tail
+TEST(output_file_direct) {
+    OutputOptions options;
+    options.directIo = true;
+    options.bufferSize = 16384;
+    writeAndCompare(options, "O_DIRECT");
+
+    options.useIoUring = false;
+    writeAndCompare(options, "O_DIRECT with pwrite");
+
+    std::cout << "All output_file_direct tests passed!" << std::endl;
+}
+
+// Test error handling for an unwritable path
+TEST(output_file_error) {
+    OutputFile file("/invalid/path/file.bin");
+    ASSERT_TRUE(!file.isOpen(), "File should not be opened");
+    ASSERT_TRUE(!file.write("abc", 3), "Write to a closed file should fail");
+    ASSERT_TRUE(!file.flush(), "Flush of a closed file should fail");
+
+    std::cout << "All output_file_error tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running OutputFile tests..." << std::endl;
+
+    test_output_file_io_uring();
+    test_output_file_pwrite();
+    test_output_file_direct();
+    test_output_file_error();
+
+    std::cout << "All OutputFile tests passed successfully!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,185 @@
+#include "../src/pipeline.hpp"
+#include <iostream>
+#include <cassert>
+#include <random>
+#include <thread>
+#include <vector>
+
+// Simple test harness function
+#define TEST(name) void test_##name()
+
+// Assertion with message
+#define ASSERT_TRUE(condition, message) \
+    if (!(condition)) { \
+        std::cerr << "Assertion failed: " << message << std::endl; \
+        exit(1); \
+    }
+
+// Order source backed by a vector
+class VectorSource : public OrderSource {
+public:
+    explicit VectorSource(const std::vector<Order>& orders) : orders_(orders) {}
+
+    size_t next(std::vector<Order>& batch, size_t maxOrders) override {
+        size_t n = std::min(maxOrders, orders_.size() - position_);
+        batch.assign(orders_.begin() + position_, orders_.begin() + position_ + n);
+        position_ += n;
+        return n;
+    }
+
+    void rewind() { position_ = 0; }
+
+private:
+    const std::vector<Order>& orders_;
+    size_t position_ = 0;
+};
+
+// Result writer recording what it receives
+class RecordingWriter : public ResultWriter {
+public:
+    void writeOrderResult(const OrderResult& result) override { results.push_back(result); }
+    void flush() override { ++flushes; }
+
+    std::vector<OrderResult> results;
+    int flushes = 0;
+};
+
+std::vector<Order> randomOrders(size_t count) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<> price_dist(95, 105);
+    std::uniform_int_distribution<> qty_dist(1, 100);
+    std::uniform_int_distribution<> coin(0, 1);
+    const char* instruments[] = {"AAPL", "MSFT", "GOOG"};
+
+    std::vector<Order> orders;
+    for (size_t i = 0; i < count; ++i) {
+        Order order{1000 + i, static_cast<int>(i + 1), instruments[i % 3],
+                    coin(gen) ? Side::BUY : Side::SELL, Type::LIMIT,
+                    qty_dist(gen), static_cast<float>(price_dist(gen)), Action::NEW};
+        orders.push_back(order);
+    }
+    return orders;
+}
+
+// Test that the queue keeps FIFO order between two threads and reports full/empty
+TEST(spsc_queue) {
+    SPSCQueue<int> queue(3);
+    ASSERT_TRUE(queue.capacity() == 4, "Capacity should be rounded up to a power of two");
+    int value;
+    ASSERT_TRUE(!queue.tryPop(value), "New queue should be empty");
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue.tryPush(i), "Push should succeed until the queue is full");
+    }
+    ASSERT_TRUE(!queue.tryPush(4), "Push to a full queue should fail");
+    ASSERT_TRUE(queue.size() == 4, "Size should be 4");
+    ASSERT_TRUE(queue.tryPop(value) && value == 0, "Pop should return the oldest element");
+
+    SPSCQueue<int> shared(64);
+    const int count = 100000;
+    std::thread producer([&shared] {
+        for (int i = 0; i < count; ++i) {
+            while (!shared.tryPush(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    for (int expected = 0; expected < count; ++expected) {
+        while (!shared.tryPop(value)) {
+            std::this_thread::yield();
+        }
+        ASSERT_TRUE(value == expected, "Elements should arrive in order");
+    }
+    producer.join();
+
+    std::cout << "All spsc_queue tests passed!" << std::endl;
+}
+
+// Test that the pipeline produces the same results as sequential matching
+TEST(pipeline_matches_sequential) {
+    std::vector<Order> orders = randomOrders(5000);
+
+    MatchingEngine sequential;
+    std::vector<OrderResult> expected;
+    for (const auto& order : orders) {
+        std::vector<OrderResult> results = sequential.processOrder(order);
+        expected.insert(expected.end(), results.begin(), results.end());
+    }
+
+    MatchingEngine engine;
+    VectorSource source(orders);
+    RecordingWriter writer;
+    Pipeline pipeline(source, engine, writer, 64, 4);
+    size_t callbacks = 0;
+    std::thread::id callbackThread;
+    pipeline.setOrderCallback([&](const Order&, const std::vector<OrderResult>&) {
+        ++callbacks;
+        callbackThread = std::this_thread::get_id();
+    });
+    pipeline.run();
+
+    ASSERT_TRUE(callbacks == orders.size(), "Callback should run once per order");
+    ASSERT_TRUE(writer.flushes == 1, "Writer should be flushed once at the end");
+    ASSERT_TRUE(writer.results.size() == expected.size(), "Result count should match sequential matching");
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_TRUE(writer.results[i].order_id == expected[i].order_id
+                    && writer.results[i].status == expected[i].status
+                    && writer.results[i].executed_quantity == expected[i].executed_quantity
+                    && writer.results[i].counterparty_id == expected[i].counterparty_id,
+                    "Result " << i << " should match sequential matching");
+    }
+
+    const PipelineStats& stats = pipeline.stats();
+    ASSERT_TRUE(stats.parse.items == orders.size(), "Parser should count every order");
+    ASSERT_TRUE(stats.match.items == orders.size(), "Matcher should count every order");
+    ASSERT_TRUE(stats.write.items == expected.size(), "Writer should count every result");
+    ASSERT_TRUE(stats.orderQueue.samples == orders.size() / 64 + 2, "Matcher should sample the queue at each pop");
+    ASSERT_TRUE(stats.match.utilization() > 0.0 && stats.match.utilization() <= 1.0, "Utilization should be a fraction");
+    ASSERT_TRUE(stats.orderQueue.maxOccupancy <= stats.orderQueue.capacity, "Occupancy should not exceed capacity");
+
+    std::cout << "All pipeline_matches_sequential tests passed!" << std::endl;
+}
+
+// Test an empty source
+TEST(pipeline_empty) {
+    std::vector<Order> orders;
+    MatchingEngine engine;
+    VectorSource source(orders);
+    RecordingWriter writer;
+    Pipeline pipeline(source, engine, writer);
+    pipeline.run();
+
+    ASSERT_TRUE(writer.results.empty(), "No results should be written");
+    ASSERT_TRUE(pipeline.stats().match.items == 0, "No order should be matched");
+
+    std::cout << "All pipeline_empty tests passed!" << std::endl;
+}
+
+// Test that repeated runs keep every batch in rotation
+TEST(pipeline_repeated_runs) {
+    std::vector<Order> orders = randomOrders(300);
+    MatchingEngine engine;
+    VectorSource source(orders);
+    RecordingWriter writer;
+    // Two order batches: a run that lost one would leave the next ones without any
+    Pipeline pipeline(source, engine, writer, 64, 1);
+    for (int run = 0; run < 5; ++run) {
+        source.rewind();
+        pipeline.run();
+        ASSERT_TRUE(pipeline.stats().match.items == orders.size(), "Run " << run << " should match every order");
+    }
+    ASSERT_TRUE(writer.flushes == 5, "Writer should be flushed once per run");
+
+    std::cout << "All pipeline_repeated_runs tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running Pipeline tests..." << std::endl;
+
+    test_spsc_queue();
+    test_pipeline_matches_sequential();
+    test_pipeline_empty();
+    test_pipeline_repeated_runs();
+
+    std::cout << "All Pipeline tests passed successfully!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,89 @@
+#include "../src/replay_pacer.hpp"
+#include "../src/latency_stats.hpp"
+#include <iostream>
+#include <vector>
+
+// Simple test harness function
+#define TEST(name) void test_##name()
+
+// Assertion with message
+#define ASSERT_TRUE(condition, message) \
+    if (!(condition)) { \
+        std::cerr << "Assertion failed: " << message << std::endl; \
+        exit(1); \
+    }
+
+using namespace std::chrono;
+
+// Test due times at real time and at ten times the speed
+TEST(due_times_follow_timestamp_gaps) {
+    ReplayPacer::Clock::time_point start{};
+    ReplayPacer realTime(1.0);
+    realTime.start(1000, start);
+    ASSERT_TRUE(realTime.due(1000) == start, "First order should be due at the start");
+    ASSERT_TRUE(realTime.due(1000 + 5000000) == start + milliseconds(5), "Gap should be kept at 1x");
+
+    ReplayPacer fast(10.0);
+    fast.start(1000, start);
+    ASSERT_TRUE(fast.due(1000 + 5000000) == start + microseconds(500), "Gap should be divided at 10x");
+
+    // Out-of-order timestamps before the first one are due immediately
+    ASSERT_TRUE(fast.due(10) == start, "Earlier timestamp should be due at the start");
+
+    std::cout << "Due time tests passed!" << std::endl;
+}
+
+// Test that an unpaced replay never waits
+TEST(unpaced_replay) {
+    ReplayPacer pacer(0.0);
+    ASSERT_TRUE(pacer.unpaced(), "Speed 0 should be unpaced");
+    auto start = ReplayPacer::Clock::now();
+    pacer.start(0, start);
+    ASSERT_TRUE(pacer.due(3000000000ULL) == start, "Every order should be due at the start");
+    pacer.wait(3000000000ULL);
+    ASSERT_TRUE(ReplayPacer::Clock::now() - start < seconds(1), "Unpaced wait should return at once");
+
+    std::cout << "Unpaced replay tests passed!" << std::endl;
+}
+
+// Test that wait() returns no earlier than the due time
+TEST(wait_until_due) {
+    ReplayPacer pacer(1.0);
+    auto start = ReplayPacer::Clock::now();
+    pacer.start(0, start);
+    auto due = pacer.wait(2000000);
+    ASSERT_TRUE(due == start + milliseconds(2), "Wait should return the due time");
+    ASSERT_TRUE(ReplayPacer::Clock::now() >= due, "Wait should not return early");
+
+    std::cout << "Wait tests passed!" << std::endl;
+}
+
+// Test nearest-rank percentiles of a latency summary
+TEST(latency_summary) {
+    std::vector<double> samples;
+    for (int i = 100; i >= 1; --i) {
+        samples.push_back(i);
+    }
+    LatencySummary summary = summarizeLatencies(samples);
+    ASSERT_TRUE(summary.count == 100, "Count should be 100");
+    ASSERT_TRUE(summary.mean == 50.5, "Mean should be 50.5");
+    ASSERT_TRUE(summary.p50 == 50 && summary.p90 == 90 && summary.p99 == 99, "Percentiles should use nearest rank");
+    ASSERT_TRUE(summary.p999 == 100 && summary.max == 100, "Tail should be the largest sample");
+
+    std::vector<double> empty;
+    ASSERT_TRUE(summarizeLatencies(empty).count == 0, "No samples should give an empty summary");
+
+    std::cout << "Latency summary tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running replay pacer tests..." << std::endl;
+
+    test_due_times_follow_timestamp_gaps();
+    test_unpaced_replay();
+    test_wait_until_due();
+    test_latency_summary();
+
+    std::cout << "All replay pacer tests passed successfully!" << std::endl;
+    return 0;
+}
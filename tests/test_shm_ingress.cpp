@@ -0,0 +1,222 @@
+#include "../src/shm_ingress.hpp"
+#include "../src/shm_ingress_client.hpp"
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+// Simple test harness function
+#define TEST(name) void test_##name()
+
+// Assertion with message
+#define ASSERT_TRUE(condition, message) \
+    if (!(condition)) { \
+        std::cerr << "Assertion failed: " << message << std::endl; \
+        exit(1); \
+    }
+
+std::string ingressName(const char* suffix) {
+    return "/test_ingress_" + std::to_string(getpid()) + "_" + suffix;
+}
+
+Order limitOrder(int id, Side side, int quantity, float price, Action action = Action::NEW) {
+    return Order{1000 + static_cast<uint64_t>(id), id, "AAPL", side, Type::LIMIT, quantity, price, action};
+}
+
+// Test ACKs to the submitting producer and FILLs to the owner of the resting order
+TEST(ingress_round_trip) {
+    std::string name = ingressName("round_trip");
+    MatchingEngine engine;
+    ShmIngressServer server(name, engine);
+    ASSERT_TRUE(server.isOpen(), "Server should create the object");
+
+    ShmIngressClient seller(name);
+    ShmIngressClient buyer(name);
+    ASSERT_TRUE(seller.isOpen() && buyer.isOpen(), "Clients should attach");
+    ASSERT_TRUE(seller.producer() != buyer.producer(), "Clients should get different slots");
+
+    ASSERT_TRUE(seller.submit(limitOrder(1, Side::SELL, 10, 100.0f)), "Seller should submit");
+    ASSERT_TRUE(server.poll() == 1, "Server should process one request");
+    std::vector<ExecutionReport> reports;
+    ASSERT_TRUE(seller.receive(reports) == 1, "Seller should get an ACK");
+    ASSERT_TRUE(reports[0].header.type == static_cast<uint8_t>(MessageType::ACK)
+                && reports[0].status == static_cast<uint8_t>(OrderStatus::PENDING), "Sell should rest");
+
+    ASSERT_TRUE(buyer.submit(limitOrder(2, Side::BUY, 10, 100.0f)), "Buyer should submit");
+    server.poll();
+    reports.clear();
+    ASSERT_TRUE(buyer.receive(reports) == 1, "Buyer should get an ACK");
+    ASSERT_TRUE(reports[0].status == static_cast<uint8_t>(OrderStatus::EXECUTED)
+                && reports[0].counterparty_id == 1, "Buy should execute against order 1");
+    reports.clear();
+    ASSERT_TRUE(seller.receive(reports) == 1, "Seller should get a FILL");
+    ASSERT_TRUE(reports[0].header.type == static_cast<uint8_t>(MessageType::FILL) && reports[0].order_id == 1,
+                "FILL should be for order 1");
+
+    // Unknown enum values are answered with a REJECTED ACK
+    Order bad = limitOrder(3, Side::BUY, 1, 100.0f);
+    bad.action = static_cast<Action>(9);
+    seller.submit(bad);
+    server.poll();
+    reports.clear();
+    ASSERT_TRUE(seller.receive(reports) == 1 && reports[0].status == static_cast<uint8_t>(OrderStatus::REJECTED),
+                "Malformed order should be rejected");
+
+    ASSERT_TRUE(server.stats().requests == 3 && server.stats().reports == 4, "Counters should match");
+
+    std::cout << "All ingress_round_trip tests passed!" << std::endl;
+}
+
+// Test the limits: full request ring, full response ring, no free slot
+TEST(ingress_limits) {
+    std::string name = ingressName("limits");
+    MatchingEngine engine;
+    ShmIngressOptions options;
+    options.maxProducers = 1;
+    options.requestSlots = 4;
+    options.responseSlots = 2;
+    ShmIngressServer server(name, engine, options);
+
+    ShmIngressClient client(name);
+    ASSERT_TRUE(client.isOpen(), "Client should attach");
+    ShmIngressClient extra(name);
+    ASSERT_TRUE(!extra.isOpen(), "No slot should be left");
+
+    for (int id = 1; id <= 4; ++id) {
+        ASSERT_TRUE(client.trySubmit(limitOrder(id, Side::BUY, 1, 90.0f + id)), "Ring should accept four orders");
+    }
+    ASSERT_TRUE(!client.trySubmit(limitOrder(5, Side::BUY, 1, 95.0f)), "Full ring should refuse an order");
+
+    ASSERT_TRUE(server.poll() == 4, "Server should drain the ring");
+    ASSERT_TRUE(server.stats().droppedReports == 2, "Two ACKs should not fit in the response ring");
+    ASSERT_TRUE(client.droppedReports() == 2, "Client should see its dropped reports");
+    std::vector<ExecutionReport> reports;
+    ASSERT_TRUE(client.receive(reports) == 2, "Two ACKs should be delivered");
+    ASSERT_TRUE(client.trySubmit(limitOrder(5, Side::BUY, 1, 95.0f)), "Ring should accept again after a lap");
+
+    std::cout << "All ingress_limits tests passed!" << std::endl;
+}
+
+// Test that a reused slot does not receive the FILLs of its previous owner
+TEST(ingress_slot_reuse) {
+    std::string name = ingressName("reuse");
+    MatchingEngine engine;
+    ShmIngressOptions options;
+    options.maxProducers = 2;
+    ShmIngressServer server(name, engine, options);
+
+    ShmIngressClient buyer(name);
+    {
+        ShmIngressClient seller(name);
+        seller.submit(limitOrder(1, Side::SELL, 10, 100.0f));
+        server.poll();
+    }
+    ShmIngressClient successor(name);
+    ASSERT_TRUE(successor.isOpen(), "Freed slot should be claimed again");
+    buyer.submit(limitOrder(2, Side::BUY, 10, 100.0f));
+    server.poll();
+
+    std::vector<ExecutionReport> reports;
+    ASSERT_TRUE(successor.receive(reports) == 0, "Successor should not get the previous owner's FILL");
+    ASSERT_TRUE(server.stats().orphanReports == 1, "The FILL should be counted as orphaned");
+
+    std::cout << "All ingress_slot_reuse tests passed!" << std::endl;
+}
+
+// Test that reclaiming a slot while the engine still sends reports to the previous owner
+// never delivers those reports to the new owner
+TEST(ingress_reclaim_in_flight) {
+    std::string name = ingressName("reclaim");
+    MatchingEngine engine;
+    ShmIngressOptions options;
+    options.maxProducers = 1;
+    options.requestSlots = 64;
+    options.responseSlots = 64;
+    ShmIngressServer server(name, engine, options);
+    std::thread engineThread([&]() { server.run(); });
+
+    int nextId = 1;
+    for (int round = 0; round < 200; ++round) {
+        {
+            // The previous owner leaves without reading, with requests still queued
+            ShmIngressClient previous(name);
+            ASSERT_TRUE(previous.isOpen(), "Previous owner should attach");
+            for (int i = 0; i < 20; ++i) {
+                previous.submit(limitOrder(nextId++, Side::BUY, 1, 90.0f));
+            }
+        }
+        ShmIngressClient current(name);
+        ASSERT_TRUE(current.isOpen(), "Slot should be claimed again");
+        int id = nextId++;
+        current.submit(limitOrder(id, Side::SELL, 1, 110.0f));
+        std::vector<ExecutionReport> reports;
+        while (reports.empty()) {
+            current.receive(reports);
+            std::this_thread::yield();
+        }
+        current.receive(reports);
+        ASSERT_TRUE(reports.size() == 1 && reports[0].order_id == id,
+                    "New owner should only get the ACK of its own order");
+    }
+    server.stop();
+    engineThread.join();
+
+    std::cout << "All ingress_reclaim_in_flight tests passed!" << std::endl;
+}
+
+// Test concurrent producers against a running server
+TEST(ingress_concurrent_producers) {
+    std::string name = ingressName("concurrent");
+    MatchingEngine engine;
+    ShmIngressOptions options;
+    options.requestSlots = 64;
+    ShmIngressServer server(name, engine, options);
+    std::thread engineThread([&]() { server.run(); });
+
+    const int producers = 4;
+    const int perProducer = 2000;
+    std::vector<std::thread> threads;
+    std::vector<size_t> acks(producers, 0);
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p]() {
+            ShmIngressClient client(name);
+            std::vector<ExecutionReport> reports;
+            for (int i = 0; i < perProducer; ++i) {
+                int id = p * perProducer + i + 1;
+                client.submit(limitOrder(id, p % 2 ? Side::BUY : Side::SELL, 1, p % 2 ? 90.0f : 110.0f));
+                client.receive(reports);
+            }
+            while (reports.size() < static_cast<size_t>(perProducer)) {
+                client.receive(reports);
+                std::this_thread::yield();
+            }
+            acks[p] = reports.size();
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    server.stop();
+    engineThread.join();
+
+    for (int p = 0; p < producers; ++p) {
+        ASSERT_TRUE(acks[p] == static_cast<size_t>(perProducer), "Every order should be acknowledged once");
+    }
+    ASSERT_TRUE(server.stats().requests == producers * perProducer, "Every request should be processed");
+
+    std::cout << "All ingress_concurrent_producers tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running ShmIngress tests..." << std::endl;
+
+    test_ingress_round_trip();
+    test_ingress_limits();
+    test_ingress_slot_reuse();
+    test_ingress_reclaim_in_flight();
+    test_ingress_concurrent_producers();
+
+    std::cout << "All ShmIngress tests passed successfully!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,158 @@
+#include "../src/snapshot.hpp"
+#include "../src/csv_parser.hpp"
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+#include <vector>
+
+// Simple test harness function
+#define TEST(name) void test_##name()
+
+// Assertion with message
+#define ASSERT_TRUE(condition, message) \
+    if (!(condition)) { \
+        std::cerr << "Assertion failed: " << message << std::endl; \
+        exit(1); \
+    }
+
+// Build an engine with a few resting orders on both sides
+void populateEngine(MatchingEngine& engine) {
+    engine.processOrder({1000, 1, "AAPL", Side::BUY, Type::LIMIT, 100, 150.0f, Action::NEW});
+    engine.processOrder({1001, 2, "AAPL", Side::BUY, Type::LIMIT, 50, 151.0f, Action::NEW});
+    engine.processOrder({1002, 3, "AAPL", Side::SELL, Type::LIMIT, 70, 155.5f, Action::NEW});
+    engine.processOrder({1003, 4, "MSFT", Side::SELL, Type::LIMIT, 30, 260.25f, Action::NEW});
+}
+
+// Test that a snapshot can be reloaded and contains every resting order
+TEST(snapshot_roundtrip) {
+    MatchingEngine engine;
+    populateEngine(engine);
+
+    std::string filename = "test_snapshot.csv";
+    SnapshotManager snapshots;
+    ASSERT_TRUE(snapshots.begin(engine, filename), "Snapshot should start");
+    ASSERT_TRUE(snapshots.wait(), "Snapshot should be written");
+    ASSERT_TRUE(snapshots.completedCount() == 1, "One snapshot should be completed");
+    ASSERT_TRUE(snapshots.lastPause().count() > 0, "Pause time should be reported");
+
+    CSVParser parser(filename);
+    std::vector<Order> orders = parser.parse();
+    ASSERT_TRUE(orders.size() == 4, "Snapshot should contain 4 resting orders");
+
+    // Rebuild an engine from the snapshot and compare the books
+    MatchingEngine restored;
+    for (const auto& order : orders) {
+        ASSERT_TRUE(order.action == Action::NEW, "Snapshot orders should be NEW orders");
+        restored.processOrder(order);
+    }
+    OrderBook* book = restored.getOrderBook("AAPL");
+    ASSERT_TRUE(book != nullptr, "AAPL book should be restored");
+    ASSERT_TRUE(book->getBuySide().size() == 2, "AAPL should have two buy levels");
+    ASSERT_TRUE(book->getBuySide().begin()->first == 151.0, "Best bid should be 151.0");
+    ASSERT_TRUE(book->getSellSide().begin()->second.front().order_id == 3, "Best ask should be order 3");
+    ASSERT_TRUE(restored.getOrderBook("MSFT") != nullptr, "MSFT book should be restored");
+
+    std::remove(filename.c_str());
+
+    std::cout << "All snapshot_roundtrip tests passed!" << std::endl;
+}
+
+// Test that orders processed after begin() are not part of the snapshot
+TEST(snapshot_point_in_time) {
+    MatchingEngine engine;
+    populateEngine(engine);
+
+    std::string filename = "test_snapshot_pit.csv";
+    SnapshotManager snapshots;
+    ASSERT_TRUE(snapshots.begin(engine, filename), "Snapshot should start");
+
+    // Keep matching while the child writes
+    engine.processOrder({1004, 5, "AAPL", Side::BUY, Type::LIMIT, 10, 149.0f, Action::NEW});
+    engine.processOrder({1005, 1, "AAPL", Side::BUY, Type::LIMIT, 0, 0.0f, Action::CANCEL});
+
+    ASSERT_TRUE(snapshots.wait(), "Snapshot should be written");
+    ASSERT_TRUE(!snapshots.inProgress(), "No snapshot should be in progress after wait");
+
+    CSVParser parser(filename);
+    std::vector<Order> orders = parser.parse();
+    ASSERT_TRUE(orders.size() == 4, "Snapshot should reflect the books at begin()");
+    bool hasOrder1 = false;
+    for (const auto& order : orders) {
+        ASSERT_TRUE(order.order_id != 5, "Order added after begin() should not be in the snapshot");
+        if (order.order_id == 1) hasOrder1 = true;
+    }
+    ASSERT_TRUE(hasOrder1, "Order canceled after begin() should still be in the snapshot");
+
+    std::remove(filename.c_str());
+
+    std::cout << "All snapshot_point_in_time tests passed!" << std::endl;
+}
+
+// Test that prices are written with enough digits to read back the same float
+TEST(snapshot_price_precision) {
+    MatchingEngine engine;
+    const float prices[] = {1234.567f, 0.1f, 99999.99f, 150.25f};
+    for (int i = 0; i < 4; ++i) {
+        engine.processOrder({1000, i + 1, "AAPL", Side::BUY, Type::LIMIT, 10, prices[i], Action::NEW});
+    }
+
+    std::string filename = "test_snapshot_precision.csv";
+    ASSERT_TRUE(SnapshotManager::writeSnapshot(engine, filename), "Snapshot should be written");
+    CSVParser parser(filename);
+    std::vector<Order> orders = parser.parse();
+    ASSERT_TRUE(orders.size() == 4, "Snapshot should contain 4 resting orders");
+    for (const auto& order : orders) {
+        ASSERT_TRUE(order.price == prices[order.order_id - 1],
+                    "Price of order " << order.order_id << " should read back unchanged");
+    }
+    std::remove(filename.c_str());
+
+    std::cout << "All snapshot_price_precision tests passed!" << std::endl;
+}
+
+// Test a snapshot larger than the formatting buffer of the child
+TEST(snapshot_large) {
+    MatchingEngine engine;
+    const int count = 10000;
+    for (int i = 0; i < count; ++i) {
+        engine.processOrder({1000 + static_cast<uint64_t>(i), i + 1, i % 2 ? "AAPL" : "MSFT", Side::BUY, Type::LIMIT,
+                             10 + i, 100.0f + static_cast<float>(i % 100) * 0.25f, Action::NEW});
+    }
+
+    std::string filename = "test_snapshot_large.csv";
+    SnapshotManager snapshots;
+    ASSERT_TRUE(snapshots.begin(engine, filename), "Snapshot should start");
+    ASSERT_TRUE(snapshots.wait(), "Snapshot should be written");
+    CSVParser parser(filename);
+    std::vector<Order> orders = parser.parse();
+    ASSERT_TRUE(orders.size() == count && parser.rejectedCount() == 0, "Every resting order should be written intact");
+    std::remove(filename.c_str());
+
+    std::cout << "All snapshot_large tests passed!" << std::endl;
+}
+
+// Test error reporting for an unwritable path
+TEST(snapshot_error) {
+    MatchingEngine engine;
+    populateEngine(engine);
+
+    SnapshotManager snapshots;
+    ASSERT_TRUE(snapshots.begin(engine, "/invalid/path/snapshot.csv"), "Snapshot should start");
+    ASSERT_TRUE(!snapshots.wait(), "Snapshot to an invalid path should fail");
+    ASSERT_TRUE(snapshots.completedCount() == 0, "No snapshot should be completed");
+
+    std::cout << "All snapshot_error tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running Snapshot tests..." << std::endl;
+
+    test_snapshot_roundtrip();
+    test_snapshot_point_in_time();
+    test_snapshot_price_precision();
+    test_snapshot_large();
+    test_snapshot_error();
+
+    std::cout << "All Snapshot tests passed successfully!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,173 @@
+#include "../src/workload_generator.hpp"
+#include "../src/csv_parser.hpp"
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// Simple test harness function
+#define TEST(name) void test_##name()
+
+// Assertion with message
+#define ASSERT_TRUE(condition, message) \
+    if (!(condition)) { \
+        std::cerr << "Assertion failed: " << message << std::endl; \
+        exit(1); \
+    }
+
+// Test that the same options and seed give the same orders
+TEST(seeded_generation) {
+    WorkloadOptions options;
+    std::vector<Order> first;
+    std::vector<Order> second;
+    WorkloadGenerator(options).generate(5000, first);
+    WorkloadGenerator(options).generate(5000, second);
+    ASSERT_TRUE(first.size() == 5000 && second.size() == 5000, "Should generate 5000 orders");
+    for (size_t i = 0; i < first.size(); ++i) {
+        ASSERT_TRUE(first[i].order_id == second[i].order_id && first[i].price == second[i].price
+                    && first[i].timestamp == second[i].timestamp && first[i].action == second[i].action,
+                    "Same seed should give the same orders");
+    }
+
+    options.seed = 7;
+    std::vector<Order> other;
+    WorkloadGenerator(options).generate(5000, other);
+    bool differs = false;
+    for (size_t i = 0; i < other.size() && !differs; ++i) {
+        differs = other[i].price != first[i].price || other[i].timestamp != first[i].timestamp;
+    }
+    ASSERT_TRUE(differs, "Another seed should give other orders");
+
+    std::cout << "Seeded generation tests passed!" << std::endl;
+}
+
+// Test that cancels and modifies only target live orders of the same instrument
+TEST(cancels_target_live_orders) {
+    WorkloadOptions options;
+    options.cancel_weight = 0.6;
+    WorkloadGenerator generator(options);
+    std::vector<Order> orders;
+    generator.generate(20000, orders);
+
+    std::unordered_map<int, Order> live;
+    std::unordered_set<int> canceled;
+    for (const auto& order : orders) {
+        if (order.action == Action::NEW) {
+            ASSERT_TRUE(live.find(order.order_id) == live.end(), "NEW ids should be unique");
+            live[order.order_id] = order;
+        } else {
+            auto it = live.find(order.order_id);
+            ASSERT_TRUE(it != live.end() && canceled.count(order.order_id) == 0, "Target should be a live order");
+            ASSERT_TRUE(it->second.type == Type::LIMIT, "Target should be a limit order");
+            ASSERT_TRUE(it->second.instrument == order.instrument && it->second.side == order.side,
+                        "Target should keep its instrument and side");
+            if (order.action == Action::CANCEL) {
+                canceled.insert(order.order_id);
+            }
+        }
+    }
+    ASSERT_TRUE(generator.stats().cancels > 5000, "Cancel-heavy mix should generate many cancels");
+
+    std::cout << "Live order targeting tests passed!" << std::endl;
+}
+
+// Test prices on the tick grid near the mid, and Zipfian instrument popularity
+TEST(prices_and_instruments) {
+    WorkloadOptions options;
+    options.mid_drift = 0.0;
+    options.instruments = 5;
+    WorkloadGenerator generator(options);
+    std::vector<Order> orders;
+    generator.generate(20000, orders);
+
+    std::vector<size_t> perInstrument(5, 0);
+    for (const auto& order : orders) {
+        perInstrument[static_cast<size_t>(order.instrument.back() - '0')]++;
+        if (order.type != Type::LIMIT || order.action == Action::CANCEL) {
+            continue;
+        }
+        double ticks = order.price / options.tick_size;
+        ASSERT_TRUE(std::abs(ticks - std::round(ticks)) < 0.01, "Limit prices should be on the tick grid");
+        ASSERT_TRUE(order.price > 90.0f && order.price < 110.0f, "Prices should cluster around the mid");
+        ASSERT_TRUE(order.quantity % options.lot_size == 0 && order.quantity > 0, "Quantities should be whole lots");
+    }
+    ASSERT_TRUE(perInstrument[0] > perInstrument[1] && perInstrument[1] > perInstrument[4],
+                "Instrument popularity should decrease with rank");
+
+    std::cout << "Price and instrument tests passed!" << std::endl;
+}
+
+// Test that bursts compress the gaps between orders
+TEST(bursts) {
+    WorkloadOptions options;
+    options.burst_probability = 0.0;
+    std::vector<Order> calm;
+    WorkloadGenerator(options).generate(2000, calm);
+
+    options.burst_probability = 1.0;
+    std::vector<Order> bursty;
+    WorkloadGenerator burstyGenerator(options);
+    burstyGenerator.generate(2000, bursty);
+    ASSERT_TRUE(burstyGenerator.stats().bursts > 0, "Bursts should start");
+
+    uint64_t calmSpan = calm.back().timestamp - calm.front().timestamp;
+    uint64_t burstySpan = bursty.back().timestamp - bursty.front().timestamp;
+    ASSERT_TRUE(burstySpan * 10 < calmSpan, "Bursts should shorten the span of the workload");
+    for (size_t i = 1; i < bursty.size(); ++i) {
+        ASSERT_TRUE(bursty[i].timestamp >= bursty[i - 1].timestamp, "Timestamps should not decrease");
+    }
+
+    std::cout << "Burst tests passed!" << std::endl;
+}
+
+// Test scenario files and the round trip of a generated order file
+TEST(scenario_and_order_file) {
+    std::string scenario = "test_scenario.csv";
+    {
+        std::ofstream file(scenario);
+        file << "parameter,value\n# comment\norders,300\ncancel_weight,0.9\ntick_size,0.05\nunknown,1\n";
+    }
+    WorkloadOptions options;
+    ASSERT_TRUE(WorkloadOptions::load(scenario, options), "Scenario should load");
+    ASSERT_TRUE(options.orders == 300 && options.cancel_weight == 0.9 && options.tick_size == 0.05,
+                "Scenario parameters should be applied");
+    ASSERT_TRUE(options.new_weight == WorkloadOptions().new_weight, "Other parameters should keep their defaults");
+    ASSERT_TRUE(!WorkloadOptions::load("missing_scenario.csv", options), "Missing scenario should fail");
+    std::remove(scenario.c_str());
+
+    std::vector<Order> orders;
+    WorkloadGenerator(options).generate(options.orders, orders);
+    std::string filename = "test_workload.csv";
+    ASSERT_TRUE(writeOrderFile(filename, orders), "Order file should be written");
+    CSVOrderStream stream(filename);
+    std::vector<Order> batch;
+    std::vector<Order> parsed;
+    while (stream.next(batch, 128) > 0) {
+        parsed.insert(parsed.end(), batch.begin(), batch.end());
+    }
+    ASSERT_TRUE(parsed.size() == orders.size() && stream.rejectedCount() == 0, "Every order should parse back");
+    for (size_t i = 0; i < orders.size(); ++i) {
+        ASSERT_TRUE(parsed[i].order_id == orders[i].order_id && parsed[i].price == orders[i].price
+                    && parsed[i].timestamp == orders[i].timestamp && parsed[i].action == orders[i].action,
+                    "Parsed order should match the generated one");
+    }
+    std::remove(filename.c_str());
+
+    std::cout << "Scenario and order file tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running WorkloadGenerator tests..." << std::endl;
+
+    test_seeded_generation();
+    test_cancels_target_live_orders();
+    test_prices_and_instruments();
+    test_bursts();
+    test_scenario_and_order_file();
+
+    std::cout << "All WorkloadGenerator tests passed successfully!" << std::endl;
+    return 0;
+}
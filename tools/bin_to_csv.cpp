@@ -0,0 +1,39 @@
+/**
+ * @file bin_to_csv.cpp
+ * @brief Converts a binary result file back to the output CSV layout.
+ *
+ * Usage: bin_to_csv <results.bin> <output.csv>
+ *
+ * The rows are written by CSVWriter, so the output is identical to what the matching
+ * engine writes when it produces CSV directly.
+ */
+
+#include "../src/binary_result_file.hpp"
+#include "../src/csv_writer.hpp"
+#include <iostream>
+#include <string>
+
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <results.bin> <output.csv>" << std::endl;
+        return 1;
+    }
+
+    BinaryResultReader reader(argv[1]);
+    if (!reader.isOpen()) {
+        return 1;
+    }
+
+    CSVWriter writer(argv[2]);
+    writer.writeHeader();
+    OrderResult result;
+    for (uint64_t i = 0; i < reader.recordCount(); ++i) {
+        reader.toResult(reader.records()[i], result);
+        writer.writeOrderResult(result);
+    }
+    writer.flush();
+
+    std::cout << "Converted " << reader.recordCount() << " results from " << argv[1]
+              << " to " << argv[2] << std::endl;
+    return 0;
+}
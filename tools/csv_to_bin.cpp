@@ -0,0 +1,50 @@
+/**
+ * @file csv_to_bin.cpp
+ * @brief Converts an input CSV file of orders to the binary order format.
+ *
+ * Usage: csv_to_bin <input.csv> <output.bin>
+ *
+ * The CSV file is streamed in batches, so files larger than memory can be converted.
+ * Malformed rows are reported and skipped, as in the matching engine.
+ */
+
+#include "../src/binary_order_file.hpp"
+#include "../src/csv_parser.hpp"
+#include <iostream>
+#include <string>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <input.csv> <output.bin>" << std::endl;
+        return 1;
+    }
+
+    CSVOrderStream stream(argv[1], true);
+    if (!stream.isOpen()) {
+        return 1;
+    }
+    BinaryOrderWriter writer(argv[2]);
+    if (!writer.isOpen()) {
+        return 1;
+    }
+
+    std::vector<Order> batch;
+    while (stream.next(batch, 4096) > 0) {
+        for (const auto& order : batch) {
+            if (!writer.writeOrder(order)) {
+                return 1;
+            }
+        }
+    }
+    if (!writer.close()) {
+        return 1;
+    }
+
+    std::cout << "Converted " << writer.recordCount() << " orders from " << argv[1]
+              << " to " << argv[2] << std::endl;
+    if (stream.rejectedCount() > 0) {
+        std::cout << "Rejected " << stream.rejectedCount() << " malformed rows" << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,100 @@
+/**
+ * @file gateway_load.cpp
+ * @brief Sends an order file to a running gateway and measures the round trip.
+ *
+ * Usage: gateway_load <input.csv|input.bin> [--port <n>] [--window <n>]
+ *
+ * At most window orders are in flight at a time; new orders are sent in one write as soon
+ * as ACKs free room in the window. ACKs of a session come back in the order the orders
+ * were sent, so each ACK is matched with the send time of the oldest outstanding order.
+ */
+
+#include "../src/gateway_client.hpp"
+#include "../src/order_source.hpp"
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <iostream>
+#include <string>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <input.csv|input.bin> [--port <n>] [--window <n>]" << std::endl;
+        return 1;
+    }
+    uint16_t port = 9000;
+    size_t window = 64;
+    for (int i = 2; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--port" && i + 1 < argc) {
+            port = static_cast<uint16_t>(std::stoul(argv[++i]));
+        } else if (arg == "--window" && i + 1 < argc) {
+            window = std::max<size_t>(1, std::stoul(argv[++i]));
+        } else {
+            std::cerr << "Unknown option: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    std::vector<Order> orders;
+    if (!loadOrderFile(argv[1], orders)) {
+        return 1;
+    }
+    GatewayClient client;
+    if (!client.connect(port)) {
+        return 1;
+    }
+
+    using Clock = std::chrono::steady_clock;
+    std::deque<Clock::time_point> inFlight;
+    std::vector<double> latencies;
+    latencies.reserve(orders.size());
+    std::vector<Order> chunk;
+    std::vector<ExecutionReport> reports;
+    size_t next = 0;
+    size_t fills = 0;
+
+    auto start = Clock::now();
+    while (latencies.size() < orders.size()) {
+        if (inFlight.size() < window && next < orders.size()) {
+            size_t count = std::min(window - inFlight.size(), orders.size() - next);
+            chunk.assign(orders.begin() + static_cast<std::ptrdiff_t>(next),
+                         orders.begin() + static_cast<std::ptrdiff_t>(next + count));
+            auto sentAt = Clock::now();
+            if (!client.sendOrders(chunk)) {
+                std::cerr << "Erreur : envoi vers la passerelle impossible" << std::endl;
+                return 1;
+            }
+            inFlight.insert(inFlight.end(), count, sentAt);
+            next += count;
+        }
+
+        reports.clear();
+        if (client.receive(reports) == 0) {
+            std::cerr << "Erreur : connexion fermée par la passerelle" << std::endl;
+            return 1;
+        }
+        auto receivedAt = Clock::now();
+        for (const auto& report : reports) {
+            if (report.header.type != static_cast<uint8_t>(MessageType::ACK)) {
+                ++fills;
+                continue;
+            }
+            latencies.push_back(std::chrono::duration<double, std::micro>(receivedAt - inFlight.front()).count());
+            inFlight.pop_front();
+        }
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&](double p) {
+        return latencies.empty() ? 0.0 : latencies[static_cast<size_t>(p * static_cast<double>(latencies.size() - 1))];
+    };
+    std::cout << "Sent " << orders.size() << " orders in " << seconds << " s ("
+              << static_cast<uint64_t>(static_cast<double>(orders.size()) / std::max(seconds, 1e-9)) << " orders/s)" << std::endl;
+    std::cout << "Fills received: " << fills << std::endl;
+    std::cout << "Round trip (us): p50 " << percentile(0.50) << ", p99 " << percentile(0.99)
+              << ", max " << percentile(1.0) << std::endl;
+    return 0;
+}
@@ -0,0 +1,66 @@
+/**
+ * @file gen_workload.cpp
+ * @brief Generates a realistic order workload and writes it as a scenario order file.
+ *
+ * Usage: gen_workload <output.csv|output.bin> [--scenario <file>] [--orders <n>] [--seed <n>]
+ *
+ * The options of the scenario file are applied first; --orders and --seed override them.
+ * The resulting file can be processed by the engine, replayed by the replay tool or passed
+ * to the benchmark with --input.
+ */
+
+#include "../src/workload_generator.hpp"
+#include <iostream>
+#include <string>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+    const char* usage = " <output.csv|output.bin> [--scenario <file>] [--orders <n>] [--seed <n>]";
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << usage << std::endl;
+        return 1;
+    }
+    WorkloadOptions options;
+    std::string scenarioFile;
+    std::string orders;
+    std::string seed;
+    for (int i = 2; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--scenario" && i + 1 < argc) {
+            scenarioFile = argv[++i];
+        } else if (arg == "--orders" && i + 1 < argc) {
+            orders = argv[++i];
+        } else if (arg == "--seed" && i + 1 < argc) {
+            seed = argv[++i];
+        } else {
+            std::cerr << "Usage: " << argv[0] << usage << std::endl;
+            return 1;
+        }
+    }
+    if (!scenarioFile.empty() && !WorkloadOptions::load(scenarioFile, options)) {
+        return 1;
+    }
+    if (!orders.empty()) {
+        options.orders = std::stoull(orders);
+    }
+    if (!seed.empty()) {
+        options.seed = static_cast<uint32_t>(std::stoul(seed));
+    }
+
+    WorkloadGenerator generator(options);
+    std::vector<Order> workload;
+    generator.generate(options.orders, workload);
+    if (!writeOrderFile(argv[1], workload)) {
+        return 1;
+    }
+
+    const WorkloadStats& stats = generator.stats();
+    std::cout << "Wrote " << workload.size() << " orders (seed " << options.seed << ") to " << argv[1] << std::endl;
+    std::cout << "  NEW limit: " << stats.limits << " (" << stats.aggressive << " marketable), MARKET: " << stats.markets
+              << ", CANCEL: " << stats.cancels << ", MODIFY: " << stats.modifies << std::endl;
+    if (!workload.empty()) {
+        std::cout << "  Bursts: " << stats.bursts << ", span "
+                  << static_cast<double>(workload.back().timestamp - workload.front().timestamp) / 1e9 << " s" << std::endl;
+    }
+    return 0;
+}
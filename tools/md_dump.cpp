@@ -0,0 +1,81 @@
+/**
+ * @file md_dump.cpp
+ * @brief Prints the market-data feed held in a shared-memory ring.
+ *
+ * Usage: md_dump <shm-name> [--follow]
+ *
+ * Prints the messages still held by the ring, then exits; with --follow, keeps polling
+ * for new messages until interrupted.
+ */
+
+#include "../src/market_data_ring.hpp"
+#include "../src/order.hpp"
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+static void printMessage(const MarketDataMessage& message) {
+    const MarketDataHeader& header = message.header;
+    std::cout << header.sequence << " " << header.timestamp << " #" << header.locate << " ";
+    switch (static_cast<MarketDataType>(header.type)) {
+        case MarketDataType::INSTRUMENT_DIRECTORY:
+            std::cout << "DIRECTORY " << std::string(message.directory.symbol, strnlen(message.directory.symbol, BINARY_SYMBOL_SIZE));
+            break;
+        case MarketDataType::ADD_ORDER:
+        case MarketDataType::REPLACE_ORDER:
+            std::cout << (header.type == static_cast<uint8_t>(MarketDataType::ADD_ORDER) ? "ADD " : "REPLACE ")
+                      << message.add.order_id << " " << sideName(static_cast<Side>(message.add.side)) << " "
+                      << message.add.quantity << " @ " << message.add.price;
+            break;
+        case MarketDataType::DELETE_ORDER:
+            std::cout << "DELETE " << message.remove.order_id;
+            break;
+        case MarketDataType::ORDER_EXECUTED:
+            std::cout << "EXECUTED " << message.executed.order_id << " " << message.executed.executed_quantity
+                      << " @ " << message.executed.execution_price << " against " << message.executed.counterparty_id
+                      << " (match " << message.executed.match_number << ")";
+            break;
+        case MarketDataType::LEVEL_UPDATE:
+            std::cout << "LEVEL " << sideName(static_cast<Side>(message.level.side)) << " " << message.level.price
+                      << ": " << message.level.quantity << " in " << message.level.count << " orders";
+            break;
+        default:
+            std::cout << "UNKNOWN type " << static_cast<int>(header.type);
+            break;
+    }
+    std::cout << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2 || argc > 3 || (argc == 3 && std::string(argv[2]) != "--follow")) {
+        std::cerr << "Usage: " << argv[0] << " <shm-name> [--follow]" << std::endl;
+        return 1;
+    }
+    bool follow = argc == 3;
+
+    MarketDataRingReader reader(argv[1]);
+    if (!reader.isOpen()) {
+        return 1;
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::vector<MarketDataMessage> messages;
+    do {
+        messages.clear();
+        if (reader.poll(messages) == 0 && follow) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        for (const auto& message : messages) {
+            printMessage(message);
+        }
+    } while (follow);
+
+    if (reader.lost() > 0) {
+        std::cout << "Lost " << reader.lost() << " messages overwritten by the writer" << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,224 @@
+/**
+ * @file replay.cpp
+ * @brief Replays an order file at the pace of its timestamps and measures engine latency.
+ *
+ * Usage: replay <input.csv|input.bin> [--speed <x>|max] [--shm <shm-name>] [--config <file>]
+ *
+ * Each order is submitted when the time elapsed since the first order, multiplied by the
+ * speed, reaches the distance between its timestamp and the first one: --speed 1 keeps
+ * the recorded gaps, --speed 10 divides them by ten and --speed max sends back to back.
+ *
+ * By default the engine runs in the process, on its own thread fed through an SPSC
+ * queue. With --shm the orders go to a running shm_server and the ACKs are matched with
+ * their orders in submission order. Latency is measured from the time an order was due,
+ * so the queueing delay an order suffers behind a burst is part of its latency.
+ */
+
+#include "../src/engine_config.hpp"
+#include "../src/latency_stats.hpp"
+#include "../src/matching_engine.hpp"
+#include "../src/order_source.hpp"
+#include "../src/replay_pacer.hpp"
+#include "../src/shm_ingress_client.hpp"
+#include "../src/spsc_queue.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using Clock = ReplayPacer::Clock;
+
+/**
+ * @brief Largest number of orders whose timestamps fall within one window of the recording.
+ */
+static size_t busiestWindow(const std::vector<Order>& orders, uint64_t window) {
+    size_t best = 0;
+    size_t first = 0;
+    for (size_t last = 0; last < orders.size(); ++last) {
+        while (orders[first].timestamp + window <= orders[last].timestamp) {
+            ++first;
+        }
+        best = std::max(best, last - first + 1);
+    }
+    return best;
+}
+
+static double micros(Clock::duration duration) {
+    return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+static void printSummary(const char* label, std::vector<double>& samples) {
+    LatencySummary summary = summarizeLatencies(samples);
+    std::cout << label << " (us): p50 " << summary.p50 << ", p90 " << summary.p90 << ", p99 " << summary.p99
+              << ", p99.9 " << summary.p999 << ", max " << summary.max << std::endl;
+}
+
+/**
+ * @brief Replays into an engine running on a second thread of the process.
+ *
+ * The replay thread pushes order indices at their due times; the engine thread records
+ * for each order the time from due to completion and its processing time alone.
+ */
+static void replayInProcess(const std::vector<Order>& orders, ReplayPacer& pacer, MatchingEngine& engine,
+                            std::vector<double>& latencies, std::vector<double>& service, std::vector<double>& lag) {
+    std::vector<Clock::time_point> due(orders.size());
+    SPSCQueue<size_t> queue(65536);
+
+    std::thread matcher([&]() {
+        size_t index = 0;
+        size_t processed = 0;
+        while (processed < orders.size()) {
+            if (!queue.tryPop(index)) {
+                std::this_thread::yield();
+                continue;
+            }
+            auto begin = Clock::now();
+            engine.processOrder(orders[index]);
+            auto end = Clock::now();
+            latencies.push_back(micros(end - due[index]));
+            service.push_back(micros(end - begin));
+            ++processed;
+        }
+    });
+
+    pacer.start(orders.front().timestamp);
+    for (size_t i = 0; i < orders.size(); ++i) {
+        due[i] = pacer.wait(orders[i].timestamp);
+        while (!queue.tryPush(i)) {
+            std::this_thread::yield();
+        }
+        lag.push_back(micros(Clock::now() - due[i]));
+    }
+    matcher.join();
+}
+
+/**
+ * @brief Replays into a running shm_server, draining ACKs while waiting for the next order.
+ */
+static bool replayShm(const std::vector<Order>& orders, ReplayPacer& pacer, const std::string& name,
+                      std::vector<double>& latencies, std::vector<double>& lag) {
+    ShmIngressClient client(name);
+    if (!client.isOpen()) {
+        return false;
+    }
+    std::vector<Clock::time_point> due(orders.size());
+    std::vector<ExecutionReport> reports;
+    size_t acked = 0;
+    pacer.start(orders.front().timestamp);
+
+    auto drain = [&]() {
+        reports.clear();
+        if (client.receive(reports) == 0) {
+            return;
+        }
+        auto receivedAt = Clock::now();
+        for (const auto& report : reports) {
+            if (report.header.type == static_cast<uint8_t>(MessageType::ACK) && acked < orders.size()) {
+                latencies.push_back(micros(receivedAt - due[acked++]));
+            }
+        }
+    };
+
+    for (size_t i = 0; i < orders.size(); ++i) {
+        due[i] = pacer.due(orders[i].timestamp);
+        while (Clock::now() < due[i]) {
+            drain();
+            std::this_thread::yield();
+        }
+        if (!client.submit(orders[i])) {
+            std::cerr << "Erreur : ordre " << orders[i].order_id << " impossible à encoder" << std::endl;
+            return false;
+        }
+        lag.push_back(micros(Clock::now() - due[i]));
+        drain();
+    }
+    while (acked < orders.size()) {
+        drain();
+        if (client.droppedReports() > 0) {
+            std::cerr << "Erreur : " << client.droppedReports() << " rapports perdus par le serveur" << std::endl;
+            return false;
+        }
+        std::this_thread::yield();
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    const char* usage = " <input.csv|input.bin> [--speed <x>|max] [--shm <shm-name>] [--config <file>]";
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << usage << std::endl;
+        return 1;
+    }
+    double speed = 1.0;
+    std::string shmName;
+    std::string configFile;
+    for (int i = 2; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--speed" && i + 1 < argc) {
+            std::string value = argv[++i];
+            speed = value == "max" ? 0.0 : std::stod(value);
+            if (speed < 0.0) {
+                std::cerr << "Erreur : vitesse invalide : " << value << std::endl;
+                return 1;
+            }
+        } else if (arg == "--shm" && i + 1 < argc) {
+            shmName = argv[++i];
+        } else if (arg == "--config" && i + 1 < argc) {
+            configFile = argv[++i];
+        } else {
+            std::cerr << "Usage: " << argv[0] << usage << std::endl;
+            return 1;
+        }
+    }
+
+    std::vector<Order> orders;
+    if (!loadOrderFile(argv[1], orders)) {
+        return 1;
+    }
+    if (orders.empty()) {
+        std::cout << "No orders to replay" << std::endl;
+        return 0;
+    }
+
+    uint64_t span = orders.back().timestamp > orders.front().timestamp
+                        ? orders.back().timestamp - orders.front().timestamp : 0;
+    std::cout << "Recording: " << orders.size() << " orders over " << static_cast<double>(span) / 1e9
+              << " s, busiest millisecond " << busiestWindow(orders, 1000000) << " orders" << std::endl;
+
+    std::vector<double> latencies;
+    std::vector<double> service;
+    std::vector<double> lag;
+    latencies.reserve(orders.size());
+    service.reserve(orders.size());
+    lag.reserve(orders.size());
+
+    ReplayPacer pacer(speed);
+    if (shmName.empty()) {
+        EngineConfig config;
+        if (!configFile.empty()) {
+            config = EngineConfig::load(configFile);
+        }
+        MatchingEngine engine(config);
+        replayInProcess(orders, pacer, engine, latencies, service, lag);
+    } else if (!replayShm(orders, pacer, shmName, latencies, lag)) {
+        return 1;
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - pacer.due(orders.front().timestamp)).count();
+
+    std::cout << "Replayed " << orders.size() << " orders at ";
+    if (pacer.unpaced()) {
+        std::cout << "max speed";
+    } else {
+        std::cout << speed << "x";
+    }
+    std::cout << " in " << seconds << " s ("
+              << static_cast<uint64_t>(static_cast<double>(orders.size()) / std::max(seconds, 1e-9)) << " orders/s)" << std::endl;
+    printSummary(shmName.empty() ? "Latency from due time" : "Round trip from due time", latencies);
+    if (!service.empty()) {
+        printSummary("Processing time", service);
+    }
+    printSummary("Pacer lag", lag);
+    return 0;
+}
@@ -0,0 +1,66 @@
+/**
+ * @file shm_server.cpp
+ * @brief Runs the matching engine behind the shared-memory order ingress.
+ *
+ * Usage: shm_server [--name <shm-name>] [--producers <n>] [--config <file>]
+ *
+ * The engine polls the ingress until SIGINT or SIGTERM, then prints its counters.
+ */
+
+#include "../src/engine_config.hpp"
+#include "../src/shm_ingress.hpp"
+#include <csignal>
+#include <iostream>
+#include <string>
+
+static ShmIngressServer* runningServer = nullptr;
+
+static void onSignal(int) {
+    if (runningServer != nullptr) {
+        runningServer->stop();
+    }
+}
+
+int main(int argc, char* argv[]) {
+    std::string name = "/engine_in";
+    ShmIngressOptions options;
+    std::string configFile;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--name" && i + 1 < argc) {
+            name = argv[++i];
+        } else if (arg == "--producers" && i + 1 < argc) {
+            options.maxProducers = static_cast<uint32_t>(std::stoul(argv[++i]));
+        } else if (arg == "--config" && i + 1 < argc) {
+            configFile = argv[++i];
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--name <shm-name>] [--producers <n>] [--config <file>]" << std::endl;
+            return 1;
+        }
+    }
+
+    EngineConfig config;
+    if (!configFile.empty()) {
+        config = EngineConfig::load(configFile);
+    }
+    MatchingEngine engine(config);
+    ShmIngressServer server(name, engine, options);
+    if (!server.isOpen()) {
+        return 1;
+    }
+    runningServer = &server;
+    std::signal(SIGINT, onSignal);
+    std::signal(SIGTERM, onSignal);
+
+    std::cout << "Order ingress ready on " << name << std::endl;
+    server.run();
+    runningServer = nullptr;
+
+    const ShmIngressStats& stats = server.stats();
+    std::cout << "Orders processed: " << stats.requests << std::endl;
+    std::cout << "Reports delivered: " << stats.reports << std::endl;
+    if (stats.droppedReports > 0) {
+        std::cout << "Reports dropped on full response rings: " << stats.droppedReports << std::endl;
+    }
+    return 0;
+}